@@ -0,0 +1,59 @@
+import matplotlib
+matplotlib.use("Agg")
+import matplotlib.pyplot as plt
+import argparse
+import json
+import re
+
+
+def load_results(file_name):
+    with open(file_name) as f:
+        return json.load(f)
+
+
+def split_name(name):
+    '''Split "LAT_gemm<double>/16" into ("LAT_gemm<double>", 16)'''
+    m = re.fullmatch(r'(.+?)/(\d+)(?:/.*)?', name)
+    if m is None:
+        return name, None
+    return m.group(1), int(m.group(2))
+
+
+parser = argparse.ArgumentParser(description='Latency percentiles of benchmark results')
+parser.add_argument('data_files', nargs='+', help='JSON files written by bench-* with --latency --latency_out')
+parser.add_argument('--percentile', choices=['p50', 'p99', 'p99.9', 'max'], default='p99.9', help='plotted percentile')
+parser.add_argument('--output', default='bench_result/image/latency.png', help='output image file')
+args = parser.parse_args()
+
+series = {}
+
+for file_name in args.data_files:
+    results = load_results(file_name)
+    context = results['context']
+    print(f"{file_name}: timer={context['timer']} cpu={context['cpu']} sched_fifo={context['sched_fifo']} cache_mode={context['cache_mode']}")
+    print(f"{'name':40s} {'p50':>10s} {'p99':>10s} {'p99.9':>10s} {'max':>10s}")
+
+    for b in results['benchmarks']:
+        print(f"{b['name']:40s} {b['p50']:10.0f} {b['p99']:10.0f} {b['p99.9']:10.0f} {b['max']:10.0f}")
+
+        function, m = split_name(b['name'])
+        if m is not None:
+            series.setdefault(function, {}).setdefault(file_name, []).append((m, b[args.percentile]))
+
+fig = plt.figure(figsize=[10, 4 * len(series)])
+axes = fig.subplots(len(series), 1, squeeze=False)[:, 0] if series else []
+
+for ax, (function, files) in zip(axes, sorted(series.items())):
+    for file_name, points in files.items():
+        points.sort()
+        ax.plot([p[0] for p in points], [p[1] for p in points], 'o-', label = file_name, markersize = 4)
+
+    ax.set_yscale('log')
+    ax.grid(True, which = 'both')
+    ax.legend()
+    ax.set_xlabel('matrix size')
+    ax.set_ylabel(f'{args.percentile} latency [ns]')
+    ax.set_title(function)
+
+fig.tight_layout()
+fig.savefig(args.output)
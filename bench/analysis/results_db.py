@@ -0,0 +1,347 @@
+'''
+Benchmark result database and regression report.
+
+Ingests the JSON files written by the bench-* executables with --benchmark_out
+into an SQLite database, keyed by commit, host and CPU flags,
+and compares the results of two commits per routine and per size:
+
+    python3 bench/analysis/results_db.py ingest bench_result/results.sqlite bench_result/data/*.json
+    python3 bench/analysis/results_db.py list bench_result/results.sqlite
+    python3 bench/analysis/results_db.py report bench_result/results.sqlite --base <commit> --head <commit>
+
+The change of each benchmark is the ratio of the mean times of the head and base commits.
+Its confidence interval is computed with Welch's t-test on the logarithms of the times
+of the individual repetitions, so run the benchmarks with --benchmark_repetitions >= 2.
+A change is significant if the whole confidence interval is beyond --threshold.
+'''
+
+import argparse
+import json
+import math
+import os.path
+import platform
+import re
+import sqlite3
+import statistics
+import subprocess
+import sys
+
+
+SCHEMA = '''
+CREATE TABLE IF NOT EXISTS runs (
+    id INTEGER PRIMARY KEY,
+    commit_sha TEXT NOT NULL,
+    commit_time INTEGER,
+    dirty INTEGER NOT NULL,
+    host TEXT NOT NULL,
+    cpu_model TEXT NOT NULL,
+    cpu_flags TEXT NOT NULL,
+    executable TEXT NOT NULL,
+    cache_mode TEXT,
+    date TEXT,
+    file_name TEXT NOT NULL
+);
+
+CREATE TABLE IF NOT EXISTS samples (
+    run_id INTEGER NOT NULL REFERENCES runs(id),
+    name TEXT NOT NULL,
+    repetition INTEGER NOT NULL,
+    real_time_ns REAL NOT NULL,
+    cpu_time_ns REAL NOT NULL,
+    iterations INTEGER NOT NULL,
+    flops REAL
+);
+
+CREATE INDEX IF NOT EXISTS samples_run_name ON samples(run_id, name);
+'''
+
+
+TIME_UNIT_NS = {'ns': 1., 'us': 1e+3, 'ms': 1e+6, 's': 1e+9}
+
+
+def git(*args):
+    return subprocess.run(['git', *args], check=True, capture_output=True, text=True).stdout.strip()
+
+
+def current_commit():
+    '''Return (sha, commit time, dirty) of the working tree'''
+    sha = git('rev-parse', 'HEAD')
+    commit_time = int(git('show', '-s', '--format=%ct', sha))
+    dirty = git('status', '--porcelain', '--untracked-files=no') != ''
+    return sha, commit_time, dirty
+
+
+def cpu_info():
+    '''Return (model, sorted space-separated flags) of the CPU of this host'''
+    model, flags = None, set()
+
+    try:
+        with open('/proc/cpuinfo') as f:
+            for line in f:
+                key, _, value = line.partition(':')
+                key = key.strip()
+                if key == 'model name' and model is None:
+                    model = value.strip()
+                elif key in ('flags', 'Features'):
+                    flags.update(value.split())
+    except FileNotFoundError:
+        pass
+
+    return model or platform.processor() or platform.machine(), ' '.join(sorted(flags))
+
+
+def open_db(file_name):
+    db = sqlite3.connect(file_name)
+    db.executescript(SCHEMA)
+    return db
+
+
+def ingest(db, file_name, commit, cpu):
+    with open(file_name) as f:
+        results = json.load(f)
+
+    context = results.get('context', {})
+    samples = []
+
+    for b in results.get('benchmarks', []):
+        # Skip aggregates, latency benchmarks and errors, which have no time per iteration
+        if b.get('run_type', 'iteration') != 'iteration' or 'real_time' not in b or b.get('error_occurred'):
+            continue
+
+        unit = TIME_UNIT_NS[b.get('time_unit', 'ns')]
+        samples.append((b.get('run_name', b['name']), b.get('repetition_index', 0),
+            b['real_time'] * unit, b['cpu_time'] * unit, b['iterations'], b.get('flops')))
+
+    if not samples:
+        print(f'{file_name}: no benchmark results, skipped', file=sys.stderr)
+        return 0
+
+    sha, commit_time, dirty = commit
+    cur = db.execute('''INSERT INTO runs (commit_sha, commit_time, dirty, host, cpu_model, cpu_flags,
+        executable, cache_mode, date, file_name) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?)''',
+        (sha, commit_time, dirty, context.get('host_name', platform.node()), cpu[0], cpu[1],
+        os.path.basename(context.get('executable', file_name)), context.get('cache_mode'),
+        context.get('date'), os.path.abspath(file_name)))
+    db.executemany('INSERT INTO samples VALUES (?, ?, ?, ?, ?, ?, ?)', [(cur.lastrowid, *s) for s in samples])
+
+    return len(samples)
+
+
+def resolve_commit(db, prefix, host):
+    shas = [r[0] for r in db.execute('SELECT DISTINCT commit_sha FROM runs WHERE commit_sha LIKE ? AND host = ?',
+        (prefix + '%', host))]
+
+    if len(shas) != 1:
+        sys.exit(f'{"No" if not shas else "Ambiguous"} commit {prefix} for host {host} in the database')
+
+    return shas[0]
+
+
+def recent_commits(db, host):
+    '''Commits of a host, from the oldest to the newest'''
+    return [r[0] for r in db.execute('''SELECT commit_sha FROM runs WHERE host = ?
+        GROUP BY commit_sha ORDER BY MAX(commit_time), MAX(id)''', (host,))]
+
+
+def load_samples(db, sha, host):
+    '''Return {(executable, name): [real time]} and the set of CPU flags of a commit'''
+    samples, flags = {}, set()
+
+    for executable, name, t, cpu_flags in db.execute('''SELECT executable, name, real_time_ns, cpu_flags
+            FROM samples JOIN runs ON samples.run_id = runs.id
+            WHERE commit_sha = ? AND host = ?''', (sha, host)):
+        samples.setdefault((executable, name), []).append(t)
+        flags.add(cpu_flags)
+
+    return samples, flags
+
+
+def incomplete_beta(a, b, x):
+    '''Regularized incomplete beta function I_x(a, b), by the continued fraction of Numerical Recipes'''
+    if x <= 0.:
+        return 0.
+    if x >= 1.:
+        return 1.
+    if x > (a + 1.) / (a + b + 2.):
+        return 1. - incomplete_beta(b, a, 1. - x)
+
+    front = math.exp(math.lgamma(a + b) - math.lgamma(a) - math.lgamma(b) + a * math.log(x) + b * math.log(1. - x)) / a
+    tiny = 1e-300
+    c, d = 1., 1. - (a + b) * x / (a + 1.)
+    d = 1. / (d if abs(d) > tiny else tiny)
+    f = d
+
+    for m in range(1, 300):
+        for numerator in (m * (b - m) * x / ((a + 2 * m - 1) * (a + 2 * m)),
+                -(a + m) * (a + b + m) * x / ((a + 2 * m) * (a + 2 * m + 1))):
+            d = 1. + numerator * d
+            d = 1. / (d if abs(d) > tiny else tiny)
+            c = 1. + numerator / c
+            c = c if abs(c) > tiny else tiny
+            f *= c * d
+
+        if abs(c * d - 1.) < 1e-12:
+            break
+
+    return front * f
+
+
+def t_quantile(p, dof):
+    '''Quantile of Student's t distribution for p > 0.5, by bisection of its CDF'''
+    cdf = lambda t: 1. - 0.5 * incomplete_beta(dof / 2., 0.5, dof / (dof + t * t))
+    lo, hi = 0., 1.
+
+    while cdf(hi) < p:
+        hi *= 2.
+
+    for _ in range(100):
+        mid = (lo + hi) / 2.
+        lo, hi = (mid, hi) if cdf(mid) < p else (lo, mid)
+
+    return (lo + hi) / 2.
+
+
+def compare(base, head, confidence):
+    '''
+    Ratio of the mean times of head and base with its confidence interval.
+
+    The interval is None if there are fewer than 2 samples on either side.
+    '''
+    ratio = statistics.fmean(head) / statistics.fmean(base)
+
+    if len(base) < 2 or len(head) < 2:
+        return ratio, None
+
+    log_base, log_head = [math.log(t) for t in base], [math.log(t) for t in head]
+    vb, vh = statistics.variance(log_base) / len(base), statistics.variance(log_head) / len(head)
+    diff = statistics.fmean(log_head) - statistics.fmean(log_base)
+
+    if vb + vh == 0.:
+        return ratio, (math.exp(diff), math.exp(diff))
+
+    # Welch-Satterthwaite degrees of freedom
+    dof = (vb + vh) ** 2 / (vb ** 2 / (len(base) - 1) + vh ** 2 / (len(head) - 1))
+    half_width = t_quantile(0.5 + confidence / 2., dof) * math.sqrt(vb + vh)
+
+    return ratio, (math.exp(diff - half_width), math.exp(diff + half_width))
+
+
+def split_name(name):
+    '''Split "BM_gemm_shapes<double>/m:4/n:8/k:16" into ("BM_gemm_shapes<double>", "m:4/n:8/k:16")'''
+    routine, _, size = name.partition('/')
+    return routine, size
+
+
+def size_key(size):
+    return [int(s) if s.isdigit() else s for s in re.split(r'(\d+)', size)]
+
+
+def report(db, args):
+    host = args.host or platform.node()
+    commits = recent_commits(db, host)
+
+    if len(commits) < 2 and not (args.base and args.head):
+        sys.exit(f'Need results of two commits of host {host} in the database')
+
+    base = resolve_commit(db, args.base, host) if args.base else commits[-2]
+    head = resolve_commit(db, args.head, host) if args.head else commits[-1]
+    base_samples, base_flags = load_samples(db, base, host)
+    head_samples, head_flags = load_samples(db, head, host)
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    print(f'# Benchmark changes {base[:12]} -> {head[:12]} on {host}\n', file=out)
+
+    if base_flags != head_flags:
+        print('**Warning:** the CPU flags of the two commits differ, the results may not be comparable.\n', file=out)
+
+    tables, slower, faster = {}, [], []
+
+    for key in sorted(base_samples.keys() & head_samples.keys()):
+        ratio, ci = compare(base_samples[key], head_samples[key], args.confidence)
+
+        verdict = ''
+        if ci is not None and ci[0] > 1. + args.threshold:
+            verdict = '**slower**'
+            slower.append(key)
+        elif ci is not None and ci[1] < 1. - args.threshold:
+            verdict = 'faster'
+            faster.append(key)
+
+        executable, name = key
+        routine, size = split_name(name)
+        tables.setdefault((executable, routine), []).append((size, statistics.fmean(base_samples[key]),
+            statistics.fmean(head_samples[key]), ratio, ci, verdict))
+
+    compared = sum(len(rows) for rows in tables.values())
+    print(f'{compared} benchmarks compared, {len(slower)} significantly slower, {len(faster)} significantly faster '
+        f'({args.confidence:.0%} confidence, threshold {args.threshold:.1%}).\n', file=out)
+
+    for (executable, routine), rows in sorted(tables.items()):
+        if args.changes_only and not any(r[5] for r in rows):
+            continue
+
+        print(f'## {executable}: {routine}\n', file=out)
+        print('| size | base [ns] | head [ns] | change | CI | |', file=out)
+        print('|---|---:|---:|---:|---:|---|', file=out)
+
+        for size, t_base, t_head, ratio, ci, verdict in sorted(rows, key=lambda r: size_key(r[0])):
+            ci_text = f'{ci[0] - 1.:+.1%} .. {ci[1] - 1.:+.1%}' if ci is not None else 'n/a'
+            print(f'| {size or "-"} | {t_base:.1f} | {t_head:.1f} | {ratio - 1.:+.1%} | {ci_text} | {verdict} |', file=out)
+
+        print(file=out)
+
+    if out is not sys.stdout:
+        out.close()
+
+    return 1 if slower and args.fail_on_regression else 0
+
+
+def list_runs(db):
+    print(f"{'commit':12s} {'dirty':5s} {'host':20s} {'executable':30s} {'samples':>8s}  cpu")
+    for sha, dirty, host, executable, count, model in db.execute('''SELECT commit_sha, dirty, host, executable,
+            COUNT(*), cpu_model FROM runs JOIN samples ON samples.run_id = runs.id
+            GROUP BY runs.id ORDER BY commit_time, runs.id'''):
+        print(f"{sha[:12]:12s} {'yes' if dirty else '':5s} {host:20s} {executable:30s} {count:8d}  {model}")
+
+
+parser = argparse.ArgumentParser(description='Benchmark result database and regression report')
+subparsers = parser.add_subparsers(dest='command', required=True)
+
+ingest_parser = subparsers.add_parser('ingest', help='add JSON files written by bench-* with --benchmark_out')
+ingest_parser.add_argument('db', help='SQLite database file')
+ingest_parser.add_argument('data_files', nargs='+', help='JSON files')
+ingest_parser.add_argument('--commit', help='commit the results belong to, by default HEAD of the working tree')
+
+list_parser = subparsers.add_parser('list', help='list the ingested runs')
+list_parser.add_argument('db', help='SQLite database file')
+
+report_parser = subparsers.add_parser('report', help='compare the results of two commits')
+report_parser.add_argument('db', help='SQLite database file')
+report_parser.add_argument('--base', help='base commit (prefix), by default the second newest one')
+report_parser.add_argument('--head', help='head commit (prefix), by default the newest one')
+report_parser.add_argument('--host', help='host name, by default this host')
+report_parser.add_argument('--confidence', type=float, default=0.95, help='confidence level of the intervals')
+report_parser.add_argument('--threshold', type=float, default=0.02, help='smallest relative change considered significant')
+report_parser.add_argument('--changes_only', action='store_true', help='only print routines with significant changes')
+report_parser.add_argument('--fail_on_regression', action='store_true', help='exit with status 1 if anything got slower')
+report_parser.add_argument('--output', help='output Markdown file, by default stdout')
+
+args = parser.parse_args()
+db = open_db(args.db)
+
+if args.command == 'ingest':
+    if args.commit:
+        sha = git('rev-parse', args.commit)
+        commit = sha, int(git('show', '-s', '--format=%ct', sha)), False
+    else:
+        commit = current_commit()
+
+    cpu = cpu_info()
+    for file_name in args.data_files:
+        print(f'{file_name}: {ingest(db, file_name, commit, cpu)} samples')
+
+    db.commit()
+elif args.command == 'list':
+    list_runs(db)
+else:
+    sys.exit(report(db, args))
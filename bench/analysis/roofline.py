@@ -0,0 +1,77 @@
+import matplotlib
+matplotlib.use("Agg")
+import matplotlib.pyplot as plt
+import argparse
+import json
+import numpy as np
+
+
+def filter_aggregate(benchmarks, name):
+    result = []
+    for b in benchmarks:
+        try:
+            if b['aggregate_name'] == name:
+                result.append(b)
+        except KeyError:
+            continue
+    return result
+
+
+def load_results(file_name):
+    with open(file_name) as f:
+        results = json.load(f)
+
+    benchmarks = filter_aggregate(results['benchmarks'], 'median')
+    if not benchmarks:
+        # No repetitions
+        benchmarks = results['benchmarks']
+
+    # Only benchmarks with a memory traffic model have the arithmetic intensity counter
+    return results['context'], [b for b in benchmarks if 'ai' in b and 'flops' in b]
+
+
+parser = argparse.ArgumentParser(description='Roofline plot of benchmark results')
+parser.add_argument('data_files', nargs='+', help='JSON files written by bench-* with --benchmark_out')
+parser.add_argument('--precision', choices=['double', 'float'], default='double', help='precision of the peak performance')
+parser.add_argument('--output', default='bench_result/image/roofline.png', help='output image file')
+args = parser.parse_args()
+
+factor = 1e+9 # Giga
+
+fig = plt.figure(figsize=[10, 6])
+ax = fig.subplots()
+
+peak = None
+bandwidth = None
+
+for file_name in args.data_files:
+    print(f"Processing {file_name}")
+    context, benchmarks = load_results(file_name)
+
+    # The peaks are calibrated by every benchmark run; use the first ones found
+    if peak is None and f'peak_flops_{args.precision}' in context:
+        peak = float(context[f'peak_flops_{args.precision}'])
+        bandwidth = float(context['peak_bandwidth'])
+
+    ax.plot(
+        [b['ai'] for b in benchmarks],
+        [b['flops'] / factor for b in benchmarks],
+        'o',
+        label = file_name,
+        markersize = 4
+    )
+
+if peak is not None:
+    ai = np.logspace(-2, 3, 200)
+    ax.plot(ai, np.minimum(peak, ai * bandwidth) / factor, 'k-', linewidth = 1, label = 'roofline')
+    ax.axvline(peak / bandwidth, color = 'k', linestyle = ':', linewidth = 1)
+
+ax.set_xscale('log')
+ax.set_yscale('log')
+ax.grid(True, which = 'both')
+ax.legend()
+ax.set_xlabel('arithmetic intensity [flops/byte]')
+ax.set_ylabel('performance [Gflops]')
+ax.set_title(f'roofline ({args.precision})')
+
+fig.savefig(args.output)
@@ -8,6 +8,8 @@
 
 #include <blaze/Math.h>
 
+#include <bench/CacheMode.hpp>
+
 
 namespace blast :: benchmark
 {
@@ -21,6 +23,7 @@ namespace blast :: benchmark
         blaze::DynamicMatrix<Real, blaze::columnMajor> B(N, N);
         for (auto _ : state)
         {
+            prepareCache(state, A, B);
             B = A;
             potrf(B, 'L');
         }
@@ -36,7 +39,10 @@ namespace blast :: benchmark
 
         blaze::DynamicMatrix<Real, blaze::columnMajor> B(N, N);
         for (auto _ : state)
+        {
+            prepareCache(state, A, B);
             blaze::llh(A, B);
+        }
     }
 
 
@@ -49,7 +55,10 @@ namespace blast :: benchmark
 
         blaze::DynamicMatrix<Real, blaze::columnMajor> B(N, N);
         for (auto _ : state)
+        {
+            prepareCache(state, A, B);
             blaze::llh(A, B);
+        }
     }
 
 
@@ -62,7 +71,10 @@ namespace blast :: benchmark
 
         blaze::LowerMatrix<blaze::DynamicMatrix<Real, blaze::columnMajor>> B(N);
         for (auto _ : state)
+        {
+            prepareCache(state, A, B);
             blaze::llh(A, B);
+        }
     }
 
 
@@ -75,7 +87,10 @@ namespace blast :: benchmark
 
         blaze::DynamicMatrix<Real, blaze::columnMajor> B(N, N);
         for (auto _ : state)
+        {
+            prepareCache(state, A, B);
             blaze::llh(declsym(A), B);
+        }
     }
 
 
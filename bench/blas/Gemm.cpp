@@ -3,6 +3,7 @@
 // license that can be found in the LICENSE file.
 
 #include <bench/Gemm.hpp>
+#include <bench/CacheMode.hpp>
 
 #include <blast/math/algorithm/Randomize.hpp>
 
@@ -33,9 +34,12 @@ namespace blast :: benchmark
         randomize(beta);
 
         for (auto _ : state)
+        {
+            prepareCache(state, A, B, C);
             gemm(C, trans(A), B, alpha, beta);
+        }
 
-        setCounters(state.counters, complexityGemm(m, m, m));
+        setCounters<Real>(state.counters, complexityGemm(m, m, m));
         state.counters["m"] = m;
     }
 
@@ -5,6 +5,7 @@
 #include <bench/Complexity.hpp>
 #include <bench/Benchmark.hpp>
 #include <bench/Getrf.hpp>
+#include <bench/CacheMode.hpp>
 
 #include <blaze/Math.h>
 
@@ -32,9 +33,12 @@ namespace blast :: benchmark
         blaze::DynamicMatrix<Real, blaze::columnMajor> A = blaze::IdentityMatrix<double>(m);
 
         for (auto _ : state)
+        {
+            prepareCache(state, A, ipiv);
             getrf(A, ipiv.data());
+        }
 
-        setCounters(state.counters, complexityGetrf(rows(A), columns(A)));
+        setCounters<Real>(state.counters, complexityGetrf(rows(A), columns(A)));
         state.counters["m"] = m;
     }
 
@@ -52,6 +56,7 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, A, ipiv);
             reset(A);
             for (size_t i = 0; i < m; ++i)
                 A(i, m - i - 1) = 1.;
@@ -59,7 +64,7 @@ namespace blast :: benchmark
             getrf(A, ipiv.data());
         }
 
-        setCounters(state.counters, complexityGetrf(rows(A), columns(A)));
+        setCounters<Real>(state.counters, complexityGetrf(rows(A), columns(A)));
         state.counters["m"] = m;
     }
 
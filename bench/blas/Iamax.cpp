@@ -18,6 +18,7 @@
 
 #include <bench/Benchmark.hpp>
 #include <bench/Iamax.hpp>
+#include <bench/CacheMode.hpp>
 
 #include <blast/math/algorithm/Randomize.hpp>
 
@@ -48,11 +49,12 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, x);
             size_t idx = iamax(size(x), data(x), 1);
             DoNotOptimize(idx);
         }
 
-        setCounters(state.counters, complexity(iamaxTag, N));
+        setCounters<Real>(state.counters, complexity(iamaxTag, N));
     }
 
 
@@ -0,0 +1,107 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <bench/Benchmark.hpp>
+#include <bench/Latency.hpp>
+
+#include <blast/math/algorithm/Randomize.hpp>
+
+#include <blaze/Math.h>
+
+#include <cblas.h>
+
+#include <vector>
+
+
+namespace blast :: benchmark
+{
+    template <typename Real>
+    static void LAT_gemm(LatencyState& state)
+    {
+        size_t const m = state.range(0);
+
+        blaze::DynamicMatrix<Real, blaze::columnMajor> A(m, m), B(m, m), C(m, m);
+        randomize(A);
+        randomize(B);
+        randomize(C);
+
+        state.measure([&] {
+            gemm(C, A, trans(B), Real(1.), Real(1.));
+            DoNotOptimize(C);
+        }, A, B, C);
+    }
+
+
+    /// @brief LAPACK potrf() is in-place, so the input is restored by an untimed copy.
+    template <typename Real>
+    static void LAT_potrf(LatencyState& state)
+    {
+        size_t const m = state.range(0);
+
+        blaze::DynamicMatrix<Real, blaze::columnMajor> A(m, m), L(m, m);
+        makePositiveDefinite(A);
+
+        state.measureWithSetup([&] { L = A; }, [&] {
+            int info;
+            blaze::potrf('L', m, data(L), spacing(L), &info);
+            DoNotOptimize(L);
+        }, A, L);
+    }
+
+
+    /// @brief Identity input, which getrf() does not change, see BM_getrf_best_case.
+    template <typename Real>
+    static void LAT_getrf(LatencyState& state)
+    {
+        size_t const m = state.range(0);
+
+        blaze::DynamicMatrix<Real, blaze::columnMajor> A = blaze::IdentityMatrix<Real>(m);
+        std::vector<int> ipiv(m);
+
+        state.measure([&] {
+            getrf(A, ipiv.data());
+            DoNotOptimize(A);
+        }, A, ipiv);
+    }
+
+
+    template <typename Real>
+    static void LAT_trsm(LatencyState& state)
+    {
+        size_t const m = state.range(0);
+
+        blaze::DynamicMatrix<Real, blaze::columnMajor> A(m, m), B(m, m), X(m, m);
+        makePositiveDefinite(A);
+        randomize(B);
+
+        state.measureWithSetup([&] { X = B; }, [&] {
+            trsm(A, X, CblasLeft, CblasUpper, Real(1.));
+            DoNotOptimize(X);
+        }, A, X);
+    }
+
+
+    template <typename Real>
+    static void LAT_syrk(LatencyState& state)
+    {
+        size_t const m = state.range(0);
+
+        blaze::DynamicMatrix<Real, blaze::columnMajor> A(m, m), C(m, m), D(m, m);
+        randomize(A);
+        makeSymmetric(C);
+
+        state.measureWithSetup([&] { D = C; }, [&] {
+            cblas_dsyrk(CblasColMajor, CblasLower, CblasNoTrans,
+                m, m, 1., data(A), spacing(A), 1., data(D), spacing(D));
+            DoNotOptimize(D);
+        }, A, D);
+    }
+
+
+    BLAST_LATENCY_BENCHMARK(LAT_gemm<double>)->Apply(latencyArguments);
+    BLAST_LATENCY_BENCHMARK(LAT_potrf<double>)->Apply(latencyArguments);
+    BLAST_LATENCY_BENCHMARK(LAT_getrf<double>)->Apply(latencyArguments);
+    BLAST_LATENCY_BENCHMARK(LAT_trsm<double>)->Apply(latencyArguments);
+    BLAST_LATENCY_BENCHMARK(LAT_syrk<double>)->Apply(latencyArguments);
+}
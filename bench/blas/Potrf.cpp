@@ -3,6 +3,7 @@
 // license that can be found in the LICENSE file.
 
 #include <bench/Complexity.hpp>
+#include <bench/CacheMode.hpp>
 
 #include <benchmark/benchmark.h>
 
@@ -28,13 +29,14 @@ namespace blast :: benchmark
         // Do potrf
         for (auto _ : state)
         {
+            prepareCache(state, A, L);
             L = A;
 
             int info;
             blaze::potrf('L', m, data(L), spacing(L), &info);
         }
 
-        setCounters(state.counters, complexityPotrf(m, n));
+        setCounters<T>(state.counters, complexityPotrf(m, n));
         state.counters["m"] = m;
     }
 
@@ -0,0 +1,109 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <bench/Riccati.hpp>
+
+#include <blaze/Math.h>
+
+#include <cblas.h>
+
+#include <utility>
+#include <vector>
+
+
+namespace blast :: benchmark
+{
+    /**
+     * @brief Riccati iteration with BLAS/LAPACK routines, see bench/Riccati.hpp.
+     *
+     * BLAS routines overwrite one of their operands, so every stage assembles H in place in LH_k,
+     * which costs a copy of RSQ0_k, and the trmm() and trsm() calls work on copies of their right-hand sides.
+     */
+    template <typename Real>
+    class BlasRiccati
+    {
+    public:
+        using Matrix = blaze::DynamicMatrix<Real, blaze::columnMajor>;
+
+
+        explicit BlasRiccati(RiccatiData<Real> const& data)
+        :   data_ {data}
+        ,   LH_(data.N, Matrix(data.nu + data.nx, data.nu + data.nx, Real(0.)))
+        ,   U_(data.nu + data.nx, data.nx)
+        ,   LN_(data.nx, data.nx)
+        ,   I_(blaze::IdentityMatrix<Real>(data.nu))
+        ,   W_(data.nu, data.nu)
+        ,   Kt_(data.nx, data.nu)
+        {
+        }
+
+
+        void operator()()
+        {
+            size_t const nx = data_.nx;
+            size_t const nu = data_.nu;
+            size_t const nux = nu + nx;
+            size_t const N = data_.N;
+            int info;
+
+            LN_ = data_.QN;
+            blaze::potrf('L', nx, data(LN_), spacing(LN_), &info);
+
+            for (size_t k = N; k-- > 0; )
+            {
+                Matrix& LH = LH_[k];
+
+                LH = data_.RSQ0[k];
+                blaze::gemm(LH, data_.CtD[k], trans(data_.Ct[k]), Real(1.), Real(1.));
+
+                U_ = data_.BAt[k];
+                if (k + 1 < N)
+                    blaze::trmm(U_, blaze::submatrix(std::as_const(LH_[k + 1]), nu, nu, nx, nx), CblasRight, CblasLower, Real(1.));
+                else
+                    blaze::trmm(U_, std::as_const(LN_), CblasRight, CblasLower, Real(1.));
+
+                cblasSyrkLower(nux, nx, data(U_), spacing(U_), data(LH), spacing(LH));
+                blaze::potrf('L', nux, data(LH), spacing(LH), &info);
+            }
+
+            W_ = I_;
+            blaze::trsm(blaze::submatrix(std::as_const(LH_[0]), 0, 0, nu, nu), W_, CblasLeft, CblasLower, Real(1.));
+
+            Kt_ = blaze::submatrix(LH_[0], nu, 0, nx, nu);
+            blaze::trmm(Kt_, std::as_const(W_), CblasRight, CblasLower, Real(-1.));
+        }
+
+
+    private:
+        static void cblasSyrkLower(size_t m, size_t k, double const * a, size_t lda, double * c, size_t ldc)
+        {
+            cblas_dsyrk(CblasColMajor, CblasLower, CblasNoTrans, m, k, 1., a, lda, 1., c, ldc);
+        }
+
+
+        static void cblasSyrkLower(size_t m, size_t k, float const * a, size_t lda, float * c, size_t ldc)
+        {
+            cblas_ssyrk(CblasColMajor, CblasLower, CblasNoTrans, m, k, 1.f, a, lda, 1.f, c, ldc);
+        }
+
+
+        RiccatiData<Real> const& data_;
+        std::vector<Matrix> LH_;
+        Matrix U_;
+        Matrix LN_;
+        Matrix const I_;
+        Matrix W_;
+        Matrix Kt_;
+    };
+
+
+    template <typename Real>
+    static void BM_riccati(State& state)
+    {
+        benchmarkRiccati<BlasRiccati, Real>(state);
+    }
+
+
+    BENCHMARK_TEMPLATE(BM_riccati, double)->Apply(riccatiArguments);
+}
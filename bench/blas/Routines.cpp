@@ -0,0 +1,150 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <bench/Routines.hpp>
+
+#include <blaze/Math.h>
+
+#include <cblas.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+
+namespace blast :: benchmark
+{
+    /**
+     * @brief BLAS adapter for the benchmarks in bench/Routines.hpp.
+     *
+     * Like in BM_gemm and BM_syrk, gemm() and syrk() accumulate into D in-place.
+     * trmm(), trsm(), potrf() and trmv() overwrite their right-hand side,
+     * so the timing includes a copy, like in BM_trmm.
+     */
+    struct BlasBackend
+    {
+        static bool constexpr rectangularGetrf = true;
+
+
+        template <typename Real>
+        static blaze::DynamicMatrix<Real, blaze::columnMajor> matrix(blaze::DynamicMatrix<Real, blaze::columnMajor> const& A)
+        {
+            return A;
+        }
+
+
+        template <typename Real>
+        static blaze::DynamicVector<Real> vector(blaze::DynamicVector<Real> const& x)
+        {
+            return x;
+        }
+
+
+        template <typename MT>
+        static auto gemm(size_t, size_t, size_t, MT& A, MT& B, MT&, MT& D)
+        {
+            using Real = blaze::ElementType_t<MT>;
+            return [&] { blaze::gemm(D, std::as_const(A), trans(std::as_const(B)), Real(1.), Real(1.)); };
+        }
+
+
+        template <typename MT>
+        static auto syrk(size_t m, size_t k, MT& A, MT&, MT& D)
+        {
+            return [&A, &D, m, k] { cblasSyrkLower(m, k, data(A), spacing(A), data(D), spacing(D)); };
+        }
+
+
+        template <typename MT>
+        static auto trmm(size_t, size_t, MT& A, MT& B, MT& C)
+        {
+            using Real = blaze::ElementType_t<MT>;
+
+            return [&]
+            {
+                C = B;
+                blaze::trmm(C, std::as_const(A), CblasLeft, CblasUpper, Real(1.));
+            };
+        }
+
+
+        template <typename MT>
+        static auto trsm(size_t, size_t, MT& A, MT& B, MT& X)
+        {
+            using Real = blaze::ElementType_t<MT>;
+
+            return [&]
+            {
+                X = B;
+                blaze::trsm(std::as_const(A), X, CblasLeft, CblasUpper, Real(1.));
+            };
+        }
+
+
+        template <typename MT>
+        static auto potrf(size_t m, MT& A, MT& L)
+        {
+            return [&A, &L, m]
+            {
+                L = A;
+
+                int info;
+                blaze::potrf('L', m, data(L), spacing(L), &info);
+            };
+        }
+
+
+        template <typename MT>
+        static auto getrf(size_t m, size_t n, MT& A)
+        {
+            return [&A, ipiv = std::vector<int>(std::min(m, n))] () mutable { blaze::getrf(A, ipiv.data()); };
+        }
+
+
+        template <typename MT, typename VT>
+        static auto trmv(size_t, MT& A, VT& x, VT& y)
+        {
+            return [&]
+            {
+                y = x;
+                blaze::trmv(y, std::as_const(A), CblasUpper);
+            };
+        }
+
+
+        template <typename VT>
+        static auto iamax(size_t n, VT& x)
+        {
+            return [&x, n] { return cblasIamax(n, data(x)); };
+        }
+
+
+    private:
+        static void cblasSyrkLower(size_t m, size_t k, double const * a, size_t lda, double * c, size_t ldc)
+        {
+            cblas_dsyrk(CblasColMajor, CblasLower, CblasNoTrans, m, k, 1., a, lda, 1., c, ldc);
+        }
+
+
+        static void cblasSyrkLower(size_t m, size_t k, float const * a, size_t lda, float * c, size_t ldc)
+        {
+            cblas_ssyrk(CblasColMajor, CblasLower, CblasNoTrans, m, k, 1.f, a, lda, 1.f, c, ldc);
+        }
+
+
+        static size_t cblasIamax(size_t n, double const * x)
+        {
+            return cblas_idamax(n, x, 1);
+        }
+
+
+        static size_t cblasIamax(size_t n, float const * x)
+        {
+            return cblas_isamax(n, x, 1);
+        }
+    };
+
+
+    BLAST_ROUTINE_BENCHMARKS(BlasBackend, double);
+}
@@ -6,6 +6,7 @@
 
 #include <bench/Benchmark.hpp>
 #include <bench/Syrk.hpp>
+#include <bench/CacheMode.hpp>
 
 #include <blaze/Math.h>
 
@@ -24,10 +25,13 @@ namespace blast :: benchmark
         B = 0.;
 
         for (auto _ : state)
+        {
+            prepareCache(state, A, B);
             cblas_dsyrk(CblasColMajor, CblasLower, CblasNoTrans,
                 M, K, 1., data(A), spacing(A), 1., data(B), spacing(B));
+        }
 
-        setCounters(state.counters, complexitySyrk(M, K));
+        setCounters<Real>(state.counters, complexitySyrk(M, K));
         state.counters["m"] = M;
     }
 
@@ -8,6 +8,8 @@
 
 #include <blaze/Math.h>
 
+#include <bench/CacheMode.hpp>
+
 
 namespace tmpc :: benchmark
 {
@@ -23,6 +25,7 @@ namespace tmpc :: benchmark
 
         for (auto _ : state)
         {
+            blast::benchmark::prepareCache(state, A, C, D);
             D = C;
             cblas_dsyrk(CblasColMajor, CblasLower, CblasTrans,
                 N, M, 1., data(A), spacing(A), 1., data(D), spacing(D));
@@ -44,6 +47,7 @@ namespace tmpc :: benchmark
 
         for (auto _ : state)
         {
+            blast::benchmark::prepareCache(state, A, C, D1, D);
             D1 = declsym(C) + declsym(trans(A) * A);
             blaze::llh(D1, D);
         }
@@ -3,6 +3,7 @@
 // license that can be found in the LICENSE file.
 
 #include <bench/Benchmark.hpp>
+#include <bench/CacheMode.hpp>
 
 #include <blaze/Math.h>
 
@@ -23,6 +24,7 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, A, B, C);
             C = B;
             trmm(C, trans(std::as_const(A)), CblasLeft, CblasUpper, 1.);
         }
@@ -8,6 +8,8 @@
 
 #include <blaze/Math.h>
 
+#include <bench/CacheMode.hpp>
+
 
 namespace blast :: benchmark
 {
@@ -24,6 +26,7 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, A, B, C);
             C = B;
             trmv(C, trans(std::as_const(A)), CblasUpper);
         }
@@ -6,6 +6,8 @@
 
 #include <blaze/Math.h>
 
+#include <bench/CacheMode.hpp>
+
 
 namespace blast :: benchmark
 {
@@ -22,6 +24,7 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, A, B, C);
             C = B;
             trsv(A, C, 'L', 'N', 'N');
         }
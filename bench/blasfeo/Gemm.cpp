@@ -5,6 +5,7 @@
 #include <blasfeo/Blasfeo.hpp>
 
 #include <bench/Gemm.hpp>
+#include <bench/CacheMode.hpp>
 
 #include <random>
 
@@ -50,9 +51,12 @@ namespace blast :: benchmark
         //     blasfeo_dmat& sD, size_t di, size_t dj);
 
         for (auto _ : state)
+        {
+            prepareCache(state, A, B, C);
             gemm_nt(m, n, k, 1., A, 0, 0, B, 0, 0, 1., C, 0, 0, C, 0, 0);
+        }
 
-        setCounters(state.counters, complexityGemm(m, n, k));
+        setCounters<Real>(state.counters, complexityGemm(m, n, k));
         state.counters["m"] = m;
     }
 
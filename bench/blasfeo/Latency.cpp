@@ -0,0 +1,113 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <blasfeo/Blasfeo.hpp>
+
+#include <bench/Benchmark.hpp>
+#include <bench/Latency.hpp>
+
+#include <blast/math/algorithm/Randomize.hpp>
+
+#include <blaze/Math.h>
+
+#include <vector>
+
+
+namespace blast :: benchmark
+{
+    template <typename Real>
+    static void LAT_gemm(LatencyState& state)
+    {
+        size_t const m = state.range(0);
+
+        blaze::DynamicMatrix<Real, blaze::columnMajor> blaze_A(m, m), blaze_B(m, m), blaze_C(m, m);
+        randomize(blaze_A);
+        randomize(blaze_B);
+        randomize(blaze_C);
+
+        blasfeo::DynamicMatrix<Real> A(blaze_A), B(blaze_B), C(blaze_C), D(m, m);
+
+        state.measure([&] {
+            gemm_nt(m, m, m, Real(1.), A, 0, 0, B, 0, 0, Real(1.), C, 0, 0, D, 0, 0);
+            DoNotOptimize(D);
+        }, A, B, C, D);
+    }
+
+
+    template <typename Real>
+    static void LAT_potrf(LatencyState& state)
+    {
+        size_t const m = state.range(0);
+
+        blaze::DynamicMatrix<Real, blaze::columnMajor> blaze_A(m, m);
+        makePositiveDefinite(blaze_A);
+
+        blasfeo::DynamicMatrix<Real> A(blaze_A), L(m, m);
+
+        state.measure([&] {
+            potrf(m, A, 0, 0, L, 0, 0);
+            DoNotOptimize(L);
+        }, A, L);
+    }
+
+
+    /// @brief Identity input, which getrf() does not change, see BM_getrf_best_case.
+    template <typename Real>
+    static void LAT_getrf(LatencyState& state)
+    {
+        size_t const m = state.range(0);
+
+        blaze::DynamicMatrix<Real, blaze::columnMajor> blaze_A = blaze::IdentityMatrix<Real>(m);
+        blasfeo::DynamicMatrix<Real> A(blaze_A);
+        std::vector<int> ipiv(m);
+
+        state.measure([&] {
+            getrf_rp(m, m, A, 0, 0, A, 0, 0, ipiv.data());
+            DoNotOptimize(A);
+        }, A, ipiv);
+    }
+
+
+    template <typename Real>
+    static void LAT_trsm(LatencyState& state)
+    {
+        size_t const m = state.range(0);
+
+        blaze::DynamicMatrix<Real, blaze::columnMajor> blaze_A(m, m), blaze_B(m, m);
+        makePositiveDefinite(blaze_A);
+        randomize(blaze_B);
+
+        blasfeo::DynamicMatrix<Real> A(blaze_A), B(blaze_B), X(m, m);
+
+        state.measure([&] {
+            trsm_lunn(m, m, Real(1.), A, 0, 0, B, 0, 0, X, 0, 0);
+            DoNotOptimize(X);
+        }, A, B, X);
+    }
+
+
+    template <typename Real>
+    static void LAT_syrk(LatencyState& state)
+    {
+        size_t const m = state.range(0);
+
+        blaze::DynamicMatrix<Real, blaze::columnMajor> blaze_A(m, m), blaze_C(m, m);
+        randomize(blaze_A);
+        makeSymmetric(blaze_C);
+
+        blasfeo::DynamicMatrix<Real> A(blaze_A), C(blaze_C), D(m, m);
+
+        state.measure([&] {
+            syrk_ln(m, m, Real(1.), A, 0, 0, A, 0, 0, Real(1.), C, 0, 0, D, 0, 0);
+            DoNotOptimize(D);
+        }, A, C, D);
+    }
+
+
+    BLAST_LATENCY_BENCHMARK(LAT_gemm<double>)->Apply(latencyArguments);
+    BLAST_LATENCY_BENCHMARK(LAT_potrf<double>)->Apply(latencyArguments);
+    BLAST_LATENCY_BENCHMARK(LAT_getrf<double>)->Apply(latencyArguments);
+    BLAST_LATENCY_BENCHMARK(LAT_trsm<double>)->Apply(latencyArguments);
+    BLAST_LATENCY_BENCHMARK(LAT_syrk<double>)->Apply(latencyArguments);
+}
@@ -8,6 +8,8 @@
 
 #include <blaze/Math.h>
 
+#include <bench/CacheMode.hpp>
+
 
 namespace blast :: benchmark
 {
@@ -31,7 +33,10 @@ namespace blast :: benchmark
 
         // Do potrf with BLASFEO
         for (auto _ : state)
+        {
+            prepareCache(state, blasfeo_A, blasfeo_L);
             potrf(m, blasfeo_A, 0, 0, blasfeo_L, 0, 0);
+        }
 
         // Calculated as \sum _{k=0}^{n-1} \sum _{j=0}^{k-1} \sum _{i=k}^{m-1} 2
         state.counters["flops"] = Counter((1 + 3 * m - 2 * n) * (n - 1) * n / 3, Counter::kIsIterationInvariantRate);
@@ -0,0 +1,106 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <blasfeo/Blasfeo.hpp>
+
+#include <bench/Riccati.hpp>
+
+#include <blaze/Math.h>
+
+#include <deque>
+
+
+namespace blast :: benchmark
+{
+    /**
+     * @brief Riccati iteration with BLASFEO routines on panel-major matrices, see bench/Riccati.hpp.
+     *
+     * The calls are the same as in the other libraries; the fused syrk_potrf_ln() would save a pass over H.
+     */
+    template <typename Real>
+    class BlasfeoRiccati
+    {
+    public:
+        using Matrix = blasfeo::DynamicMatrix<Real>;
+
+
+        explicit BlasfeoRiccati(RiccatiData<Real> const& data)
+        :   nx_ {data.nx}
+        ,   nu_ {data.nu}
+        ,   nc_ {data.nc}
+        ,   QN_(data.QN)
+        ,   RSQ_(nu_ + nx_, nu_ + nx_)
+        ,   H_(nu_ + nx_, nu_ + nx_)
+        ,   U_(nu_ + nx_, nx_)
+        ,   LN_(nx_, nx_)
+        ,   I_(blaze::DynamicMatrix<Real, blaze::columnMajor>(blaze::IdentityMatrix<Real>(nu_)))
+        ,   W_(nu_, nu_)
+        ,   Kt_(nx_, nu_)
+        {
+            // BLASFEO matrices must not be copied, and std::deque does not move its elements
+            for (size_t k = 0; k < data.N; ++k)
+            {
+                BAt_.emplace_back(data.BAt[k]);
+                RSQ0_.emplace_back(data.RSQ0[k]);
+                Ct_.emplace_back(data.Ct[k]);
+                CtD_.emplace_back(data.CtD[k]);
+                LH_.emplace_back(nu_ + nx_, nu_ + nx_);
+            }
+        }
+
+
+        void operator()()
+        {
+            size_t const nux = nu_ + nx_;
+            size_t const N = LH_.size();
+
+            blasfeo::potrf(nx_, QN_, 0, 0, LN_, 0, 0);
+
+            for (size_t k = N; k-- > 0; )
+            {
+                gemm_nt(nux, nux, nc_, Real(1.), CtD_[k], 0, 0, Ct_[k], 0, 0, Real(1.), RSQ0_[k], 0, 0, RSQ_, 0, 0);
+
+                if (k + 1 < N)
+                    trmm_rlnn(nux, nx_, Real(1.), LH_[k + 1], nu_, nu_, BAt_[k], 0, 0, U_, 0, 0);
+                else
+                    trmm_rlnn(nux, nx_, Real(1.), LN_, 0, 0, BAt_[k], 0, 0, U_, 0, 0);
+
+                syrk_ln(nux, nx_, Real(1.), U_, 0, 0, U_, 0, 0, Real(1.), RSQ_, 0, 0, H_, 0, 0);
+                blasfeo::potrf(nux, H_, 0, 0, LH_[k], 0, 0);
+            }
+
+            trsm_llnn(nu_, nu_, Real(1.), LH_[0], 0, 0, I_, 0, 0, W_, 0, 0);
+            trmm_rlnn(nx_, nu_, Real(-1.), W_, 0, 0, LH_[0], nu_, 0, Kt_, 0, 0);
+        }
+
+
+    private:
+        size_t const nx_;
+        size_t const nu_;
+        size_t const nc_;
+        std::deque<Matrix> BAt_;
+        std::deque<Matrix> RSQ0_;
+        std::deque<Matrix> Ct_;
+        std::deque<Matrix> CtD_;
+        std::deque<Matrix> LH_;
+        Matrix QN_;
+        Matrix RSQ_;
+        Matrix H_;
+        Matrix U_;
+        Matrix LN_;
+        Matrix I_;
+        Matrix W_;
+        Matrix Kt_;
+    };
+
+
+    template <typename Real>
+    static void BM_riccati(State& state)
+    {
+        benchmarkRiccati<BlasfeoRiccati, Real>(state);
+    }
+
+
+    BENCHMARK_TEMPLATE(BM_riccati, double)->Apply(riccatiArguments);
+}
@@ -0,0 +1,81 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <blasfeo/Blasfeo.hpp>
+
+#include <bench/Routines.hpp>
+
+#include <blaze/Math.h>
+
+#include <algorithm>
+#include <vector>
+
+
+namespace blast :: benchmark
+{
+    /// @brief BLASFEO adapter for the benchmarks in bench/Routines.hpp. Only the level-3 routines are covered.
+    struct BlasfeoBackend
+    {
+        static bool constexpr rectangularGetrf = true;
+
+
+        template <typename Real>
+        static blasfeo::DynamicMatrix<Real> matrix(blaze::DynamicMatrix<Real, blaze::columnMajor> const& A)
+        {
+            return blasfeo::DynamicMatrix<Real>(A);
+        }
+
+
+        template <typename Real>
+        static auto gemm(size_t m, size_t n, size_t k, blasfeo::DynamicMatrix<Real>& A, blasfeo::DynamicMatrix<Real>& B,
+            blasfeo::DynamicMatrix<Real>& C, blasfeo::DynamicMatrix<Real>& D)
+        {
+            return [&, m, n, k] { gemm_nt(m, n, k, Real(1.), A, 0, 0, B, 0, 0, Real(1.), C, 0, 0, D, 0, 0); };
+        }
+
+
+        template <typename Real>
+        static auto syrk(size_t m, size_t k, blasfeo::DynamicMatrix<Real>& A,
+            blasfeo::DynamicMatrix<Real>& C, blasfeo::DynamicMatrix<Real>& D)
+        {
+            return [&, m, k] { syrk_ln(m, k, Real(1.), A, 0, 0, A, 0, 0, Real(1.), C, 0, 0, D, 0, 0); };
+        }
+
+
+        template <typename Real>
+        static auto trmm(size_t m, size_t n, blasfeo::DynamicMatrix<Real>& A,
+            blasfeo::DynamicMatrix<Real>& B, blasfeo::DynamicMatrix<Real>& C)
+        {
+            return [&, m, n] { trmm_lunn(m, n, Real(1.), A, 0, 0, B, 0, 0, C, 0, 0); };
+        }
+
+
+        template <typename Real>
+        static auto trsm(size_t m, size_t n, blasfeo::DynamicMatrix<Real>& A,
+            blasfeo::DynamicMatrix<Real>& B, blasfeo::DynamicMatrix<Real>& X)
+        {
+            return [&, m, n] { trsm_lunn(m, n, Real(1.), A, 0, 0, B, 0, 0, X, 0, 0); };
+        }
+
+
+        template <typename Real>
+        static auto potrf(size_t m, blasfeo::DynamicMatrix<Real>& A, blasfeo::DynamicMatrix<Real>& L)
+        {
+            return [&, m] { blasfeo::potrf(m, A, 0, 0, L, 0, 0); };
+        }
+
+
+        template <typename Real>
+        static auto getrf(size_t m, size_t n, blasfeo::DynamicMatrix<Real>& A)
+        {
+            return [&A, m, n, ipiv = std::vector<int>(std::min(m, n))] () mutable
+            {
+                getrf_rp(m, n, A, 0, 0, A, 0, 0, ipiv.data());
+            };
+        }
+    };
+
+
+    BLAST_ROUTINE_BENCHMARKS(BlasfeoBackend, double);
+}
@@ -6,6 +6,7 @@
 
 #include <bench/Benchmark.hpp>
 #include <bench/Syrk.hpp>
+#include <bench/CacheMode.hpp>
 
 
 namespace blast :: benchmark
@@ -28,9 +29,12 @@ namespace blast :: benchmark
 
         // Do syrk-potrf with BLASFEO
         for (auto _ : state)
+        {
+            prepareCache(state, A, C, D);
             syrk_ln(m, k, 1., A, 0, 0, A, 0, 0, 1., C, 0, 0, D, 0, 0);
+        }
 
-        setCounters(state.counters, complexitySyrk(m, k));
+        setCounters<Real>(state.counters, complexitySyrk(m, k));
         state.counters["m"] = m;
     }
 
@@ -8,6 +8,8 @@
 
 #include <benchmark/benchmark.h>
 
+#include <bench/CacheMode.hpp>
+
 
 namespace blast :: benchmark
 {
@@ -27,7 +29,10 @@ namespace blast :: benchmark
 
         // Do syrk-potrf with BLASFEO
         for (auto _ : state)
+        {
+            prepareCache(state, blasfeo_A, blasfeo_C, blasfeo_D);
             syrk_potrf(m, k, blasfeo_A, 0, 0, blasfeo_A, 0, 0, blasfeo_C, 0, 0, blasfeo_D, 0, 0);
+        }
     }
 
 
@@ -5,6 +5,7 @@
 #include <blasfeo/Blasfeo.hpp>
 
 #include <bench/Benchmark.hpp>
+#include <bench/CacheMode.hpp>
 
 #include <random>
 #include <memory>
@@ -39,7 +40,10 @@ namespace blast :: benchmark
         randomize(B);
 
         for (auto _ : state)
+        {
+            prepareCache(state, A, B, C);
             trmm_rutn(m, n, 1., A, 0, 0, B, 0, 0, C, 0, 0);
+        }
     }
 
 
@@ -0,0 +1,83 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <blast/math/dense/DynamicMatrix.hpp>
+#include <blast/math/dense/StaticMatrix.hpp>
+#include <blast/math/Uninitialized.hpp>
+
+#include <bench/Benchmark.hpp>
+
+
+namespace blast :: benchmark
+{
+    template <typename Real, bool SO>
+    static void BM_DynamicMatrix_construct(State& state)
+    {
+        size_t const M = state.range(0);
+        size_t const N = M;
+
+        for (auto _ : state)
+        {
+            DynamicMatrix<Real, SO> A(M, N);
+            DoNotOptimize(A.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * M * N * sizeof(Real));
+        state.counters["m"] = M;
+    }
+
+
+    template <typename Real, bool SO>
+    static void BM_DynamicMatrix_construct_uninitialized(State& state)
+    {
+        size_t const M = state.range(0);
+        size_t const N = M;
+
+        for (auto _ : state)
+        {
+            DynamicMatrix<Real, SO> A(uninitialized, M, N);
+            DoNotOptimize(A.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * M * N * sizeof(Real));
+        state.counters["m"] = M;
+    }
+
+
+    template <typename Real, size_t M, bool SO>
+    static void BM_StaticMatrix_construct(State& state)
+    {
+        for (auto _ : state)
+        {
+            StaticMatrix<Real, M, M, SO> A;
+            DoNotOptimize(A.data());
+        }
+
+        state.counters["m"] = M;
+    }
+
+
+    template <typename Real, size_t M, bool SO>
+    static void BM_StaticMatrix_construct_uninitialized(State& state)
+    {
+        for (auto _ : state)
+        {
+            StaticMatrix<Real, M, M, SO> A(uninitialized);
+            DoNotOptimize(A.data());
+        }
+
+        state.counters["m"] = M;
+    }
+
+
+    BENCHMARK_TEMPLATE(BM_DynamicMatrix_construct, double, columnMajor)->RangeMultiplier(2)->Range(1, 2048);
+    BENCHMARK_TEMPLATE(BM_DynamicMatrix_construct_uninitialized, double, columnMajor)->RangeMultiplier(2)->Range(1, 2048);
+
+    BENCHMARK_TEMPLATE(BM_StaticMatrix_construct, double, 5, columnMajor);
+    BENCHMARK_TEMPLATE(BM_StaticMatrix_construct_uninitialized, double, 5, columnMajor);
+    BENCHMARK_TEMPLATE(BM_StaticMatrix_construct, double, 15, columnMajor);
+    BENCHMARK_TEMPLATE(BM_StaticMatrix_construct_uninitialized, double, 15, columnMajor);
+    BENCHMARK_TEMPLATE(BM_StaticMatrix_construct, double, 30, columnMajor);
+    BENCHMARK_TEMPLATE(BM_StaticMatrix_construct_uninitialized, double, 30, columnMajor);
+}
@@ -7,6 +7,7 @@
 #include <blast/blaze/Math.hpp>
 
 #include <bench/Gemm.hpp>
+#include <bench/CacheMode.hpp>
 
 #include <blast/math/algorithm/Randomize.hpp>
 
@@ -34,6 +35,7 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, A, B, C, D);
             gemm(alpha, A, trans(B), beta, C, D);
             DoNotOptimize(A);
             DoNotOptimize(B);
@@ -41,10 +43,228 @@ namespace blast :: benchmark
             DoNotOptimize(D);
         }
 
-        setCounters(state.counters, complexityGemm(M, N, K));
+        setCounters<Real>(state.counters, complexityGemm(M, N, K));
         state.counters["m"] = M;
     }
 
 
+    template <typename Real, size_t PFD>
+    static void BM_gemm_dynamic_plain_prefetch(State& state)
+    {
+        size_t const M = state.range(0);
+        size_t const N = M;
+        size_t const K = state.range(1);
+
+        DynamicMatrix<Real, columnMajor> A(M, K);
+        DynamicMatrix<Real, columnMajor> B(K, N);
+        DynamicMatrix<Real, columnMajor> C(M, N);
+        DynamicMatrix<Real, columnMajor> D(M, N);
+        Real alpha, beta;
+
+        randomize(A);
+        randomize(B);
+        randomize(C);
+        randomize(alpha);
+        randomize(beta);
+
+        for (auto _ : state)
+        {
+            prepareCache(state, A, B, C, D);
+            gemm<PFD>(alpha, A, B, beta, C, D);
+            DoNotOptimize(A);
+            DoNotOptimize(B);
+            DoNotOptimize(C);
+            DoNotOptimize(D);
+        }
+
+        setCounters<Real>(state.counters, complexityGemm(M, N, K));
+        state.counters["m"] = M;
+        state.counters["k"] = K;
+        state.counters["pfd"] = PFD == DEFAULT_PREFETCH_DISTANCE ? PrefetchDistance_v<Real> : PFD;
+    }
+
+
+    template <typename Real, Packing P>
+    static void BM_gemm_dynamic_plain_packing(State& state)
+    {
+        size_t const M = state.range(0);
+        size_t const N = M;
+        size_t const K = M;
+
+        DynamicMatrix<Real, columnMajor> A(M, K);
+        DynamicMatrix<Real, columnMajor> B(K, N);
+        DynamicMatrix<Real, columnMajor> C(M, N);
+        DynamicMatrix<Real, columnMajor> D(M, N);
+        Real alpha, beta;
+
+        randomize(A);
+        randomize(B);
+        randomize(C);
+        randomize(alpha);
+        randomize(beta);
+
+        for (auto _ : state)
+        {
+            prepareCache(state, A, B, C, D);
+            gemm<P>(alpha, A, B, beta, C, D);
+            DoNotOptimize(A);
+            DoNotOptimize(B);
+            DoNotOptimize(C);
+            DoNotOptimize(D);
+        }
+
+        setCounters<Real>(state.counters, complexityGemm(M, N, K));
+        state.counters["m"] = M;
+    }
+
+
+    template <typename Real, bool TA, bool TB>
+    static void BM_gemm_dynamic_plain_trans(State& state)
+    {
+        size_t const M = state.range(0);
+        size_t const N = M;
+        size_t const K = M;
+
+        // A is stored as K x M if TA, B is stored as N x K if TB
+        DynamicMatrix<Real, columnMajor> A(TA ? K : M, TA ? M : K);
+        DynamicMatrix<Real, columnMajor> B(TB ? N : K, TB ? K : N);
+        DynamicMatrix<Real, columnMajor> C(M, N);
+        DynamicMatrix<Real, columnMajor> D(M, N);
+        Real alpha, beta;
+
+        randomize(A);
+        randomize(B);
+        randomize(C);
+        randomize(alpha);
+        randomize(beta);
+
+        for (auto _ : state)
+        {
+            prepareCache(state, A, B, C, D);
+            if constexpr (TA && TB)
+                gemm(alpha, trans(A), trans(B), beta, C, D);
+            else if constexpr (TA)
+                gemm(alpha, trans(A), B, beta, C, D);
+            else if constexpr (TB)
+                gemm(alpha, A, trans(B), beta, C, D);
+            else
+                gemm(alpha, A, B, beta, C, D);
+
+            DoNotOptimize(A);
+            DoNotOptimize(B);
+            DoNotOptimize(C);
+            DoNotOptimize(D);
+        }
+
+        setCounters<Real>(state.counters, complexityGemm(M, N, K));
+        state.counters["m"] = M;
+    }
+
+
+    template <typename Real, Packing P>
+    static void BM_gemm_dynamic_plain_trans_packing(State& state)
+    {
+        size_t const M = state.range(0);
+        size_t const N = M;
+        size_t const K = M;
+
+        // trans(A) is a row-major M x K matrix
+        DynamicMatrix<Real, columnMajor> A(K, M);
+        DynamicMatrix<Real, columnMajor> B(K, N);
+        DynamicMatrix<Real, columnMajor> C(M, N);
+        DynamicMatrix<Real, columnMajor> D(M, N);
+        Real alpha, beta;
+
+        randomize(A);
+        randomize(B);
+        randomize(C);
+        randomize(alpha);
+        randomize(beta);
+
+        for (auto _ : state)
+        {
+            prepareCache(state, A, B, C, D);
+            gemm<P>(alpha, trans(A), B, beta, C, D);
+            DoNotOptimize(A);
+            DoNotOptimize(B);
+            DoNotOptimize(C);
+            DoNotOptimize(D);
+        }
+
+        setCounters<Real>(state.counters, complexityGemm(M, N, K));
+        state.counters["m"] = M;
+    }
+
+
+    template <typename Real, SpacingPolicy SP>
+    static void BM_gemm_dynamic_plain_spacing(State& state)
+    {
+        size_t const M = state.range(0);
+        size_t const N = M;
+        size_t const K = M;
+
+        DynamicMatrix<Real, columnMajor> A(M, K, SP);
+        DynamicMatrix<Real, columnMajor> B(K, N, SP);
+        DynamicMatrix<Real, columnMajor> C(M, N, SP);
+        DynamicMatrix<Real, columnMajor> D(M, N, SP);
+        Real alpha, beta;
+
+        randomize(A);
+        randomize(B);
+        randomize(C);
+        randomize(alpha);
+        randomize(beta);
+
+        for (auto _ : state)
+        {
+            prepareCache(state, A, B, C, D);
+            gemm(alpha, A, B, beta, C, D);
+            DoNotOptimize(A);
+            DoNotOptimize(B);
+            DoNotOptimize(C);
+            DoNotOptimize(D);
+        }
+
+        setCounters<Real>(state.counters, complexityGemm(M, N, K));
+        state.counters["m"] = M;
+        state.counters["spacing"] = spacing(A);
+    }
+
+
+    static void gemmPrefetchBenchArguments(internal::Benchmark * b)
+    {
+        for (int k = 50; k <= 500; k += 50)
+            b->Args({16, k});
+    }
+
+
     BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain, double)->DenseRange(1, BENCHMARK_MAX_GEMM);
+
+    // Effect of software prefetching for long K. PFD = 0 is the baseline without prefetching.
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_prefetch, double, 0)->Apply(gemmPrefetchBenchArguments);
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_prefetch, double, 4)->Apply(gemmPrefetchBenchArguments);
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_prefetch, double, 8)->Apply(gemmPrefetchBenchArguments);
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_prefetch, double, 16)->Apply(gemmPrefetchBenchArguments);
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_prefetch, double, 32)->Apply(gemmPrefetchBenchArguments);
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_prefetch, double, DEFAULT_PREFETCH_DISTANCE)->Apply(gemmPrefetchBenchArguments);
+
+    // Effect of packing of the operands into panel format
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_packing, double, Packing::none)->DenseRange(1, BENCHMARK_MAX_GEMM);
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_packing, double, Packing::b)->DenseRange(1, BENCHMARK_MAX_GEMM);
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_packing, double, Packing::ab)->DenseRange(1, BENCHMARK_MAX_GEMM);
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_packing, double, Packing::automatic)->DenseRange(1, BENCHMARK_MAX_GEMM);
+
+    // All four transpose combinations of A and B
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_trans, double, false, false)->DenseRange(1, BENCHMARK_MAX_GEMM);
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_trans, double, false, true)->DenseRange(1, BENCHMARK_MAX_GEMM);
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_trans, double, true, false)->DenseRange(1, BENCHMARK_MAX_GEMM);
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_trans, double, true, true)->DenseRange(1, BENCHMARK_MAX_GEMM);
+
+    // Row-major A transposed by the kernels (none) or packed (a), compare with BM_gemm_dynamic_plain_trans<double, false, false>
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_trans_packing, double, Packing::none)->DenseRange(1, BENCHMARK_MAX_GEMM);
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_trans_packing, double, Packing::a)->DenseRange(1, BENCHMARK_MAX_GEMM);
+
+    // Effect of the spacing policy on power-of-two sizes
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_spacing, double, SpacingPolicy::none)->RangeMultiplier(2)->Range(16, 1024);
+    BENCHMARK_TEMPLATE(BM_gemm_dynamic_plain_spacing, double, SpacingPolicy::avoidAliasing)->RangeMultiplier(2)->Range(16, 1024);
 }
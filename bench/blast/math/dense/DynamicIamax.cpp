@@ -8,6 +8,7 @@
 #include <bench/Benchmark.hpp>
 #include <bench/Iamax.hpp>
 #include <bench/Complexity.hpp>
+#include <bench/CacheMode.hpp>
 
 
 namespace blast :: benchmark
@@ -23,12 +24,13 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, x);
             x[0] = 0.;
             idx = iamax(x);
             DoNotOptimize(idx);
         }
 
-        setCounters(state.counters, complexity(iamaxTag, N));
+        setCounters<Real>(state.counters, complexity(iamaxTag, N));
     }
 
 
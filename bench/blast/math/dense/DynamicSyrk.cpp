@@ -8,6 +8,7 @@
 
 #include <bench/Benchmark.hpp>
 #include <bench/Syrk.hpp>
+#include <bench/CacheMode.hpp>
 
 #include <blast/math/algorithm/Randomize.hpp>
 
@@ -29,13 +30,14 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, A, C, D);
             syrkLower(1., A, 1., C, D);
             DoNotOptimize(A);
             DoNotOptimize(C);
             DoNotOptimize(D);
         }
 
-        setCounters(state.counters, complexitySyrk(M, K));
+        setCounters<Real>(state.counters, complexitySyrk(M, K));
         state.counters["m"] = M;
     }
 
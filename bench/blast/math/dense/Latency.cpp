@@ -0,0 +1,110 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <blast/math/algorithm/Gemm.hpp>
+#include <blast/math/dense/Getrf.hpp>
+#include <blast/math/dense/Potrf.hpp>
+#include <blast/math/dense/Syrk.hpp>
+#include <blast/math/dense/Trsm.hpp>
+#include <blast/math/Matrix.hpp>
+#include <blast/blaze/Math.hpp>
+
+#include <blaze/math/DynamicMatrix.h>
+
+#include <bench/Benchmark.hpp>
+#include <bench/Latency.hpp>
+
+#include <blast/math/algorithm/Randomize.hpp>
+
+#include <vector>
+
+
+namespace blast :: benchmark
+{
+    template <typename Real>
+    static void LAT_gemm(LatencyState& state)
+    {
+        size_t const m = state.range(0);
+
+        DynamicMatrix<Real, columnMajor> A(m, m), B(m, m), C(m, m), D(m, m);
+        randomize(A);
+        randomize(B);
+        randomize(C);
+
+        state.measure([&] {
+            gemm(Real(1.), A, trans(B), Real(1.), C, D);
+            DoNotOptimize(D);
+        }, A, B, C, D);
+    }
+
+
+    template <typename Real>
+    static void LAT_potrf(LatencyState& state)
+    {
+        size_t const m = state.range(0);
+
+        DynamicMatrix<Real, columnMajor> A(m, m), L(m, m);
+        makePositiveDefinite(A);
+
+        state.measure([&] {
+            potrf(A, L);
+            DoNotOptimize(L);
+        }, A, L);
+    }
+
+
+    /// @brief Identity input, which getrf() does not change, see BM_getrf_static_plain_best_case.
+    template <typename Real>
+    static void LAT_getrf(LatencyState& state)
+    {
+        size_t const m = state.range(0);
+
+        DynamicMatrix<Real, columnMajor> A = IdentityMatrix<Real>(m);
+        std::vector<size_t> ipiv(m);
+
+        state.measure([&] {
+            getrf(A, ipiv.data());
+            DoNotOptimize(A);
+        }, A, ipiv);
+    }
+
+
+    template <typename Real>
+    static void LAT_trsm(LatencyState& state)
+    {
+        size_t const m = state.range(0);
+
+        DynamicMatrix<Real, columnMajor> A(m, m), B(m, m), X(m, m);
+        makePositiveDefinite(A);
+        randomize(B);
+
+        state.measure([&] {
+            trsm<UpLo::Upper, false>(A, B, X);
+            DoNotOptimize(X);
+        }, A, B, X);
+    }
+
+
+    template <typename Real>
+    static void LAT_syrk(LatencyState& state)
+    {
+        size_t const m = state.range(0);
+
+        DynamicMatrix<Real, columnMajor> A(m, m), C(m, m), D(m, m);
+        randomize(A);
+        makeSymmetric(C);
+
+        state.measure([&] {
+            syrkLower(Real(1.), A, Real(1.), C, D);
+            DoNotOptimize(D);
+        }, A, C, D);
+    }
+
+
+    BLAST_LATENCY_BENCHMARK(LAT_gemm<double>)->Apply(latencyArguments);
+    BLAST_LATENCY_BENCHMARK(LAT_potrf<double>)->Apply(latencyArguments);
+    BLAST_LATENCY_BENCHMARK(LAT_getrf<double>)->Apply(latencyArguments);
+    BLAST_LATENCY_BENCHMARK(LAT_trsm<double>)->Apply(latencyArguments);
+    BLAST_LATENCY_BENCHMARK(LAT_syrk<double>)->Apply(latencyArguments);
+}
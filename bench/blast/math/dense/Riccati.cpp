@@ -0,0 +1,88 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <blast/math/algorithm/Gemm.hpp>
+#include <blast/math/algorithm/Trmm.hpp>
+#include <blast/math/dense/Potrf.hpp>
+#include <blast/math/dense/Syrk.hpp>
+#include <blast/math/dense/Trsm.hpp>
+#include <blast/math/Matrix.hpp>
+#include <blast/blaze/Math.hpp>
+
+#include <bench/Riccati.hpp>
+
+#include <vector>
+
+
+namespace blast :: benchmark
+{
+    /// @brief Riccati iteration with BLAST routines on dense column-major matrices, see bench/Riccati.hpp.
+    template <typename Real>
+    class BlastRiccati
+    {
+    public:
+        using Matrix = blaze::DynamicMatrix<Real, columnMajor>;
+
+
+        explicit BlastRiccati(RiccatiData<Real> const& data)
+        :   data_ {data}
+        ,   LH_(data.N, Matrix(data.nu + data.nx, data.nu + data.nx, Real(0.)))
+        ,   RSQ_(data.nu + data.nx, data.nu + data.nx)
+        ,   H_(data.nu + data.nx, data.nu + data.nx)
+        ,   U_(data.nu + data.nx, data.nx)
+        ,   LN_(data.nx, data.nx, Real(0.))
+        ,   I_(blaze::IdentityMatrix<Real>(data.nu))
+        ,   W_(data.nu, data.nu)
+        ,   Kt_(data.nx, data.nu)
+        {
+        }
+
+
+        void operator()()
+        {
+            size_t const nx = data_.nx;
+            size_t const nu = data_.nu;
+
+            potrf(data_.QN, LN_);
+
+            for (size_t k = data_.N; k-- > 0; )
+            {
+                gemm(Real(1.), data_.CtD[k], trans(data_.Ct[k]), Real(1.), data_.RSQ0[k], RSQ_);
+
+                if (k + 1 < data_.N)
+                    trmm(Real(1.), data_.BAt[k], blaze::submatrix(LH_[k + 1], nu, nu, nx, nx), UpLo::Lower, false, U_);
+                else
+                    trmm(Real(1.), data_.BAt[k], LN_, UpLo::Lower, false, U_);
+
+                syrkLower(Real(1.), U_, Real(1.), RSQ_, H_);
+                potrf(H_, LH_[k]);
+            }
+
+            trsm<UpLo::Lower, false>(blaze::submatrix(LH_[0], 0, 0, nu, nu), I_, W_);
+            trmm(Real(-1.), blaze::submatrix(LH_[0], nu, 0, nx, nu), W_, UpLo::Lower, false, Kt_);
+        }
+
+
+    private:
+        RiccatiData<Real> const& data_;
+        std::vector<Matrix> LH_;
+        Matrix RSQ_;
+        Matrix H_;
+        Matrix U_;
+        Matrix LN_;
+        Matrix const I_;
+        Matrix W_;
+        Matrix Kt_;
+    };
+
+
+    template <typename Real>
+    static void BM_riccati(State& state)
+    {
+        benchmarkRiccati<BlastRiccati, Real>(state);
+    }
+
+
+    BENCHMARK_TEMPLATE(BM_riccati, double)->Apply(riccatiArguments);
+}
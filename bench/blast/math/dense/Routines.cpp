@@ -0,0 +1,97 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <blast/math/algorithm/Gemm.hpp>
+#include <blast/math/algorithm/Trmm.hpp>
+#include <blast/math/dense/Getrf.hpp>
+#include <blast/math/dense/Iamax.hpp>
+#include <blast/math/dense/Potrf.hpp>
+#include <blast/math/dense/Syrk.hpp>
+#include <blast/math/dense/Trsm.hpp>
+#include <blast/math/Matrix.hpp>
+#include <blast/blaze/Math.hpp>
+
+#include <bench/Routines.hpp>
+
+#include <algorithm>
+#include <vector>
+
+
+namespace blast :: benchmark
+{
+    /// @brief BLAST adapter for the benchmarks in bench/Routines.hpp. BLAST has no trmv.
+    struct BlastBackend
+    {
+        static bool constexpr rectangularGetrf = true;
+
+
+        template <typename Real>
+        static blaze::DynamicMatrix<Real, columnMajor> matrix(blaze::DynamicMatrix<Real, columnMajor> const& A)
+        {
+            return A;
+        }
+
+
+        template <typename Real>
+        static blaze::DynamicVector<Real> vector(blaze::DynamicVector<Real> const& x)
+        {
+            return x;
+        }
+
+
+        template <typename MT>
+        static auto gemm(size_t, size_t, size_t, MT& A, MT& B, MT& C, MT& D)
+        {
+            using Real = ElementType_t<MT>;
+            return [&] { blast::gemm(Real(1.), A, trans(B), Real(1.), C, D); };
+        }
+
+
+        template <typename MT>
+        static auto syrk(size_t, size_t, MT& A, MT& C, MT& D)
+        {
+            using Real = ElementType_t<MT>;
+            return [&] { syrkLower(Real(1.), A, Real(1.), C, D); };
+        }
+
+
+        template <typename MT>
+        static auto trmm(size_t, size_t, MT& A, MT& B, MT& C)
+        {
+            using Real = ElementType_t<MT>;
+            return [&] { blast::trmm(Real(1.), A, UpLo::Upper, false, B, C); };
+        }
+
+
+        template <typename MT>
+        static auto trsm(size_t, size_t, MT& A, MT& B, MT& X)
+        {
+            return [&] { blast::trsm<UpLo::Upper, false>(A, B, X); };
+        }
+
+
+        template <typename MT>
+        static auto potrf(size_t, MT& A, MT& L)
+        {
+            return [&] { blast::potrf(A, L); };
+        }
+
+
+        template <typename MT>
+        static auto getrf(size_t m, size_t n, MT& A)
+        {
+            return [&A, ipiv = std::vector<size_t>(std::min(m, n))] () mutable { blast::getrf(A, ipiv.data()); };
+        }
+
+
+        template <typename VT>
+        static auto iamax(size_t, VT& x)
+        {
+            return [&] { return blast::iamax(x); };
+        }
+    };
+
+
+    BLAST_ROUTINE_BENCHMARKS(BlastBackend, double);
+}
@@ -8,6 +8,7 @@
 #include <bench/Benchmark.hpp>
 #include <bench/Complexity.hpp>
 #include <bench/Getrf.hpp>
+#include <bench/CacheMode.hpp>
 
 #include <blast/math/algorithm/Randomize.hpp>
 
@@ -24,11 +25,12 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, A, ipiv);
             getrf(A, ipiv.data());
             DoNotOptimize(A);
         }
 
-        setCounters(state.counters, complexityGetrf(M, M));
+        setCounters<Real>(state.counters, complexityGetrf(M, M));
         state.counters["m"] = M;
     }
 
@@ -45,6 +47,7 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, A, ipiv);
             reset(A);
             for (size_t i = 0; i < M; ++i)
                 A(i, M - i - 1) = 1.;
@@ -53,7 +56,7 @@ namespace blast :: benchmark
             DoNotOptimize(A);
         }
 
-        setCounters(state.counters, complexityGetrf(M, M));
+        setCounters<Real>(state.counters, complexityGetrf(M, M));
         state.counters["m"] = M;
     }
 
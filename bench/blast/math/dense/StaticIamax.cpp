@@ -18,6 +18,7 @@
 
 #include <bench/Iamax.hpp>
 #include <bench/Complexity.hpp>
+#include <bench/CacheMode.hpp>
 
 
 namespace blast :: benchmark
@@ -32,12 +33,13 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, x);
             x[0] = 0;
             idx = iamax(x);
             DoNotOptimize(idx);
         }
 
-        setCounters(state.counters, complexity(iamaxTag, N));
+        setCounters<Real>(state.counters, complexity(iamaxTag, N));
     }
 
 
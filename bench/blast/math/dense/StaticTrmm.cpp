@@ -6,7 +6,8 @@
 #include <blast/math/Matrix.hpp>
 #include <blast/blaze/Math.hpp>
 
-#include <bench/Gemm.hpp>
+#include <bench/Trmm.hpp>
+#include <bench/CacheMode.hpp>
 #include <blast/math/algorithm/Randomize.hpp>
 
 
@@ -24,13 +25,14 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, A, B, C);
             trmm(1., A, UpLo::Upper, false, B, C);
             DoNotOptimize(A);
             DoNotOptimize(B);
             DoNotOptimize(C);
         }
 
-        state.counters["flops"] = Counter(M * (M + 1) * N, Counter::kIsIterationInvariantRate);
+        setCounters<Real>(state.counters, complexity(trmmTag, M, N));
         state.counters["m"] = M;
         state.counters["n"] = N;
     }
@@ -48,13 +50,14 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, A, B, C);
             trmm(1., B, A, UpLo::Lower, false, C);
             DoNotOptimize(A);
             DoNotOptimize(B);
             DoNotOptimize(C);
         }
 
-        state.counters["flops"] = Counter(N * (N + 1) * M, Counter::kIsIterationInvariantRate);
+        setCounters<Real>(state.counters, complexity(trmmTag, N, M));
         state.counters["m"] = M;
         state.counters["n"] = N;
     }
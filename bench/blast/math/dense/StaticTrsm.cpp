@@ -9,6 +9,7 @@
 #include <blaze/math/StaticMatrix.h>
 
 #include <bench/Trsm.hpp>
+#include <bench/CacheMode.hpp>
 
 
 namespace blast :: benchmark
@@ -25,13 +26,14 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, A, B, X);
             trsm<UPLO, UNIT>(A, B, X);
             DoNotOptimize(A);
             DoNotOptimize(B);
             DoNotOptimize(X);
         }
 
-        setCounters(state.counters, complexity(trsmTag, UNIT, M, N));
+        setCounters<Real>(state.counters, complexity(trsmTag, UNIT, M, N));
         state.counters["m"] = M;
         state.counters["n"] = N;
     }
@@ -6,6 +6,7 @@
 #include <blast/math/StaticPanelMatrix.hpp>
 
 #include <bench/Benchmark.hpp>
+#include <bench/CacheMode.hpp>
 
 #include <blaze/Math.h>
 
@@ -24,6 +25,7 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, lhs, rhs);
             lhs = rhs;
             DoNotOptimize(rhs);
             DoNotOptimize(lhs);
@@ -44,6 +46,7 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, lhs, rhs);
             lhs = rhs;
             DoNotOptimize(rhs);
             DoNotOptimize(lhs);
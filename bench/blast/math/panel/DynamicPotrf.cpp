@@ -7,6 +7,7 @@
 
 #include <bench/Benchmark.hpp>
 #include <bench/Complexity.hpp>
+#include <bench/CacheMode.hpp>
 
 #include <blast/math/algorithm/Randomize.hpp>
 
@@ -26,12 +27,13 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, A, L);
             potrf(A, L);
             DoNotOptimize(A);
             DoNotOptimize(L);
         }
 
-        setCounters(state.counters, complexityPotrf(M, M));
+        setCounters<Real>(state.counters, complexityPotrf(M, M));
         state.counters["m"] = M;
     }
 
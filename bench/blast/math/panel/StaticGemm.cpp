@@ -8,6 +8,7 @@
 #include <blast/blaze/Math.hpp>
 
 #include <bench/Gemm.hpp>
+#include <bench/CacheMode.hpp>
 
 #include <blast/math/algorithm/Randomize.hpp>
 
@@ -34,6 +35,7 @@ namespace blast :: benchmark
 
         for (auto _ : state)
         {
+            prepareCache(state, A, B, C, D);
             gemm(alpha, A, trans(B), beta, C, D);
             DoNotOptimize(A);
             DoNotOptimize(B);
@@ -41,7 +43,7 @@ namespace blast :: benchmark
             DoNotOptimize(D);
         }
 
-        setCounters(state.counters, complexityGemm(M, N, K));
+        setCounters<Real>(state.counters, complexityGemm(M, N, K));
         state.counters["m"] = M;
     }
 
@@ -30,7 +30,7 @@ namespace blast :: benchmark
         }
 
         if (M >= N)
-            setCounters(state.counters, complexityPotrf(M, N));
+            setCounters<T>(state.counters, complexityPotrf(M, N));
     }
 
 
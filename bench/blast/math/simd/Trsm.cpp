@@ -33,7 +33,7 @@ namespace blast :: benchmark
             DoNotOptimize(ker);
         }
 
-        setCounters(state.counters, complexity(trsmTag, false, M, N));
+        setCounters<T>(state.counters, complexity(trsmTag, false, M, N));
     }
 
 
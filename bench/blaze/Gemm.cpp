@@ -38,7 +38,7 @@ namespace blast :: benchmark
             DoNotOptimize(D);
         }
 
-        setCounters(state.counters, complexityGemm(M, N, K));
+        setCounters<Real>(state.counters, complexityGemm(M, N, K));
         state.counters["m"] = M;
         state.counters["n"] = N;
         state.counters["k"] = K;
@@ -72,7 +72,7 @@ namespace blast :: benchmark
             DoNotOptimize(D);
         }
 
-        setCounters(state.counters, complexityGemm(m, m, m));
+        setCounters<Real>(state.counters, complexityGemm(m, m, m));
         state.counters["m"] = m;
     }
 
@@ -99,7 +99,7 @@ namespace blast :: benchmark
                 }
         }
 
-        setCounters(state.counters, complexityGemm(m, m, m));
+        setCounters<Real>(state.counters, complexityGemm(m, m, m));
         state.counters["m"] = m;
     }
 
@@ -132,7 +132,7 @@ namespace blast :: benchmark
                 }
         }
 
-        setCounters(state.counters, complexityGemm(m, m, m));
+        setCounters<Real>(state.counters, complexityGemm(m, m, m));
         state.counters["m"] = m;
     }
 
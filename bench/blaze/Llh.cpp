@@ -0,0 +1,35 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <bench/Benchmark.hpp>
+#include <bench/Complexity.hpp>
+
+#include <blaze/Math.h>
+
+
+namespace blast :: benchmark
+{
+    template <typename Real>
+    static void BM_llh_dynamic(State& state)
+    {
+        size_t const m = state.range(0);
+
+        blaze::DynamicMatrix<Real, blaze::columnMajor> A(m, m), L(m, m);
+        makePositiveDefinite(A);
+
+        for (auto _ : state)
+        {
+            llh(A, L);
+            DoNotOptimize(A);
+            DoNotOptimize(L);
+        }
+
+        setCounters<Real>(state.counters, complexityPotrf(m, m));
+        state.counters["m"] = m;
+    }
+
+
+    BENCHMARK_TEMPLATE(BM_llh_dynamic, double)->DenseRange(1, BENCHMARK_MAX_POTRF);
+    BENCHMARK_TEMPLATE(BM_llh_dynamic, float)->DenseRange(1, BENCHMARK_MAX_POTRF);
+}
@@ -0,0 +1,38 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <bench/Benchmark.hpp>
+#include <bench/Complexity.hpp>
+#include <bench/Getrf.hpp>
+
+#include <blaze/Math.h>
+
+
+namespace blast :: benchmark
+{
+    template <typename Real>
+    static void BM_lu_dynamic(State& state)
+    {
+        size_t const m = state.range(0);
+
+        blaze::DynamicMatrix<Real, blaze::columnMajor> A(m, m), L(m, m), U(m, m), P(m, m);
+        makePositiveDefinite(A);
+
+        for (auto _ : state)
+        {
+            lu(A, L, U, P);
+            DoNotOptimize(A);
+            DoNotOptimize(L);
+            DoNotOptimize(U);
+            DoNotOptimize(P);
+        }
+
+        setCounters<Real>(state.counters, complexityGetrf(m, m));
+        state.counters["m"] = m;
+    }
+
+
+    BENCHMARK_TEMPLATE(BM_lu_dynamic, double)->DenseRange(1, BENCHMARK_MAX_GETRF);
+    BENCHMARK_TEMPLATE(BM_lu_dynamic, float)->DenseRange(1, BENCHMARK_MAX_GETRF);
+}
@@ -0,0 +1,89 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <bench/Routines.hpp>
+
+#include <blaze/Math.h>
+
+
+namespace blast :: benchmark
+{
+    /**
+     * @brief Blaze adapter for the benchmarks in bench/Routines.hpp.
+     *
+     * Blaze has no triangular solve with multiple right-hand sides, so trsm() is written with inv(), as in BM_trsv_dynamic.
+     * lu() with a permutation matrix is defined for square matrices only.
+     * Blaze has no iamax.
+     */
+    struct BlazeBackend
+    {
+        static bool constexpr rectangularGetrf = false;
+
+
+        template <typename Real>
+        static blaze::DynamicMatrix<Real, blaze::columnMajor> matrix(blaze::DynamicMatrix<Real, blaze::columnMajor> const& A)
+        {
+            return A;
+        }
+
+
+        template <typename Real>
+        static blaze::DynamicVector<Real> vector(blaze::DynamicVector<Real> const& x)
+        {
+            return x;
+        }
+
+
+        template <typename MT>
+        static auto gemm(size_t, size_t, size_t, MT& A, MT& B, MT& C, MT& D)
+        {
+            return [&] { D = A * trans(B) + C; };
+        }
+
+
+        template <typename MT>
+        static auto syrk(size_t, size_t, MT& A, MT& C, MT& D)
+        {
+            return [&] { D = declsym(A * trans(A)) + C; };
+        }
+
+
+        template <typename MT>
+        static auto trmm(size_t, size_t, MT& A, MT& B, MT& C)
+        {
+            return [&] { C = declupp(A) * B; };
+        }
+
+
+        template <typename MT>
+        static auto trsm(size_t, size_t, MT& A, MT& B, MT& X)
+        {
+            return [&] { X = inv(declupp(A)) * B; };
+        }
+
+
+        template <typename MT>
+        static auto potrf(size_t, MT& A, MT& L)
+        {
+            return [&] { llh(A, L); };
+        }
+
+
+        template <typename MT>
+        static auto getrf(size_t m, size_t, MT& A)
+        {
+            return [&A, L = MT(m, m), U = MT(m, m), P = MT(m, m)] () mutable { lu(A, L, U, P); };
+        }
+
+
+        template <typename MT, typename VT>
+        static auto trmv(size_t, MT& A, VT& x, VT& y)
+        {
+            return [&] { y = declupp(A) * x; };
+        }
+    };
+
+
+    BLAST_ROUTINE_BENCHMARKS(BlazeBackend, double);
+}
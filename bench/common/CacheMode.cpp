@@ -0,0 +1,138 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <bench/CacheMode.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#   include <immintrin.h>
+#endif
+
+
+namespace blast :: benchmark
+{
+    namespace detail
+    {
+        CacheMode cacheMode = CacheMode::hot;
+    }
+
+
+    namespace
+    {
+        std::size_t constexpr cacheLineSize = 64;
+
+
+        std::size_t cacheSize(int name, std::size_t fallback)
+        {
+            long const size = sysconf(name);
+            return size > 0 ? static_cast<std::size_t>(size) : fallback;
+        }
+
+
+        void readBuffer(std::vector<char> const& buffer)
+        {
+            std::uint64_t sum = 0;
+
+            for (std::size_t i = 0; i < buffer.size(); i += cacheLineSize)
+                sum += buffer[i];
+
+            ::benchmark::DoNotOptimize(sum);
+        }
+    }
+
+
+    void setCacheMode(CacheMode mode) noexcept
+    {
+        detail::cacheMode = mode;
+    }
+
+
+    CacheMode parseCacheMode(std::string const& name)
+    {
+        if (name == "hot")
+            return CacheMode::hot;
+
+        if (name == "l2")
+            return CacheMode::l2;
+
+        if (name == "cold")
+            return CacheMode::cold;
+
+        throw std::invalid_argument {"Invalid cache mode: " + name};
+    }
+
+
+    char const * toString(CacheMode mode) noexcept
+    {
+        switch (mode)
+        {
+            case CacheMode::l2:
+                return "l2";
+
+            case CacheMode::cold:
+                return "cold";
+
+            default:
+                return "hot";
+        }
+    }
+
+
+    void flushRange(void const * p, std::size_t bytes) noexcept
+    {
+        std::uintptr_t const begin = reinterpret_cast<std::uintptr_t>(p) & ~(cacheLineSize - 1);
+        std::uintptr_t const end = reinterpret_cast<std::uintptr_t>(p) + bytes;
+
+        for (std::uintptr_t a = begin; a < end; a += cacheLineSize)
+        {
+            [[maybe_unused]] void const * const line = reinterpret_cast<void const *>(a);
+#if defined(__x86_64__) || defined(__i386__)
+            _mm_clflush(line);
+#elif defined(__aarch64__)
+            asm volatile("dc civac, %0" : : "r"(line) : "memory");
+#endif
+        }
+    }
+
+
+    void completeFlush() noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_mfence();
+#elif defined(__aarch64__)
+        asm volatile("dsb ish" : : : "memory");
+#else
+        // Twice the last level cache
+        static std::vector<char> const buffer(2 * cacheSize(_SC_LEVEL3_CACHE_SIZE, std::size_t(64) << 20), 1);
+        readBuffer(buffer);
+#endif
+    }
+
+
+    void touchRange(void const * p, std::size_t bytes) noexcept
+    {
+        char const * const begin = static_cast<char const *>(p);
+        std::uint64_t sum = 0;
+
+        for (std::size_t i = 0; i < bytes; i += cacheLineSize)
+            sum += begin[i];
+
+        if (bytes > 0)
+            sum += begin[bytes - 1];
+
+        ::benchmark::DoNotOptimize(sum);
+    }
+
+
+    void evictL1() noexcept
+    {
+        static std::vector<char> const buffer(4 * cacheSize(_SC_LEVEL1_DCACHE_SIZE, std::size_t(48) << 10), 1);
+        readBuffer(buffer);
+    }
+}
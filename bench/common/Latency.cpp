@@ -0,0 +1,370 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <bench/Latency.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <ostream>
+#include <regex>
+#include <thread>
+
+#include <sched.h>
+#include <sys/mman.h>
+
+
+namespace blast :: benchmark
+{
+    namespace detail
+    {
+        bool latencyTsc = false;
+    }
+
+
+    namespace
+    {
+        /// @brief Nanoseconds per tick of the latency timer.
+        double nsPerTick = 1.;
+
+
+        std::vector<std::unique_ptr<LatencyBenchmark>>& latencyBenchmarks()
+        {
+            static std::vector<std::unique_ptr<LatencyBenchmark>> benchmarks;
+            return benchmarks;
+        }
+
+
+        /// @brief Calibrate the time stamp counter against the monotonic clock.
+        double calibrateTsc()
+        {
+            using Clock = std::chrono::steady_clock;
+
+            auto const t0 = Clock::now();
+            std::uint64_t const c0 = latencyTicks();
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            std::uint64_t const c1 = latencyTicks();
+            auto const t1 = Clock::now();
+
+            return std::chrono::duration<double, std::nano>(t1 - t0).count() / (c1 - c0);
+        }
+
+
+        /// @brief Value of the sample at the given quantile of sorted samples, by the nearest-rank method.
+        double quantile(std::vector<double> const& sorted, double q)
+        {
+            std::size_t const rank = static_cast<std::size_t>(std::ceil(q * sorted.size()));
+            return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+        }
+
+
+        bool pinToCpu(int cpu)
+        {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+
+            if (sched_setaffinity(0, sizeof(set), &set) != 0)
+            {
+                std::cerr << "Could not pin to CPU " << cpu << ": " << std::strerror(errno) << std::endl;
+                return false;
+            }
+
+            return true;
+        }
+
+
+        bool requestFifo(int priority)
+        {
+            sched_param param {};
+            param.sched_priority = priority;
+
+            if (sched_setscheduler(0, SCHED_FIFO, &param) != 0)
+            {
+                std::cerr << "Could not set SCHED_FIFO priority " << priority << ": " << std::strerror(errno) << std::endl;
+                return false;
+            }
+
+            // Page faults are another source of jitter in real-time processes
+            if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+                std::cerr << "Could not lock memory: " << std::strerror(errno) << std::endl;
+
+            return true;
+        }
+
+
+        std::string jsonString(std::string const& s)
+        {
+            std::string result = "\"";
+
+            for (char c : s)
+            {
+                if (c == '"' || c == '\\')
+                    result += '\\';
+
+                result += c;
+            }
+
+            return result + "\"";
+        }
+
+
+        std::string localDateTime()
+        {
+            std::time_t const now = std::time(nullptr);
+            char buffer[64];
+            std::strftime(buffer, sizeof(buffer), "%FT%T%z", std::localtime(&now));
+            return buffer;
+        }
+
+
+        struct LatencyResult
+        {
+            std::string name;
+            LatencyStatistics statistics;
+        };
+
+
+        void writeJson(std::ostream& os, std::vector<LatencyResult> const& results, LatencyOptions const& options,
+            std::string const& executable, bool pinned, bool fifo)
+        {
+            os << "{\n";
+            os << "  \"context\": {\n";
+            os << "    \"date\": " << jsonString(localDateTime()) << ",\n";
+            os << "    \"executable\": " << jsonString(executable) << ",\n";
+            os << "    \"timer\": " << jsonString(options.timer) << ",\n";
+            os << "    \"ns_per_tick\": " << nsPerTick << ",\n";
+            os << "    \"samples\": " << options.samples << ",\n";
+            os << "    \"warmup\": " << options.warmup << ",\n";
+            os << "    \"cache_mode\": " << jsonString(toString(cacheMode())) << ",\n";
+            os << "    \"cpu\": " << (pinned ? std::to_string(*options.cpu) : "null") << ",\n";
+            os << "    \"sched_fifo\": " << (fifo ? std::to_string(*options.fifoPriority) : "null") << "\n";
+            os << "  },\n";
+            os << "  \"benchmarks\": [";
+
+            for (std::size_t i = 0; i < results.size(); ++i)
+            {
+                LatencyStatistics const& s = results[i].statistics;
+
+                os << (i > 0 ? "," : "") << "\n    {\n";
+                os << "      \"name\": " << jsonString(results[i].name) << ",\n";
+                os << "      \"time_unit\": \"ns\",\n";
+                os << "      \"samples\": " << s.samples << ",\n";
+                os << "      \"min\": " << s.min << ",\n";
+                os << "      \"mean\": " << s.mean << ",\n";
+                os << "      \"p50\": " << s.p50 << ",\n";
+                os << "      \"p99\": " << s.p99 << ",\n";
+                os << "      \"p99.9\": " << s.p999 << ",\n";
+                os << "      \"max\": " << s.max << ",\n";
+                os << "      \"histogram\": {\n";
+                os << "        \"min\": " << s.histogramMin << ",\n";
+                os << "        \"bin_width\": " << s.binWidth << ",\n";
+                os << "        \"counts\": [";
+
+                for (std::size_t j = 0; j < s.histogram.size(); ++j)
+                    os << (j > 0 ? ", " : "") << s.histogram[j];
+
+                os << "]\n";
+                os << "      }\n";
+                os << "    }";
+            }
+
+            os << "\n  ]\n}\n";
+        }
+    }
+
+
+    LatencyStatistics latencyStatistics(std::vector<double> samples, std::size_t bins)
+    {
+        LatencyStatistics s;
+
+        if (samples.empty())
+            return s;
+
+        std::sort(samples.begin(), samples.end());
+
+        s.samples = samples.size();
+        s.min = samples.front();
+        s.max = samples.back();
+        s.mean = std::accumulate(samples.begin(), samples.end(), 0.) / samples.size();
+        s.p50 = quantile(samples, 0.5);
+        s.p99 = quantile(samples, 0.99);
+        s.p999 = quantile(samples, 0.999);
+
+        bins = std::max<std::size_t>(bins, 1);
+        s.histogramMin = s.min;
+        s.binWidth = s.max > s.min ? (s.max - s.min) / bins : 1.;
+        s.histogram.assign(bins, 0);
+
+        for (double x : samples)
+            ++s.histogram[std::min(static_cast<std::size_t>((x - s.min) / s.binWidth), bins - 1)];
+
+        return s;
+    }
+
+
+    LatencyState::LatencyState(std::vector<long> const& args, LatencyOptions const& options)
+    :   args_ {args}
+    ,   samples_ {options.samples}
+    ,   warmup_ {options.warmup}
+    {
+    }
+
+
+    std::vector<double> LatencyState::latencies() const
+    {
+        std::vector<double> result(ticks_.size());
+        std::transform(ticks_.begin(), ticks_.end(), result.begin(), [] (std::uint64_t t) { return t * nsPerTick; });
+        return result;
+    }
+
+
+    LatencyBenchmark::LatencyBenchmark(std::string name, LatencyFunction function)
+    :   name_ {std::move(name)}
+    ,   function_ {function}
+    {
+    }
+
+
+    LatencyBenchmark * LatencyBenchmark::Arg(long x)
+    {
+        args_.push_back({x});
+        return this;
+    }
+
+
+    LatencyBenchmark * LatencyBenchmark::Args(std::vector<long> const& args)
+    {
+        args_.push_back(args);
+        return this;
+    }
+
+
+    LatencyBenchmark * LatencyBenchmark::DenseRange(long start, long limit, long step)
+    {
+        for (long x = start; x <= limit; x += step)
+            Arg(x);
+
+        return this;
+    }
+
+
+    LatencyBenchmark * LatencyBenchmark::Apply(void (*f)(LatencyBenchmark *))
+    {
+        f(this);
+        return this;
+    }
+
+
+    std::vector<std::vector<long>> LatencyBenchmark::argumentSets() const
+    {
+        if (args_.empty())
+            return {{}};
+
+        return args_;
+    }
+
+
+    void latencyArguments(LatencyBenchmark * b)
+    {
+        for (long m : {2, 4, 8, 12, 16, 20, 24, 32})
+            b->Arg(m);
+    }
+
+
+    LatencyBenchmark * registerLatencyBenchmark(std::string name, LatencyFunction function)
+    {
+        latencyBenchmarks().push_back(std::make_unique<LatencyBenchmark>(std::move(name), function));
+        return latencyBenchmarks().back().get();
+    }
+
+
+    int runLatencyBenchmarks(LatencyOptions const& options, std::string const& executable)
+    {
+        if (options.timer == "tsc")
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            detail::latencyTsc = true;
+            nsPerTick = calibrateTsc();
+#else
+            std::cerr << "The tsc timer is only available on x86" << std::endl;
+            return 1;
+#endif
+        }
+        else if (options.timer != "clock")
+        {
+            std::cerr << "Invalid latency timer: " << options.timer << std::endl;
+            return 1;
+        }
+
+        if (options.samples == 0)
+        {
+            std::cerr << "The number of latency samples must be positive" << std::endl;
+            return 1;
+        }
+
+        bool const pinned = options.cpu && pinToCpu(*options.cpu);
+        bool const fifo = options.fifoPriority && requestFifo(*options.fifoPriority);
+
+        std::regex filter;
+
+        try
+        {
+            filter.assign(options.filter.empty() ? std::string(".*") : options.filter);
+        }
+        catch (std::regex_error const& e)
+        {
+            std::cerr << "Invalid latency filter " << options.filter << ": " << e.what() << std::endl;
+            return 1;
+        }
+
+        std::vector<LatencyResult> results;
+
+        std::printf("%-40s %10s %10s %10s %10s %10s\n", "Latency [ns]", "min", "p50", "p99", "p99.9", "max");
+
+        for (auto const& benchmark : latencyBenchmarks())
+            for (auto const& args : benchmark->argumentSets())
+            {
+                std::string name = benchmark->name();
+
+                for (long a : args)
+                    name += "/" + std::to_string(a);
+
+                if (!std::regex_search(name, filter))
+                    continue;
+
+                LatencyState state {args, options};
+                benchmark->function()(state);
+
+                LatencyStatistics const s = latencyStatistics(state.latencies(), options.bins);
+                std::printf("%-40s %10.0f %10.0f %10.0f %10.0f %10.0f\n", name.c_str(), s.min, s.p50, s.p99, s.p999, s.max);
+                std::fflush(stdout);
+
+                results.push_back({std::move(name), s});
+            }
+
+        if (!options.out.empty())
+        {
+            std::ofstream os {options.out};
+
+            if (!os)
+            {
+                std::cerr << "Could not open " << options.out << std::endl;
+                return 1;
+            }
+
+            writeJson(os, results, options, executable, pinned, fifo);
+        }
+
+        return 0;
+    }
+}
@@ -0,0 +1,553 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <bench/Main.hpp>
+#include <bench/CacheMode.hpp>
+#include <bench/Latency.hpp>
+#include <bench/PerfCounters.hpp>
+#include <bench/Peak.hpp>
+
+#include <blast/util/TileStats.hpp>
+
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+
+namespace blast :: benchmark
+{
+    using namespace ::benchmark;
+
+
+    namespace
+    {
+#ifdef BLAST_BENCHMARK_PROFILER_MANAGER
+        /// @brief Counts the hardware events and the tile statistics of the profiling run of every benchmark.
+        ///
+        /// Google Benchmark performs the profiling run after the measured repetitions,
+        /// with the same number of iterations, and calls the profiler right around the timed loop.
+        class CounterProfiler
+        :   public ProfilerManager
+        {
+        public:
+            /// @param counters hardware performance counters, nullptr if not used
+            /// @param tileStats whether to collect the tile statistics
+            CounterProfiler(PerfCounters * counters, bool tileStats)
+            :   counters_ {counters}
+            ,   tileStats_ {tileStats}
+            {
+            }
+
+
+            void AfterSetupStart() override
+            {
+                if (tileStats_)
+                    tileStatsStart_ = profile::tileStats();
+
+                if (counters_)
+                    counters_->start();
+            }
+
+
+            void BeforeTeardownStop() override
+            {
+                if (counters_)
+                {
+                    counters_->stop();
+                    values_ = counters_->read();
+                }
+
+                if (tileStats_)
+                    tileStatsValues_ = profile::tileStats() - tileStatsStart_;
+            }
+
+
+            /// @brief Hardware performance counters, nullptr if not used.
+            PerfCounters const * counters() const noexcept
+            {
+                return counters_;
+            }
+
+
+            /// @brief Values counted in the last profiling run.
+            std::vector<std::optional<double>> const& values() const noexcept
+            {
+                return values_;
+            }
+
+
+            /// @brief Tile statistics of the last profiling run, if collected.
+            std::optional<profile::TileStats> tileStats() const
+            {
+                if (!tileStats_)
+                    return std::nullopt;
+
+                return tileStatsValues_;
+            }
+
+        private:
+            PerfCounters * counters_;
+            bool tileStats_;
+            std::vector<std::optional<double>> values_;
+            profile::TileStats tileStatsStart_;
+            profile::TileStats tileStatsValues_;
+        };
+
+
+        /// @brief Reporter which adds the performance counters and the tile statistics to the runs
+        /// and passes them on to another reporter.
+        class CounterReporter
+        :   public BenchmarkReporter
+        {
+        public:
+            CounterReporter(BenchmarkReporter& reporter, CounterProfiler const& profiler)
+            :   reporter_ {reporter}
+            ,   profiler_ {profiler}
+            {
+            }
+
+
+            bool ReportContext(Context const& context) override
+            {
+                // Google Benchmark sets the streams of the reporter it has been given,
+                // so pass them on.
+                reporter_.SetOutputStream(&GetOutputStream());
+                reporter_.SetErrorStream(&GetErrorStream());
+
+                return reporter_.ReportContext(context);
+            }
+
+
+            void ReportRunsConfig(double min_time, bool has_explicit_iters, IterationCount iters) override
+            {
+                reporter_.ReportRunsConfig(min_time, has_explicit_iters, iters);
+            }
+
+
+            void ReportRuns(std::vector<Run> const& runs) override
+            {
+                std::vector<Run> r = runs;
+
+                for (Run& run : r)
+                    addCounters(run);
+
+                reporter_.ReportRuns(r);
+            }
+
+
+            void Finalize() override
+            {
+                reporter_.Finalize();
+            }
+
+        private:
+            void addCounters(Run& run) const
+            {
+                if (run.skipped || run.iterations == 0)
+                    return;
+
+                // Deviation statistics of per-iteration values would be misleading,
+                // only the central tendency aggregates get the counters.
+                if (run.run_type == Run::RT_Aggregate
+                    && run.aggregate_name != "mean" && run.aggregate_name != "median")
+                    return;
+
+                double const iterations = run.iterations;
+
+                if (auto const tiles = profiler_.tileStats())
+                    addTileCounters(run, *tiles, iterations);
+
+                if (!profiler_.counters())
+                    return;
+
+                auto const& events = profiler_.counters()->events();
+                auto const& values = profiler_.values();
+
+                std::optional<double> cycles, fpArith;
+
+                for (std::size_t i = 0; i < values.size(); ++i)
+                    if (values[i])
+                    {
+                        double const v = *values[i] / iterations;
+                        run.counters["perf." + events[i]] = Counter(v);
+
+                        if (events[i] == "cycles")
+                            cycles = v;
+                        else if (events[i] == "fp_arith")
+                            fpArith = v;
+                    }
+
+                if (cycles && *cycles > 0.)
+                {
+                    // Prefer the FLOPs counted by the hardware; otherwise use the algorithmic FLOPs,
+                    // which have already been converted to FLOPs per CPU second.
+                    if (fpArith)
+                        run.counters["perf.flops_per_cycle"] = Counter(*fpArith / *cycles);
+                    else if (auto const it = run.counters.find("flops"); it != run.counters.end())
+                        run.counters["perf.flops_per_cycle"] = Counter(
+                            it->second.value * run.cpu_accumulated_time / iterations / *cycles);
+                }
+            }
+
+
+            /// @brief Add the tile statistics per iteration, if the benchmark has recorded any.
+            static void addTileCounters(Run& run, profile::TileStats const& tiles, double iterations)
+            {
+                if (tiles.empty())
+                    return;
+
+                for (std::size_t i = 0; i <= profile::tileMaxRows; ++i)
+                    for (std::size_t j = 0; j <= profile::tileMaxColumns; ++j)
+                        if (tiles.fullTiles[i][j] || tiles.partialTiles[i][j])
+                        {
+                            std::string const shape = "tiles." + std::to_string(i) + "x" + std::to_string(j);
+                            run.counters[shape + ".full"] = Counter(tiles.fullTiles[i][j] / iterations);
+                            run.counters[shape + ".partial"] = Counter(tiles.partialTiles[i][j] / iterations);
+                        }
+
+                run.counters["tiles.full"] = Counter(tiles.totalFullTiles() / iterations);
+                run.counters["tiles.partial"] = Counter(tiles.totalPartialTiles() / iterations);
+                run.counters["simd.loads"] = Counter(tiles.loads / iterations);
+                run.counters["simd.masked_loads"] = Counter(tiles.maskedLoads / iterations);
+                run.counters["simd.stores"] = Counter(tiles.stores / iterations);
+                run.counters["simd.masked_stores"] = Counter(tiles.maskedStores / iterations);
+            }
+
+
+            BenchmarkReporter& reporter_;
+            CounterProfiler const& profiler_;
+        };
+#endif
+
+
+        /// @brief Value of a "--name=value" option, if present.
+        std::optional<std::string> findOption(int argc, char ** argv, char const * name)
+        {
+            std::string const prefix = std::string("--") + name + "=";
+            std::optional<std::string> value;
+
+            // The last occurrence wins, as in Google Benchmark
+            for (int i = 1; i < argc; ++i)
+                if (std::strncmp(argv[i], prefix.c_str(), prefix.size()) == 0)
+                    value = argv[i] + prefix.size();
+
+            return value;
+        }
+
+
+        bool isTrue(std::string const& value)
+        {
+            return value == "true" || value == "yes" || value == "1" || value == "on";
+        }
+
+
+        /// @brief Remove a "--name" or "--name=value" option from the command line.
+        ///
+        /// @return the value of the option, empty if the value is omitted; no value if the option is absent.
+        std::optional<std::string> extractOption(int& argc, char ** argv, char const * name)
+        {
+            std::optional<std::string> value;
+            std::string const option = std::string("--") + name;
+
+            for (int i = 1; i < argc; )
+            {
+                std::string const arg = argv[i];
+
+                if (arg == option)
+                    value.emplace();
+                else if (arg.starts_with(option + "="))
+                    value = arg.substr(option.size() + 1);
+                else
+                {
+                    ++i;
+                    continue;
+                }
+
+                // Remove the option, so that Google Benchmark does not report it as unrecognized
+                for (int j = i; j + 1 < argc; ++j)
+                    argv[j] = argv[j + 1];
+
+                --argc;
+            }
+
+            return value;
+        }
+
+
+#ifdef BLAST_BENCHMARK_PROFILER_MANAGER
+        /// @brief Events selected by the --perf_counters option.
+        std::vector<std::string> perfCounterEvents(std::string const& value)
+        {
+            if (value.empty())
+                return PerfCounters::supportedEvents();
+
+            std::vector<std::string> events;
+            std::istringstream list {value};
+
+            for (std::string event; std::getline(list, event, ','); )
+                if (!event.empty())
+                    events.push_back(event);
+
+            return events;
+        }
+#endif
+
+
+        /// @brief Remove the latency benchmark options from the command line.
+        ///
+        /// @return the latency benchmark settings if --latency is given, no value otherwise.
+        ///
+        /// @throw std::invalid_argument if a numeric option has an invalid value
+        std::optional<LatencyOptions> extractLatencyOptions(int& argc, char ** argv)
+        {
+            auto const latency = extractOption(argc, argv, "latency");
+            auto const samples = extractOption(argc, argv, "latency_samples");
+            auto const warmup = extractOption(argc, argv, "latency_warmup");
+            auto const bins = extractOption(argc, argv, "latency_bins");
+            auto const timer = extractOption(argc, argv, "latency_timer");
+            auto const cpu = extractOption(argc, argv, "latency_cpu");
+            auto const fifo = extractOption(argc, argv, "latency_fifo");
+            auto const filter = extractOption(argc, argv, "latency_filter");
+            auto const out = extractOption(argc, argv, "latency_out");
+
+            if (!latency || !(latency->empty() || isTrue(*latency)))
+                return std::nullopt;
+
+            auto const number = [] (std::string const& name, std::string const& value)
+            {
+                long x = -1;
+
+                try
+                {
+                    x = std::stol(value);
+                }
+                catch (std::logic_error const&)
+                {
+                }
+
+                if (x < 0)
+                    throw std::invalid_argument {"Invalid value of --" + name + ": " + value};
+
+                return x;
+            };
+
+            LatencyOptions options;
+
+            if (samples)
+                options.samples = number("latency_samples", *samples);
+
+            if (warmup)
+                options.warmup = number("latency_warmup", *warmup);
+
+            if (bins)
+                options.bins = number("latency_bins", *bins);
+
+            if (timer)
+                options.timer = *timer;
+
+            if (cpu)
+                options.cpu = number("latency_cpu", *cpu);
+
+            // Without a value, request a high priority which still leaves room for the kernel threads
+            if (fifo)
+                options.fifoPriority = fifo->empty() ? 80 : number("latency_fifo", *fifo);
+
+            if (filter)
+                options.filter = *filter;
+
+            if (out)
+                options.out = *out;
+
+            return options;
+        }
+
+
+#ifdef BLAST_BENCHMARK_PROFILER_MANAGER
+        /// @brief Google Benchmark options which determine the reporters.
+        struct ReporterOptions
+        {
+            std::string format;
+            std::string outFormat;
+            std::string out;
+            std::string color;
+            std::string tabular;
+        };
+
+
+        /// @brief Read the reporter options; must be called before Initialize(), which removes them from the command line.
+        ReporterOptions reporterOptions(int argc, char ** argv)
+        {
+            return {
+                .format = findOption(argc, argv, "benchmark_format").value_or("console"),
+                .outFormat = findOption(argc, argv, "benchmark_out_format").value_or("json"),
+                .out = findOption(argc, argv, "benchmark_out").value_or(""),
+                .color = findOption(argc, argv, "benchmark_color").value_or("auto"),
+                .tabular = findOption(argc, argv, "benchmark_counters_tabular").value_or("false")
+            };
+        }
+
+
+        /// @brief Create a reporter of the same kind as Google Benchmark would for the given format.
+        std::unique_ptr<BenchmarkReporter> createReporter(std::string const& format, ReporterOptions const& options)
+        {
+            if (format == "console")
+            {
+                int oo = ConsoleReporter::OO_None;
+
+                if (options.color == "auto" ? isatty(STDOUT_FILENO) : isTrue(options.color))
+                    oo |= ConsoleReporter::OO_Color;
+
+                if (isTrue(options.tabular))
+                    oo |= ConsoleReporter::OO_Tabular;
+
+                return std::make_unique<ConsoleReporter>(static_cast<ConsoleReporter::OutputOptions>(oo));
+            }
+
+            if (format == "json")
+                return std::make_unique<JSONReporter>();
+
+            if (format == "csv")
+                return std::make_unique<CSVReporter>();
+
+            throw std::invalid_argument {"Unexpected benchmark output format: " + format};
+        }
+#endif
+    }
+
+
+    int runBenchmarks(int argc, char ** argv)
+    {
+        auto const perfCounters = extractOption(argc, argv, "perf_counters");
+        auto const tileStatsOption = extractOption(argc, argv, "tile_stats");
+        auto const cache = extractOption(argc, argv, "cache_mode");
+        auto const peakContext = extractOption(argc, argv, "peak_context");
+#ifdef BLAST_BENCHMARK_PROFILER_MANAGER
+        auto const options = reporterOptions(argc, argv);
+#endif
+        std::optional<LatencyOptions> latency;
+
+        try
+        {
+            latency = extractLatencyOptions(argc, argv);
+        }
+        catch (std::invalid_argument const& e)
+        {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+
+        Initialize(&argc, argv);
+
+        if (ReportUnrecognizedArguments(argc, argv))
+            return 1;
+
+        try
+        {
+            if (cache)
+                setCacheMode(parseCacheMode(*cache));
+        }
+        catch (std::invalid_argument const& e)
+        {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+
+        if (latency)
+        {
+            int const status = runLatencyBenchmarks(*latency, argv[0]);
+            Shutdown();
+            return status;
+        }
+
+        // Calibrated peaks, for the roofline analysis of the results.
+        // The calibration takes a noticeable time, therefore it is only done on request.
+        if (peakContext && (peakContext->empty() || isTrue(*peakContext)))
+        {
+            AddCustomContext("peak_flops_double", std::to_string(peakFlops<double>()));
+            AddCustomContext("peak_flops_float", std::to_string(peakFlops<float>()));
+            AddCustomContext("peak_bandwidth", std::to_string(peakBandwidth()));
+        }
+
+        AddCustomContext("cache_mode", toString(cacheMode()));
+
+#ifdef BLAST_BENCHMARK_PROFILER_MANAGER
+        std::optional<PerfCounters> counters;
+
+        if (perfCounters)
+        {
+            try
+            {
+                counters.emplace(perfCounterEvents(*perfCounters));
+            }
+            catch (std::invalid_argument const& e)
+            {
+                std::cerr << e.what() << std::endl;
+                return 1;
+            }
+
+            for (std::size_t i = 0; i < counters->events().size(); ++i)
+                if (!counters->available(i))
+                    std::cerr << "Performance counter \"" << counters->events()[i] << "\" is not available" << std::endl;
+        }
+
+        bool const hardwareCounters = counters && counters->anyAvailable();
+        bool const tileStats = tileStatsOption && (tileStatsOption->empty() || isTrue(*tileStatsOption));
+
+        // Without any available counters, e.g. in a container, run the benchmarks as usual.
+        if (!hardwareCounters && !tileStats)
+        {
+            RunSpecifiedBenchmarks();
+            Shutdown();
+            return 0;
+        }
+
+        CounterProfiler profiler {hardwareCounters ? &*counters : nullptr, tileStats};
+        std::unique_ptr<BenchmarkReporter> displayReporter, fileReporter;
+        std::unique_ptr<CounterReporter> display, file;
+
+        try
+        {
+            displayReporter = createReporter(options.format, options);
+            display = std::make_unique<CounterReporter>(*displayReporter, profiler);
+
+            if (!options.out.empty())
+            {
+                fileReporter = createReporter(options.outFormat, options);
+                file = std::make_unique<CounterReporter>(*fileReporter, profiler);
+            }
+        }
+        catch (std::invalid_argument const& e)
+        {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+
+        RegisterProfilerManager(&profiler);
+        RunSpecifiedBenchmarks(display.get(), file.get());
+        RegisterProfilerManager(nullptr);
+        Shutdown();
+
+        return 0;
+#else
+        if (perfCounters || tileStatsOption)
+        {
+            std::cerr << "--perf_counters and --tile_stats require Google Benchmark 1.8.4 or newer" << std::endl;
+            Shutdown();
+            return 1;
+        }
+
+        RunSpecifiedBenchmarks();
+        Shutdown();
+
+        return 0;
+#endif
+    }
+}
@@ -0,0 +1,109 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <bench/Peak.hpp>
+#include <bench/Benchmark.hpp>
+
+#include <blast/math/simd/SimdVec.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+
+namespace blast :: benchmark
+{
+    namespace
+    {
+        template <typename F>
+        double bestTime(F f)
+        {
+            using Clock = std::chrono::steady_clock;
+            double best = std::numeric_limits<double>::infinity();
+
+            for (int rep = 0; rep < 5; ++rep)
+            {
+                auto const t0 = Clock::now();
+                f();
+                auto const t1 = Clock::now();
+
+                best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+            }
+
+            return best;
+        }
+
+
+        template <typename Real>
+        double measurePeakFlops()
+        {
+            using Vec = SimdVec<Real>;
+
+            // More independent chains than FMA latency times the number of FMA units on current CPUs,
+            // but few enough to keep them in registers.
+            std::size_t constexpr chains = 12;
+            std::size_t constexpr iterations = 1 << 20;
+
+            Vec const a {Real(0.999999)}, b {Real(1e-6)};
+            std::array<Vec, chains> acc;
+
+            double const t = bestTime([&] {
+                acc.fill(Vec {Real(1)});
+
+                for (std::size_t i = 0; i < iterations; ++i)
+                    for (auto& x : acc)
+                        x = fmadd(a, x, b);
+
+                DoNotOptimize(acc);
+            });
+
+            return 2. * Vec::size() * chains * iterations / t;
+        }
+
+
+        double measureBandwidth()
+        {
+            using Vec = SimdVec<double>;
+
+            // 256 MiB, much larger than the last level cache
+            std::size_t constexpr n = std::size_t(1) << 25;
+            std::vector<double> data(n, 1.);
+
+            double const t = bestTime([&] {
+                Vec const one {1.};
+                std::array<Vec, 4> acc;
+
+                for (std::size_t i = 0; i + acc.size() * Vec::size() <= n; i += acc.size() * Vec::size())
+                    for (std::size_t k = 0; k < acc.size(); ++k)
+                        acc[k] = fmadd(one, Vec {data.data() + i + k * Vec::size(), false}, acc[k]);
+
+                DoNotOptimize(acc);
+            });
+
+            return n * sizeof(double) / t;
+        }
+    }
+
+
+    template <typename Real>
+    double peakFlops()
+    {
+        static double const peak = measurePeakFlops<Real>();
+        return peak;
+    }
+
+
+    double peakBandwidth()
+    {
+        static double const bandwidth = measureBandwidth();
+        return bandwidth;
+    }
+
+
+    template double peakFlops<float>();
+    template double peakFlops<double>();
+}
@@ -0,0 +1,238 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <bench/PerfCounters.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#if defined(__linux__)
+#   include <linux/perf_event.h>
+#   include <sys/ioctl.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#endif
+
+
+namespace blast :: benchmark
+{
+    namespace
+    {
+        struct EventCode
+        {
+            std::uint32_t type;
+            std::uint64_t config;
+            double weight;
+        };
+
+
+        bool isIntel()
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            return __builtin_cpu_is("intel");
+#else
+            return false;
+#endif
+        }
+
+
+#if defined(__linux__)
+        /// @brief Hardware events which make up a named event; empty if the event is not supported by this CPU.
+        std::vector<EventCode> eventCodes(std::string const& name)
+        {
+            if (name == "cycles")
+                return {{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, 1.}};
+
+            if (name == "instructions")
+                return {{PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, 1.}};
+
+            if (name == "l1d_misses")
+                return {{
+                    PERF_TYPE_HW_CACHE,
+                    PERF_COUNT_HW_CACHE_L1D
+                        | PERF_COUNT_HW_CACHE_OP_READ << 8
+                        | PERF_COUNT_HW_CACHE_RESULT_MISS << 16,
+                    1.
+                }};
+
+            if (name == "l2_misses")
+            {
+                // L2_RQSTS.MISS
+                if (isIntel())
+                    return {{PERF_TYPE_RAW, 0x3f24, 1.}};
+
+                return {};
+            }
+
+            if (name == "fp_arith")
+            {
+                // FP_ARITH_INST_RETIRED.*, grouped by the number of operations per instruction.
+                // FMA instructions are counted twice by the hardware.
+                if (isIntel())
+                    return {
+                        // SCALAR_DOUBLE, SCALAR_SINGLE
+                        {PERF_TYPE_RAW, 0x03c7, 1.},
+                        // 128B_PACKED_DOUBLE
+                        {PERF_TYPE_RAW, 0x04c7, 2.},
+                        // 128B_PACKED_SINGLE, 256B_PACKED_DOUBLE
+                        {PERF_TYPE_RAW, 0x18c7, 4.},
+                        // 256B_PACKED_SINGLE, 512B_PACKED_DOUBLE
+                        {PERF_TYPE_RAW, 0x60c7, 8.},
+                        // 512B_PACKED_SINGLE
+                        {PERF_TYPE_RAW, 0x80c7, 16.}
+                    };
+
+                return {};
+            }
+
+            throw std::invalid_argument {"Unsupported performance counter event: " + name};
+        }
+
+
+        int openEvent(EventCode const& code)
+        {
+            perf_event_attr attr {};
+            attr.size = sizeof(attr);
+            attr.type = code.type;
+            attr.config = code.config;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+#endif
+    }
+
+
+    PerfCounters::PerfCounters(std::vector<std::string> const& events)
+    :   names_ {events}
+    ,   counters_(events.size())
+    {
+        for (auto const& name : events)
+            if (std::find(supportedEvents().begin(), supportedEvents().end(), name) == supportedEvents().end())
+                throw std::invalid_argument {"Unsupported performance counter event: " + name};
+
+#if defined(__linux__)
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            auto const codes = eventCodes(events[i]);
+            Counter& counter = counters_[i];
+
+            for (auto const& code : codes)
+            {
+                int const fd = openEvent(code);
+
+                if (fd < 0)
+                {
+                    // All parts of an event must be available, otherwise the event is not available.
+                    for (int f : counter.fd)
+                        close(f);
+
+                    counter = Counter {};
+                    break;
+                }
+
+                counter.fd.push_back(fd);
+                counter.weight.push_back(code.weight);
+            }
+        }
+#endif
+    }
+
+
+    PerfCounters::~PerfCounters()
+    {
+#if defined(__linux__)
+        for (auto const& counter : counters_)
+            for (int fd : counter.fd)
+                close(fd);
+#endif
+    }
+
+
+    std::vector<std::string> const& PerfCounters::supportedEvents()
+    {
+        static std::vector<std::string> const events {
+            "cycles", "instructions", "l1d_misses", "l2_misses", "fp_arith"
+        };
+
+        return events;
+    }
+
+
+    bool PerfCounters::available(std::size_t i) const noexcept
+    {
+        return !counters_[i].fd.empty();
+    }
+
+
+    bool PerfCounters::anyAvailable() const noexcept
+    {
+        return std::any_of(counters_.begin(), counters_.end(),
+            [] (Counter const& c) { return !c.fd.empty(); });
+    }
+
+
+    void PerfCounters::start()
+    {
+#if defined(__linux__)
+        for (auto const& counter : counters_)
+            for (int fd : counter.fd)
+            {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+#endif
+    }
+
+
+    void PerfCounters::stop()
+    {
+#if defined(__linux__)
+        for (auto const& counter : counters_)
+            for (int fd : counter.fd)
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+    }
+
+
+    std::vector<std::optional<double>> PerfCounters::read() const
+    {
+        std::vector<std::optional<double>> values(counters_.size());
+
+#if defined(__linux__)
+        for (std::size_t i = 0; i < counters_.size(); ++i)
+        {
+            Counter const& counter = counters_[i];
+            if (counter.fd.empty())
+                continue;
+
+            double sum = 0.;
+            bool valid = true;
+
+            for (std::size_t k = 0; k < counter.fd.size(); ++k)
+            {
+                // value, time enabled, time running
+                std::uint64_t data[3] {};
+
+                if (::read(counter.fd[k], data, sizeof(data)) != sizeof(data) || data[2] == 0)
+                {
+                    valid = false;
+                    break;
+                }
+
+                // Scale the value if the counter was multiplexed
+                sum += counter.weight[k] * static_cast<double>(data[0]) * data[1] / data[2];
+            }
+
+            if (valid)
+                values[i] = sum;
+        }
+#endif
+
+        return values;
+    }
+}
@@ -0,0 +1,86 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <bench/Riccati.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+
+namespace blast :: benchmark
+{
+    namespace
+    {
+        std::vector<std::vector<int64_t>> parseRiccatiSizes(std::string const& text)
+        {
+            std::vector<std::vector<int64_t>> sizes;
+            std::string normalized = text;
+
+            for (char& c : normalized)
+                if (c == ';')
+                    c = ' ';
+
+            std::istringstream is {normalized};
+
+            for (std::string triple; is >> triple; )
+            {
+                std::vector<int64_t> size;
+                std::istringstream fields {triple};
+
+                for (std::string field; std::getline(fields, field, ','); )
+                {
+                    char * end = nullptr;
+                    long long const value = std::strtoll(field.c_str(), &end, 10);
+
+                    if (field.empty() || *end != '\0' || value <= 0)
+                        throw std::invalid_argument {"invalid size \"" + triple + "\""};
+
+                    size.push_back(value);
+                }
+
+                if (size.size() != 3)
+                    throw std::invalid_argument {"expected nx,nu,N, got \"" + triple + "\""};
+
+                sizes.push_back(size);
+            }
+
+            return sizes;
+        }
+    }
+
+
+    void riccatiArguments(::benchmark::internal::Benchmark * b)
+    {
+        std::vector<std::vector<int64_t>> sizes {
+            // Small embedded problems
+            {4, 2, 10}, {4, 2, 30}, {8, 3, 20},
+            // Typical MPC of mechanical systems
+            {12, 4, 30}, {12, 6, 50}, {17, 5, 40},
+            // Large problems
+            {30, 10, 30}, {50, 20, 20}
+        };
+
+        if (char const * const text = std::getenv("BLAST_BENCHMARK_RICCATI"))
+        {
+            try
+            {
+                sizes = parseRiccatiSizes(text);
+            }
+            catch (std::invalid_argument const& e)
+            {
+                // Called while registering the benchmarks, before main()
+                std::cerr << "BLAST_BENCHMARK_RICCATI: " << e.what() << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+        }
+
+        b->ArgNames({"nx", "nu", "N"});
+
+        for (auto const& size : sizes)
+            b->Args(size);
+    }
+}
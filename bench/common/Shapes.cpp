@@ -0,0 +1,216 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <bench/Shapes.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+
+namespace blast :: benchmark
+{
+    namespace
+    {
+        std::string trim(std::string const& s)
+        {
+            auto const begin = std::find_if_not(s.begin(), s.end(), [] (unsigned char c) { return std::isspace(c); });
+            auto const end = std::find_if_not(s.rbegin(), s.rend(), [] (unsigned char c) { return std::isspace(c); }).base();
+
+            return begin < end ? std::string(begin, end) : std::string();
+        }
+
+
+        std::vector<Shape> defaultShapes()
+        {
+            // Small sizes, where the performance cliffs of BLAST, BLASFEO and LIBXSMM are
+            std::vector<Shape> shapes = shapeGrid({4, 8, 16, 32, 64}, {4, 8, 16, 32, 64}, {4, 8, 16, 32, 64});
+
+            std::vector<std::size_t> const large {64, 128, 200};
+            std::vector<std::size_t> const small {2, 4, 8, 16};
+
+            for (ShapeFamily family : {ShapeFamily::tallSkinny, ShapeFamily::shortWide, ShapeFamily::rankK})
+                for (Shape const& s : shapeFamily(family, large, small))
+                    if (std::find(shapes.begin(), shapes.end(), s) == shapes.end())
+                        shapes.push_back(s);
+
+            return shapes;
+        }
+    }
+
+
+    std::vector<Shape> shapeGrid(std::vector<std::size_t> const& m,
+        std::vector<std::size_t> const& n, std::vector<std::size_t> const& k)
+    {
+        std::vector<Shape> shapes;
+        shapes.reserve(m.size() * n.size() * k.size());
+
+        for (std::size_t mm : m)
+            for (std::size_t nn : n)
+                for (std::size_t kk : k)
+                    shapes.push_back({mm, nn, kk});
+
+        return shapes;
+    }
+
+
+    std::vector<Shape> shapeFamily(ShapeFamily family,
+        std::vector<std::size_t> const& large, std::vector<std::size_t> const& small)
+    {
+        std::vector<Shape> shapes;
+
+        for (std::size_t l : large)
+        {
+            if (family == ShapeFamily::square)
+            {
+                shapes.push_back({l, l, l});
+                continue;
+            }
+
+            for (std::size_t s : small)
+                switch (family)
+                {
+                    case ShapeFamily::tallSkinny:
+                        shapes.push_back({l, s, l});
+                        break;
+
+                    case ShapeFamily::shortWide:
+                        shapes.push_back({s, l, l});
+                        break;
+
+                    default:
+                        shapes.push_back({l, l, s});
+                        break;
+                }
+        }
+
+        return shapes;
+    }
+
+
+    std::vector<Shape> readShapes(std::string const& fileName)
+    {
+        std::ifstream is {fileName};
+
+        if (!is)
+            throw std::runtime_error {"Could not open shape file " + fileName};
+
+        std::vector<Shape> shapes;
+        std::string line;
+
+        for (std::size_t lineNumber = 1; std::getline(is, line); ++lineNumber)
+        {
+            line = trim(line);
+
+            if (line.empty() || line.front() == '#')
+                continue;
+
+            // Header
+            if (lineNumber == 1 && !std::isdigit(static_cast<unsigned char>(line.front())))
+                continue;
+
+            std::vector<std::size_t> dims;
+            std::istringstream fields {line};
+
+            for (std::string field; std::getline(fields, field, ','); )
+            {
+                field = trim(field);
+                char * end = nullptr;
+                unsigned long long const value = std::strtoull(field.c_str(), &end, 10);
+
+                if (field.empty() || *end != '\0' || value == 0)
+                    throw std::runtime_error {fileName + ":" + std::to_string(lineNumber) + ": invalid dimension \"" + field + "\""};
+
+                dims.push_back(value);
+            }
+
+            if (dims.size() > 3)
+                throw std::runtime_error {fileName + ":" + std::to_string(lineNumber) + ": more than 3 dimensions"};
+
+            dims.resize(3, dims.front());
+            shapes.push_back({dims[0], dims[1], dims[2]});
+        }
+
+        return shapes;
+    }
+
+
+    std::vector<Shape> const& benchmarkShapes()
+    {
+        static std::vector<Shape> const shapes = [] {
+            char const * const fileName = std::getenv("BLAST_BENCHMARK_SHAPES");
+
+            if (!fileName)
+                return defaultShapes();
+
+            try
+            {
+                return readShapes(fileName);
+            }
+            catch (std::runtime_error const& e)
+            {
+                // Called while registering the benchmarks, before main()
+                std::cerr << e.what() << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+        }();
+
+        return shapes;
+    }
+
+
+    void shapeArguments(::benchmark::internal::Benchmark * b, std::string_view dims)
+    {
+        std::vector<std::vector<int64_t>> args;
+
+        for (Shape const& s : benchmarkShapes())
+        {
+            std::vector<int64_t> a;
+
+            for (char d : dims)
+                a.push_back(d == 'm' ? s.m : d == 'n' ? s.n : s.k);
+
+            if (std::find(args.begin(), args.end(), a) == args.end())
+                args.push_back(std::move(a));
+        }
+
+        std::vector<std::string> names;
+
+        for (char d : dims)
+            names.emplace_back(1, d);
+
+        b->ArgNames(names);
+
+        for (auto const& a : args)
+            b->Args(a);
+    }
+
+
+    void gemmShapeArguments(::benchmark::internal::Benchmark * b)
+    {
+        shapeArguments(b, "mnk");
+    }
+
+
+    void syrkShapeArguments(::benchmark::internal::Benchmark * b)
+    {
+        shapeArguments(b, "mk");
+    }
+
+
+    void rectangularShapeArguments(::benchmark::internal::Benchmark * b)
+    {
+        shapeArguments(b, "mn");
+    }
+
+
+    void squareShapeArguments(::benchmark::internal::Benchmark * b)
+    {
+        shapeArguments(b, "m");
+    }
+}
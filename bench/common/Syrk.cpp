@@ -18,7 +18,10 @@ namespace blast :: benchmark
     {
         return {
             {"add", m * (m + 1) * k / 2},
-            {"mul", m * (m + 1) * k / 2}
+            {"mul", m * (m + 1) * k / 2},
+            // A and lower triangles of C and D
+            {"load", m * k + m * (m + 1) / 2},
+            {"store", m * (m + 1) / 2}
         };
     }
 }
@@ -48,7 +48,7 @@ namespace blast :: benchmark
             ::benchmark::DoNotOptimize(D);
         }
 
-        setCounters(state.counters, complexityGemm(M, N, K));
+        setCounters<Real>(state.counters, complexityGemm(M, N, K));
         state.counters["m"] = M;
         state.counters["n"] = N;
         state.counters["k"] = K;
@@ -82,7 +82,7 @@ namespace blast :: benchmark
             ::benchmark::DoNotOptimize(D);
         }
 
-        setCounters(state.counters, complexityGemm(m, m, m));
+        setCounters<Real>(state.counters, complexityGemm(m, m, m));
         state.counters["m"] = m;
     }
 
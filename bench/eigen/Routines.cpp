@@ -0,0 +1,117 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <Eigen/Dense>
+
+#include <bench/Routines.hpp>
+
+
+namespace blast :: benchmark
+{
+    /**
+     * @brief Eigen adapter for the benchmarks in bench/Routines.hpp.
+     *
+     * Eigen::LLT and Eigen::PartialPivLU keep the factors in their own storage,
+     * and Eigen::PartialPivLU is defined for square matrices only.
+     */
+    struct EigenBackend
+    {
+        template <typename Real>
+        using Matrix = Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor>;
+
+
+        template <typename Real>
+        using Vector = Eigen::Matrix<Real, Eigen::Dynamic, 1>;
+
+
+        static bool constexpr rectangularGetrf = false;
+
+
+        template <typename Real>
+        static Matrix<Real> matrix(blaze::DynamicMatrix<Real, blaze::columnMajor> const& A)
+        {
+            return Eigen::Map<Matrix<Real> const, Eigen::Unaligned, Eigen::OuterStride<>>(
+                data(A), rows(A), columns(A), Eigen::OuterStride<>(spacing(A)));
+        }
+
+
+        template <typename Real>
+        static Vector<Real> vector(blaze::DynamicVector<Real> const& x)
+        {
+            return Eigen::Map<Vector<Real> const>(data(x), size(x));
+        }
+
+
+        template <typename MT>
+        static auto gemm(size_t, size_t, size_t, MT& A, MT& B, MT& C, MT& D)
+        {
+            return [&] { D.noalias() = C + A * B.transpose(); };
+        }
+
+
+        template <typename MT>
+        static auto syrk(size_t, size_t, MT& A, MT& C, MT& D)
+        {
+            return [&]
+            {
+                D.template triangularView<Eigen::Lower>() = C;
+                D.template selfadjointView<Eigen::Lower>().rankUpdate(A);
+            };
+        }
+
+
+        template <typename MT>
+        static auto trmm(size_t, size_t, MT& A, MT& B, MT& C)
+        {
+            return [&] { C.noalias() = A.template triangularView<Eigen::Upper>() * B; };
+        }
+
+
+        template <typename MT>
+        static auto trsm(size_t, size_t, MT& A, MT& B, MT& X)
+        {
+            return [&]
+            {
+                X = B;
+                A.template triangularView<Eigen::Upper>().solveInPlace(X);
+            };
+        }
+
+
+        template <typename MT>
+        static auto potrf(size_t m, MT& A, MT&)
+        {
+            return [&A, llt = Eigen::LLT<MT>(m)] () mutable { llt.compute(A); };
+        }
+
+
+        template <typename MT>
+        static auto getrf(size_t m, size_t, MT& A)
+        {
+            return [&A, lu = Eigen::PartialPivLU<MT>(m)] () mutable { lu.compute(A); };
+        }
+
+
+        template <typename MT, typename VT>
+        static auto trmv(size_t, MT& A, VT& x, VT& y)
+        {
+            return [&] { y.noalias() = A.template triangularView<Eigen::Upper>() * x; };
+        }
+
+
+        template <typename VT>
+        static auto iamax(size_t, VT& x)
+        {
+            return [&]
+            {
+                Eigen::Index idx;
+                x.cwiseAbs().maxCoeff(&idx);
+                return static_cast<size_t>(idx);
+            };
+        }
+    };
+
+
+    BLAST_ROUTINE_BENCHMARKS(EigenBackend, double);
+}
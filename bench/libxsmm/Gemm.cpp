@@ -40,7 +40,7 @@ namespace blast :: benchmark
         for (auto _ : state)
             kernel(a.data(), b.data(), c.data());
 
-        setCounters(state.counters, complexityGemm(m, n, k));
+        setCounters<Real>(state.counters, complexityGemm(m, n, k));
         state.counters["m"] = m;
     }
 
@@ -70,7 +70,7 @@ namespace blast :: benchmark
         for (auto _ : state)
             kernel(a.data(), b.data(), c.data());
 
-        setCounters(state.counters, complexityGemm(m, n, k));
+        setCounters<Real>(state.counters, complexityGemm(m, n, k));
         state.counters["m"] = m;
     }
 
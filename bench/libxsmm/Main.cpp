@@ -2,6 +2,6 @@
 // Use of this source code is governed by a BSD-style
 // license that can be found in the LICENSE file.
 
-#include <benchmark/benchmark.h>
+#include <bench/Main.hpp>
 
-BENCHMARK_MAIN();
+BLAST_BENCHMARK_MAIN();
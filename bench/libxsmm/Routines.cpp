@@ -0,0 +1,47 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <bench/Routines.hpp>
+
+#include <libxsmm.h>
+
+#include <stdexcept>
+#include <vector>
+
+
+namespace blast :: benchmark
+{
+    /// @brief LIBXSMM adapter for the benchmarks in bench/Routines.hpp. LIBXSMM provides only gemm.
+    struct LibxsmmBackend
+    {
+        template <typename Real>
+        static std::vector<Real> matrix(blaze::DynamicMatrix<Real, blaze::columnMajor> const& A)
+        {
+            std::vector<Real> a(rows(A) * columns(A));
+
+            for (size_t j = 0; j < columns(A); ++j)
+                for (size_t i = 0; i < rows(A); ++i)
+                    a[i + j * rows(A)] = A(i, j);
+
+            return a;
+        }
+
+
+        /// @brief libxsmm behaves upredictably with alpha != 1. || beta != 1., so D is updated in-place and C is not read.
+        template <typename Real>
+        static auto gemm(size_t m, size_t n, size_t k, std::vector<Real>& A, std::vector<Real>& B,
+            std::vector<Real>&, std::vector<Real>& D)
+        {
+            libxsmm_mmfunction<Real> kernel(LIBXSMM_GEMM_FLAG_TRANS_B, m, n, k, Real(1.), Real(1.));
+
+            if (!kernel)
+                throw std::runtime_error("LIBXSMM could not generate a kernel for this shape");
+
+            return [&, kernel] { kernel(A.data(), B.data(), D.data()); };
+        }
+    };
+
+
+    BLAST_ROUTINE_BENCHMARKS(LibxsmmBackend, double);
+}
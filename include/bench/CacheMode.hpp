@@ -0,0 +1,201 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+
+namespace blast :: benchmark
+{
+    /**
+     * @brief Cache state of the benchmark operands at the start of every iteration
+     */
+    enum class CacheMode
+    {
+        /// @brief Operands stay in the cache between iterations; the default.
+        hot,
+
+        /// @brief Operands are evicted from L1 but stay in L2, if they fit.
+        l2,
+
+        /// @brief Operands are flushed from all cache levels.
+        cold
+    };
+
+
+    namespace detail
+    {
+        extern CacheMode cacheMode;
+    }
+
+
+    /**
+     * @brief Current cache mode, selected by the --cache_mode command line option.
+     */
+    inline CacheMode cacheMode() noexcept
+    {
+        return detail::cacheMode;
+    }
+
+
+    void setCacheMode(CacheMode mode) noexcept;
+
+
+    /**
+     * @brief Cache mode from its name.
+     *
+     * @throw std::invalid_argument if @a name is not "hot", "l2" or "cold"
+     */
+    CacheMode parseCacheMode(std::string const& name);
+
+
+    /**
+     * @brief Name of a cache mode.
+     */
+    char const * toString(CacheMode mode) noexcept;
+
+
+    /**
+     * @brief Write back and invalidate the cache lines of a memory range in all cache levels.
+     *
+     * The flush is complete only after a call to @a completeFlush().
+     */
+    void flushRange(void const * p, std::size_t bytes) noexcept;
+
+
+    /**
+     * @brief Wait until the preceding @a flushRange() calls complete.
+     *
+     * On architectures without a user-space cache flush instruction,
+     * evicts the whole last level cache instead.
+     */
+    void completeFlush() noexcept;
+
+
+    /**
+     * @brief Read every cache line of a memory range.
+     */
+    void touchRange(void const * p, std::size_t bytes) noexcept;
+
+
+    /**
+     * @brief Evict the L1 data cache by reading a buffer several times larger than L1 but much smaller than L2.
+     */
+    void evictL1() noexcept;
+
+
+    namespace detail
+    {
+        /// @brief Call f(p, bytes) for the contiguous memory ranges holding the elements of x.
+        template <typename T, typename F>
+        inline void forEachRange(T const& x, F f)
+        {
+            if constexpr (std::is_arithmetic_v<T>)
+            {
+                f(std::addressof(x), sizeof(x));
+            }
+            else if constexpr (requires { x.pA; x.memsize; })
+            {
+                // BLASFEO matrix
+                f(x.pA, x.memsize);
+            }
+            else
+            {
+                // Merge adjacent elements into ranges
+                char const * begin = nullptr;
+                char const * end = nullptr;
+
+                auto const add = [&] (auto const& element)
+                {
+                    char const * const p = reinterpret_cast<char const *>(std::addressof(element));
+
+                    if (p != end)
+                    {
+                        if (begin != end)
+                            f(begin, end - begin);
+
+                        begin = p;
+                    }
+
+                    end = p + sizeof(element);
+                };
+
+                if constexpr (requires { rows(x); columns(x); requires std::is_lvalue_reference_v<decltype(x(0, 0))>; })
+                {
+                    for (std::size_t j = 0; j < columns(x); ++j)
+                        for (std::size_t i = 0; i < rows(x); ++i)
+                            add(x(i, j));
+                }
+                else if constexpr (requires { x.rows(); x.cols(); requires std::is_lvalue_reference_v<decltype(x(0, 0))>; })
+                {
+                    // Eigen matrix or vector
+                    for (std::size_t j = 0; j < static_cast<std::size_t>(x.cols()); ++j)
+                        for (std::size_t i = 0; i < static_cast<std::size_t>(x.rows()); ++i)
+                            add(x(i, j));
+                }
+                else
+                {
+                    static_assert(requires { x.size(); requires std::is_lvalue_reference_v<decltype(x[0])>; },
+                        "Unsupported benchmark operand type");
+
+                    for (std::size_t i = 0; i < x.size(); ++i)
+                        add(x[i]);
+                }
+
+                if (begin != end)
+                    f(begin, end - begin);
+            }
+        }
+    }
+
+
+    /**
+     * @brief Bring the operands into the cache state selected by @a cacheMode().
+     *
+     * Does nothing in the hot mode. Unlike @a prepareCache(), does not pause any timer.
+     *
+     * @param operands matrices, vectors or scalars used by the benchmarked routine
+     */
+    template <typename... Operands>
+    inline void prepareOperands(Operands const&... operands)
+    {
+        if (cacheMode() == CacheMode::cold)
+        {
+            (detail::forEachRange(operands, flushRange), ...);
+            completeFlush();
+        }
+        else if (cacheMode() == CacheMode::l2)
+        {
+            (detail::forEachRange(operands, touchRange), ...);
+            evictL1();
+        }
+    }
+
+
+    /**
+     * @brief Bring the benchmark operands into the cache state selected by @a cacheMode().
+     *
+     * Call at the beginning of the benchmark loop body. In the hot mode it does nothing;
+     * otherwise, the timer is paused while the operands are flushed or evicted from L1.
+     *
+     * @param state benchmark state
+     * @param operands matrices, vectors or scalars used by the benchmarked routine
+     */
+    template <typename... Operands>
+    inline void prepareCache(::benchmark::State& state, Operands const&... operands)
+    {
+        if (cacheMode() == CacheMode::hot) [[likely]]
+            return;
+
+        state.PauseTiming();
+        prepareOperands(operands...);
+        state.ResumeTiming();
+    }
+}
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <bench/Benchmark.hpp>
+#include <bench/Peak.hpp>
 
 #include <cstdlib>
 #include <string>
@@ -14,9 +15,24 @@
 
 namespace blast :: benchmark
 {
+    /**
+     * @brief Algorithmic complexity of a routine.
+     *
+     * Maps operation names ("add", "mul", "div", ...) to operation counts.
+     * The "load" and "store" entries are the compulsory memory traffic in matrix elements,
+     * i.e. every element of every operand read or written once.
+     */
     using Complexity = std::map<std::string, std::size_t>;
 
 
+    /// @brief Add @a times the operation counts of @a c to @a total, e.g. for a sequence of calls.
+    inline void addComplexity(Complexity& total, Complexity const& c, std::size_t times = 1)
+    {
+        for (auto const& v : c)
+            total[v.first] += v.second * times;
+    }
+
+
     /// @brief Algorithmic complexity of potrf
     inline Complexity complexityPotrf(std::size_t m, std::size_t n)
     {
@@ -31,7 +47,10 @@ namespace blast :: benchmark
             // Calculated as \sum_{k=0}^{n-1} \sum _{i=k}^{m-1} 1
             {"div", n * (1 + 2 * m - n) / 2},
             // Calculated as \sum_{k=0}^{n-1} 1
-            {"sqrt", n}
+            {"sqrt", n},
+            // Lower trapezoid of A
+            {"load", n * (n + 1) / 2 + (m - n) * n},
+            {"store", n * (n + 1) / 2 + (m - n) * n}
         };
     }
 
@@ -48,7 +67,9 @@ namespace blast :: benchmark
             // Calculated as \sum_{k=0}^{m-1} \sum_{i=k+1}^{m-1} (n-k)
             {"mul", (2 - m + 3 * n) * (m - 1) * m / 6},
             // Calculated as \sum_{k=0}^{n-1} \sum_{i=k}^{m-1} 1
-            {"div", m * (m - 1) / 2}
+            {"div", m * (m - 1) / 2},
+            {"load", m * n},
+            {"store", m * n}
         };
     }
 
@@ -62,16 +83,41 @@ namespace blast :: benchmark
             // Calculated as \sum_{j=0}^{n-1} \sum _{k=0}^{j-1} \sum _{i=0}^{m-1} 1
             {"mul", m * (n - 1) * n / 2},
             // Calculated as \sum_{k=0}^{n-1} \sum _{i=k}^{m-1} 1
-            {"div", n * (1 + 2 * m - n) / 2}
+            {"div", n * (1 + 2 * m - n) / 2},
+            // Lower triangle of the n x n matrix and the m x n right-hand side
+            {"load", n * (n + 1) / 2 + m * n},
+            {"store", m * n}
         };
     }
 
 
-    template <typename Map>
+    /**
+     * @brief Set the benchmark counters corresponding to the complexity of the benchmarked routine.
+     *
+     * Sets the following counters:
+     * - "f.<op>": operations per second, for every operation in @a c
+     * - "flops": additions and multiplications per second
+     * - "bytes": compulsory memory traffic per second
+     * - "ai": arithmetic intensity, in flops per byte of compulsory memory traffic
+     * - "peak": percentage of the calibrated peak performance, see @a peakFlops()
+     *
+     * @tparam Real element type of the matrices
+     *
+     * @param counters benchmark counters
+     * @param c complexity of one iteration
+     */
+    template <typename Real, typename Map>
     void setCounters(Map& counters, Complexity const& c)
     {
+        std::size_t bytes = 0;
+
         for (auto const& v : c)
-            counters["f." + v.first] = Counter(v.second, Counter::kIsIterationInvariantRate);
+        {
+            if (v.first == "load" || v.first == "store")
+                bytes += v.second * sizeof(Real);
+            else
+                counters["f." + v.first] = Counter(v.second, Counter::kIsIterationInvariantRate);
+        }
 
         std::size_t flops = 0;
         for (auto op : {"add", "mul"})
@@ -82,5 +128,15 @@ namespace blast :: benchmark
         }
 
         counters["flops"] = Counter(flops, Counter::kIsIterationInvariantRate);
+
+        if (bytes > 0)
+        {
+            counters["bytes"] = Counter(bytes, Counter::kIsIterationInvariantRate);
+            counters["ai"] = Counter(static_cast<double>(flops) / bytes);
+        }
+
+        // Converted to a rate, 100 * flops / peak is the percentage of the peak
+        if (flops > 0)
+            counters["peak"] = Counter(100. * flops / peakFlops<Real>(), Counter::kIsIterationInvariantRate);
     }
 }
@@ -17,6 +17,9 @@ namespace blast :: benchmark
         return {
             {"add", (m * n) * (k + 1)},
             {"mul", (m * n) * (k + 2)},
+            // A, B, C and D
+            {"load", m * k + k * n + m * n},
+            {"store", m * n}
         };
     }
 }
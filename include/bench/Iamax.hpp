@@ -19,7 +19,8 @@ namespace blast :: benchmark
     {
         return {
             {"cmp", n - 1},
-            {"abs", n}
+            {"abs", n},
+            {"load", n}
         };
     }
 }
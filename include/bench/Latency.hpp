@@ -0,0 +1,259 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <bench/CacheMode.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#   include <x86intrin.h>
+#endif
+
+
+namespace blast :: benchmark
+{
+    /**
+     * @brief Settings of the latency benchmarks, selected by the --latency_* command line options.
+     */
+    struct LatencyOptions
+    {
+        /// @brief Number of timed calls of every benchmark.
+        std::size_t samples = 10000;
+
+        /// @brief Number of untimed calls before the timed ones.
+        std::size_t warmup = 100;
+
+        /// @brief Number of histogram bins.
+        std::size_t bins = 50;
+
+        /// @brief Timer, "clock" for clock_gettime(CLOCK_MONOTONIC_RAW) or "tsc" for the x86 time stamp counter.
+        std::string timer = "clock";
+
+        /// @brief CPU to pin the process to.
+        std::optional<int> cpu;
+
+        /// @brief SCHED_FIFO priority to request.
+        std::optional<int> fifoPriority;
+
+        /// @brief Regular expression selecting the benchmarks to run; all if empty.
+        std::string filter;
+
+        /// @brief JSON output file; no JSON output if empty.
+        std::string out;
+    };
+
+
+    namespace detail
+    {
+        extern bool latencyTsc;
+    }
+
+
+    /**
+     * @brief Current value of the latency timer, in ticks.
+     *
+     * The ticks are nanoseconds for the "clock" timer and TSC cycles for the "tsc" timer.
+     */
+    inline std::uint64_t latencyTicks() noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        if (detail::latencyTsc)
+        {
+            // The fences keep the measured code from being reordered around rdtsc
+            _mm_lfence();
+            std::uint64_t const t = __rdtsc();
+            _mm_lfence();
+            return t;
+        }
+#endif
+
+        timespec ts;
+        clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+        return std::uint64_t(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+    }
+
+
+    /**
+     * @brief Distribution of the latencies of a benchmark, in nanoseconds.
+     */
+    struct LatencyStatistics
+    {
+        std::size_t samples = 0;
+        double min = 0.;
+        double mean = 0.;
+        double p50 = 0.;
+        double p99 = 0.;
+        double p999 = 0.;
+        double max = 0.;
+
+        /// @brief Lower bound of the first histogram bin.
+        double histogramMin = 0.;
+
+        /// @brief Width of a histogram bin.
+        double binWidth = 0.;
+
+        /// @brief Number of samples in every bin; the last bin includes the maximum.
+        std::vector<std::size_t> histogram;
+    };
+
+
+    /**
+     * @brief Compute the percentiles and the histogram of latency samples.
+     *
+     * Percentiles use the nearest-rank definition.
+     *
+     * @param samples latencies in nanoseconds
+     * @param bins number of histogram bins between the minimum and the maximum
+     */
+    LatencyStatistics latencyStatistics(std::vector<double> samples, std::size_t bins);
+
+
+    /**
+     * @brief Arguments and timing of one latency benchmark run.
+     */
+    class LatencyState
+    {
+    public:
+        LatencyState(std::vector<long> const& args, LatencyOptions const& options);
+
+
+        /// @brief Argument of the benchmark, as in Google Benchmark.
+        long range(std::size_t i = 0) const
+        {
+            return args_.at(i);
+        }
+
+
+        /**
+         * @brief Time every call of a function individually.
+         *
+         * Before every call, the operands are brought into the state selected by @a cacheMode().
+         *
+         * @param f benchmarked function
+         * @param operands matrices, vectors or scalars used by @a f
+         */
+        template <typename F, typename... Operands>
+        void measure(F f, Operands const&... operands)
+        {
+            measureWithSetup([] {}, f, operands...);
+        }
+
+
+        /**
+         * @brief Time every call of a function individually, with an untimed setup before every call.
+         *
+         * @param setup function restoring the input of @a f, e.g. copying a matrix which @a f overwrites
+         * @param f benchmarked function
+         * @param operands matrices, vectors or scalars used by @a f
+         */
+        template <typename Setup, typename F, typename... Operands>
+        void measureWithSetup(Setup setup, F f, Operands const&... operands)
+        {
+            ticks_.clear();
+            ticks_.reserve(samples_);
+
+            for (std::size_t i = 0; i < warmup_ + samples_; ++i)
+            {
+                setup();
+                prepareOperands(operands...);
+
+                std::uint64_t const t0 = latencyTicks();
+                f();
+                std::uint64_t const t1 = latencyTicks();
+
+                if (i >= warmup_)
+                    ticks_.push_back(t1 - t0);
+            }
+        }
+
+
+        /// @brief Latencies of the timed calls, in nanoseconds.
+        std::vector<double> latencies() const;
+
+    private:
+        std::vector<long> args_;
+        std::size_t samples_;
+        std::size_t warmup_;
+        std::vector<std::uint64_t> ticks_;
+    };
+
+
+    using LatencyFunction = void (*)(LatencyState&);
+
+
+    /**
+     * @brief A registered latency benchmark and its argument sets.
+     */
+    class LatencyBenchmark
+    {
+    public:
+        LatencyBenchmark(std::string name, LatencyFunction function);
+
+        LatencyBenchmark * Arg(long x);
+        LatencyBenchmark * Args(std::vector<long> const& args);
+        LatencyBenchmark * DenseRange(long start, long limit, long step = 1);
+        LatencyBenchmark * Apply(void (*f)(LatencyBenchmark *));
+
+        std::string const& name() const noexcept
+        {
+            return name_;
+        }
+
+        LatencyFunction function() const noexcept
+        {
+            return function_;
+        }
+
+        /// @brief Argument sets; a single empty one if no arguments were given.
+        std::vector<std::vector<long>> argumentSets() const;
+
+    private:
+        std::string name_;
+        LatencyFunction function_;
+        std::vector<std::vector<long>> args_;
+    };
+
+
+    /**
+     * @brief Matrix sizes of the latency benchmarks, typical for real-time optimal control.
+     */
+    void latencyArguments(LatencyBenchmark * b);
+
+
+    /**
+     * @brief Register a latency benchmark; use @a BLAST_LATENCY_BENCHMARK instead.
+     */
+    LatencyBenchmark * registerLatencyBenchmark(std::string name, LatencyFunction function);
+
+
+    /**
+     * @brief Run the registered latency benchmarks.
+     *
+     * Pins the process and requests the real-time scheduling policy if the options say so;
+     * failures to do so are reported on stderr and do not stop the benchmarks.
+     * Prints a summary table to stdout and writes the statistics and histograms to the JSON output file.
+     *
+     * @param options latency benchmark settings
+     * @param executable name of the executable, recorded in the JSON output
+     *
+     * @return process exit code
+     */
+    int runLatencyBenchmarks(LatencyOptions const& options, std::string const& executable);
+}
+
+
+#define BLAST_LATENCY_CONCAT_IMPL(a, b) a ## b
+#define BLAST_LATENCY_CONCAT(a, b) BLAST_LATENCY_CONCAT_IMPL(a, b)
+
+/// @brief Register a latency benchmark function, analogous to BENCHMARK().
+#define BLAST_LATENCY_BENCHMARK(...) \
+    static ::blast::benchmark::LatencyBenchmark * BLAST_LATENCY_CONCAT(latency_benchmark_, __COUNTER__) [[maybe_unused]] = \
+        ::blast::benchmark::registerLatencyBenchmark(#__VA_ARGS__, __VA_ARGS__)
@@ -0,0 +1,58 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+
+namespace blast :: benchmark
+{
+    /**
+     * @brief Run the registered benchmarks with BLAST-specific command line options.
+     *
+     * Accepts all Google Benchmark options and, in addition:
+     *
+     * --perf_counters[=<event>,...]
+     *      Attach hardware performance counters to the results,
+     *      normalized per iteration. Without a value, all supported events are counted.
+     *      See @a PerfCounters for the supported events.
+     *
+     * --tile_stats
+     *      Attach the tile statistics of blast/util/TileStats.hpp to the results, normalized per iteration.
+     *      The statistics are only recorded by the code compiled with BLAST_TILE_STATS.
+     *
+     * --cache_mode=hot|l2|cold
+     *      Cache state of the operands at the start of every iteration, see @a CacheMode.
+     *
+     * --peak_context
+     *      Record the calibrated peak performance and memory bandwidth, see @a peakFlops() and @a peakBandwidth(),
+     *      in the context of the results. Without this option, only the peak performance of the precision
+     *      of a benchmark is calibrated, when the benchmark first reports the "peak" counter.
+     *
+     * --latency
+     *      Instead of the Google Benchmark benchmarks, run the latency benchmarks
+     *      registered with @a BLAST_LATENCY_BENCHMARK, timing every call individually.
+     *      The following options are only used with --latency, see @a LatencyOptions:
+     *
+     *      --latency_samples=<n>, --latency_warmup=<n>, --latency_bins=<n>
+     *      --latency_timer=clock|tsc
+     *      --latency_cpu=<cpu>         pin the process to a CPU
+     *      --latency_fifo[=<priority>] request the SCHED_FIFO scheduling policy
+     *      --latency_filter=<regex>
+     *      --latency_out=<file>        write the percentiles and histograms to a JSON file
+     *
+     * @return process exit code
+     */
+    int runBenchmarks(int argc, char ** argv);
+}
+
+
+/// @brief Replacement for BENCHMARK_MAIN() that calls @a blast::benchmark::runBenchmarks().
+#define BLAST_BENCHMARK_MAIN() \
+    int main(int argc, char ** argv) \
+    { \
+        return ::blast::benchmark::runBenchmarks(argc, argv); \
+    } \
+    int main(int, char **)
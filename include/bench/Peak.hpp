@@ -0,0 +1,29 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+
+namespace blast :: benchmark
+{
+    /**
+     * @brief Calibrated peak floating-point performance of one core, in FLOP/s.
+     *
+     * The peak is 2 * (number of FMA units) * SimdSize_v<Real> * (clock frequency).
+     * Rather than relying on nominal values, it is measured on the first call by a micro-benchmark
+     * which runs enough independent SIMD FMA chains to saturate the FMA units.
+     *
+     * @tparam Real floating point type, float or double
+     */
+    template <typename Real>
+    double peakFlops();
+
+
+    /**
+     * @brief Calibrated main memory read bandwidth of one core, in bytes/s.
+     *
+     * Measured on the first call by streaming over an array much larger than the last level cache.
+     */
+    double peakBandwidth();
+}
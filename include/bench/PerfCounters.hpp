@@ -0,0 +1,106 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+
+namespace blast :: benchmark
+{
+    /**
+     * @brief Hardware performance counters based on Linux perf_event_open()
+     *
+     * Each event is opened as a separate counter, so that the kernel can multiplex them
+     * if there are not enough hardware counters; the values are scaled accordingly.
+     * Events which cannot be opened (e.g. in a container, with a restrictive perf_event_paranoid setting,
+     * or on a CPU which does not support them) are reported as unavailable.
+     *
+     * Supported event names:
+     * - "cycles": CPU cycles
+     * - "instructions": retired instructions
+     * - "l1d_misses": L1 data cache read misses
+     * - "l2_misses": L2 cache misses (Intel only)
+     * - "fp_arith": retired floating-point operations, SIMD lanes and FMA counted separately (Intel only)
+     */
+    class PerfCounters
+    {
+    public:
+        /**
+         * @brief Opens counters for the specified events.
+         *
+         * @param events event names
+         *
+         * @throw std::invalid_argument if an event name is not supported
+         */
+        explicit PerfCounters(std::vector<std::string> const& events);
+
+        PerfCounters(PerfCounters const&) = delete;
+        ~PerfCounters();
+
+        PerfCounters& operator=(PerfCounters const&) = delete;
+
+
+        /**
+         * @brief Names of all supported events.
+         */
+        static std::vector<std::string> const& supportedEvents();
+
+
+        /**
+         * @brief Event names, in the order in which they were passed to the constructor.
+         */
+        std::vector<std::string> const& events() const noexcept
+        {
+            return names_;
+        }
+
+
+        /**
+         * @brief Whether the i-th event could be opened.
+         */
+        bool available(std::size_t i) const noexcept;
+
+
+        /**
+         * @brief Whether any of the events could be opened.
+         */
+        bool anyAvailable() const noexcept;
+
+
+        /**
+         * @brief Reset and start counting.
+         */
+        void start();
+
+
+        /**
+         * @brief Stop counting.
+         */
+        void stop();
+
+
+        /**
+         * @brief Read the counted values.
+         *
+         * @return counted values in the order of @a events(), empty for the events that are not available.
+         */
+        std::vector<std::optional<double>> read() const;
+
+    private:
+        struct Counter
+        {
+            // File descriptors of the opened events. An event can consist of several
+            // weighted hardware events, e.g. "fp_arith" counts scalar and SIMD instructions separately.
+            std::vector<int> fd;
+            std::vector<double> weight;
+        };
+
+        std::vector<std::string> names_;
+        std::vector<Counter> counters_;
+    };
+}
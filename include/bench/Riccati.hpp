@@ -0,0 +1,187 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <bench/Benchmark.hpp>
+#include <bench/Complexity.hpp>
+#include <bench/Gemm.hpp>
+#include <bench/Syrk.hpp>
+#include <bench/Trmm.hpp>
+#include <bench/Trsm.hpp>
+
+#include <blast/math/algorithm/Randomize.hpp>
+
+#include <blaze/Math.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * @file
+ * @brief End-to-end benchmark of the Riccati recursion of an interior-point MPC iteration.
+ *
+ * The optimal control problem has N stages with nx states, nu inputs and nc = nx + nu box constraints
+ * on the states and inputs of every stage. One iteration of an interior-point method factorizes the KKT system
+ * with the factorized (square-root) Riccati recursion, starting from L_N = chol(Q_N), for k = N-1, ..., 0:
+ *
+ *      RSQ_k = RSQ0_k + CtD_k * Ct_k^T     gemm, the Hessian with the barrier term; CtD_k = Ct_k * diag(d_k)
+ *      U = BAt_k * L_{k+1}                 trmm, BAt_k = [B_k A_k]^T, L_{k+1} lower triangular
+ *      H = RSQ_k + U * U^T                 syrk, lower triangle
+ *      LH_k = chol(H)                      potrf, L_k is the lower-right nx x nx block of LH_k
+ *
+ * and then recovers the feedback gain of the first stage from LH_0 = [Lu 0; Lxu L_0]:
+ *
+ *      W = Lu^{-1}                         trsm
+ *      K^T = -Lxu * W                      trmm
+ *
+ * Each library implements the sequence with its own matrices as a workload class template,
+ * constructed from @a RiccatiData and called once per benchmark iteration.
+ * The benchmark time is the time of a whole iteration, including the effects between the calls,
+ * such as the cache state and partial tiles at odd sizes; @a --cache_mode does not apply.
+ */
+
+
+namespace blast :: benchmark
+{
+    struct RiccatiTag {};
+    static RiccatiTag constexpr riccatiTag;
+
+
+    /**
+     * @brief Algorithmic complexity of one Riccati iteration, the sum of the complexities of the calls.
+     *
+     * @param nx number of states
+     * @param nu number of inputs
+     * @param nc number of constraints per stage
+     * @param N number of stages
+     *
+     * @return Complexity
+     */
+    inline Complexity complexity(RiccatiTag, std::size_t nx, std::size_t nu, std::size_t nc, std::size_t N)
+    {
+        std::size_t const nux = nu + nx;
+        Complexity c = complexityPotrf(nx, nx);
+
+        addComplexity(c, complexityGemm(nux, nux, nc), N);
+        // U = BAt * L is the transpose of the left product L^T * BAt^T
+        addComplexity(c, complexity(trmmTag, nx, nux), N);
+        addComplexity(c, complexitySyrk(nux, nx), N);
+        addComplexity(c, complexityPotrf(nux, nux), N);
+        addComplexity(c, complexity(trsmTag, false, nu, nu));
+        addComplexity(c, complexity(trmmTag, nu, nx));
+
+        return c;
+    }
+
+
+    /**
+     * @brief Problem data of a Riccati benchmark, the same for all libraries.
+     *
+     * The dynamics are scaled to be stable, so that the cost-to-go stays bounded over long horizons.
+     */
+    template <typename Real>
+    struct RiccatiData
+    {
+        using Matrix = blaze::DynamicMatrix<Real, blaze::columnMajor>;
+
+
+        RiccatiData(std::size_t nx, std::size_t nu, std::size_t N)
+        :   nx {nx}
+        ,   nu {nu}
+        ,   nc {nx + nu}
+        ,   N {N}
+        ,   QN(nx, nx)
+        {
+            std::size_t const nux = nu + nx;
+            makePositiveDefinite(QN);
+
+            for (std::size_t k = 0; k < N; ++k)
+            {
+                Matrix ba(nux, nx), rsq(nux, nux), ct(nux, nc);
+                randomize(ba);
+                ba /= Real(nux);
+                makePositiveDefinite(rsq);
+                randomize(ct);
+
+                Matrix ctd = ct;
+                for (std::size_t j = 0; j < nc; ++j)
+                {
+                    Real d;
+                    randomize(d);
+                    column(ctd, j) *= Real(0.5) + d;
+                }
+
+                BAt.push_back(ba);
+                RSQ0.push_back(rsq);
+                Ct.push_back(ct);
+                CtD.push_back(ctd);
+            }
+        }
+
+
+        std::size_t const nx;
+        std::size_t const nu;
+        std::size_t const nc;
+        std::size_t const N;
+
+        /// @brief [B_k A_k]^T, (nu + nx) x nx
+        std::vector<Matrix> BAt;
+
+        /// @brief Hessian of the cost [R_k S_k; S_k^T Q_k], (nu + nx) x (nu + nx)
+        std::vector<Matrix> RSQ0;
+
+        /// @brief Transposed constraint matrices, (nu + nx) x nc
+        std::vector<Matrix> Ct;
+
+        /// @brief Ct_k * diag(d_k) with the barrier weights d_k, (nu + nx) x nc
+        std::vector<Matrix> CtD;
+
+        /// @brief Terminal cost, nx x nx
+        Matrix QN;
+    };
+
+
+    /**
+     * @brief Benchmark of one Riccati iteration.
+     *
+     * The benchmark arguments are nx, nu and N, see @a riccatiArguments().
+     *
+     * @tparam Workload class template implementing the iteration for a library,
+     *  constructible from RiccatiData<Real> const& and callable without arguments.
+     */
+    template <template <typename> typename Workload, typename Real>
+    inline void benchmarkRiccati(State& state)
+    {
+        std::size_t const nx = state.range(0);
+        std::size_t const nu = state.range(1);
+        std::size_t const N = state.range(2);
+
+        RiccatiData<Real> const data(nx, nu, N);
+        Workload<Real> riccati(data);
+
+        for (auto _ : state)
+        {
+            riccati();
+            DoNotOptimize(riccati);
+        }
+
+        setCounters<Real>(state.counters, complexity(riccatiTag, nx, nu, data.nc, N));
+        state.counters["nx"] = nx;
+        state.counters["nu"] = nu;
+        state.counters["N"] = N;
+    }
+
+
+    /**
+     * @brief Benchmark arguments {nx, nu, N} of the Riccati benchmarks.
+     *
+     * The default sizes range from small embedded problems to large ones.
+     * They are replaced by the sizes in the BLAST_BENCHMARK_RICCATI environment variable, if it is set,
+     * a list of "nx,nu,N" triples separated by spaces or semicolons, e.g. "12,4,30; 30,10,50".
+     */
+    void riccatiArguments(::benchmark::internal::Benchmark * b);
+}
@@ -0,0 +1,410 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <bench/Benchmark.hpp>
+#include <bench/CacheMode.hpp>
+#include <bench/Complexity.hpp>
+#include <bench/Gemm.hpp>
+#include <bench/Iamax.hpp>
+#include <bench/Shapes.hpp>
+#include <bench/Syrk.hpp>
+#include <bench/Trmm.hpp>
+#include <bench/Trmv.hpp>
+#include <bench/Trsm.hpp>
+
+#include <blast/math/algorithm/Randomize.hpp>
+
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+
+#include <algorithm>
+#include <exception>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+
+/**
+ * @file
+ * @brief Benchmark definitions shared by all libraries.
+ *
+ * There is one benchmark template per routine. A library plugs in with a backend adapter,
+ * a class with static functions which:
+ *
+ * - copy the input data into the library's own matrix and vector types:
+ *
+ *      matrix(blaze::DynamicMatrix<Real, columnMajor> const&)
+ *      vector(blaze::DynamicVector<Real> const&)
+ *
+ * - prepare a call of a routine and return it as a function object,
+ *   so that per-call setup such as kernel generation stays out of the timed loop:
+ *
+ *      gemm(m, n, k, A, B, C, D)   D = C + A * B^T; A is m x k, B is n x k
+ *      syrk(m, k, A, C, D)         lower(D) = lower(C + A * A^T); A is m x k
+ *      trmm(m, n, A, B, C)         C = upper(A) * B; A is m x m, B is m x n
+ *      trsm(m, n, A, B, X)         X = upper(A)^{-1} * B; A is m x m, B is m x n
+ *      potrf(m, A, L)              L * L^T = A, L lower triangular
+ *      getrf(m, n, A)              A = P * L * U, in place
+ *      trmv(m, A, x, y)            y = upper(A) * x
+ *      iamax(n, x)                 index of the element of x with the largest absolute value
+ *
+ * Only the routines which the adapter provides are registered, by @a BLAST_ROUTINE_BENCHMARKS.
+ * The input data, the shapes and the counters are the same for every library.
+ */
+
+
+namespace blast :: benchmark
+{
+    namespace detail
+    {
+        template <typename Real>
+        using InputMatrix = blaze::DynamicMatrix<Real, blaze::columnMajor>;
+
+
+        template <typename Real>
+        using InputVector = blaze::DynamicVector<Real>;
+
+
+        template <typename Backend, typename Real>
+        using BackendMatrix = decltype(Backend::matrix(std::declval<InputMatrix<Real> const&>()));
+
+
+        template <typename Backend, typename Real>
+        using BackendVector = decltype(Backend::vector(std::declval<InputVector<Real> const&>()));
+
+
+        template <typename Real>
+        inline InputMatrix<Real> randomMatrix(size_t m, size_t n)
+        {
+            InputMatrix<Real> A(m, n);
+            randomize(A);
+            return A;
+        }
+
+
+        template <typename Real>
+        inline InputVector<Real> randomVector(size_t n)
+        {
+            InputVector<Real> x(n);
+            randomize(x);
+            return x;
+        }
+
+
+        template <typename Real>
+        inline InputMatrix<Real> zeroMatrix(size_t m, size_t n)
+        {
+            return InputMatrix<Real>(m, n, Real(0.));
+        }
+
+
+        /// @brief Random well-conditioned upper triangular matrix, with zeros below the diagonal.
+        template <typename Real>
+        inline InputMatrix<Real> upperMatrix(size_t m)
+        {
+            InputMatrix<Real> A = randomMatrix<Real>(m, m);
+
+            for (size_t j = 0; j < m; ++j)
+            {
+                A(j, j) += m;
+
+                for (size_t i = j + 1; i < m; ++i)
+                    A(i, j) = 0.;
+            }
+
+            return A;
+        }
+
+
+        /// @brief Rectangular identity matrix, which LU factorization without pivoting does not change.
+        template <typename Real>
+        inline InputMatrix<Real> identityMatrix(size_t m, size_t n)
+        {
+            InputMatrix<Real> A = zeroMatrix<Real>(m, n);
+
+            for (size_t i = 0; i < std::min(m, n); ++i)
+                A(i, i) = 1.;
+
+            return A;
+        }
+    }
+
+
+    template <typename Backend, typename Real>
+    inline void benchmarkGemm(State& state)
+    {
+        size_t const m = state.range(0);
+        size_t const n = state.range(1);
+        size_t const k = state.range(2);
+
+        auto A = Backend::matrix(detail::randomMatrix<Real>(m, k));
+        auto B = Backend::matrix(detail::randomMatrix<Real>(n, k));
+        auto C = Backend::matrix(detail::randomMatrix<Real>(m, n));
+        auto D = Backend::matrix(detail::zeroMatrix<Real>(m, n));
+        auto gemm = Backend::gemm(m, n, k, A, B, C, D);
+
+        for (auto _ : state)
+        {
+            prepareCache(state, A, B, C, D);
+            gemm();
+            DoNotOptimize(A);
+            DoNotOptimize(B);
+            DoNotOptimize(C);
+            DoNotOptimize(D);
+        }
+
+        setCounters<Real>(state.counters, complexityGemm(m, n, k));
+        state.counters["m"] = m;
+        state.counters["n"] = n;
+        state.counters["k"] = k;
+    }
+
+
+    template <typename Backend, typename Real>
+    inline void benchmarkSyrk(State& state)
+    {
+        size_t const m = state.range(0);
+        size_t const k = state.range(1);
+
+        detail::InputMatrix<Real> C0(m, m);
+        makeSymmetric(C0);
+
+        auto A = Backend::matrix(detail::randomMatrix<Real>(m, k));
+        auto C = Backend::matrix(C0);
+        auto D = Backend::matrix(detail::zeroMatrix<Real>(m, m));
+        auto syrk = Backend::syrk(m, k, A, C, D);
+
+        for (auto _ : state)
+        {
+            prepareCache(state, A, C, D);
+            syrk();
+            DoNotOptimize(A);
+            DoNotOptimize(C);
+            DoNotOptimize(D);
+        }
+
+        setCounters<Real>(state.counters, complexitySyrk(m, k));
+        state.counters["m"] = m;
+        state.counters["k"] = k;
+    }
+
+
+    template <typename Backend, typename Real>
+    inline void benchmarkTrmm(State& state)
+    {
+        size_t const m = state.range(0);
+        size_t const n = state.range(1);
+
+        auto A = Backend::matrix(detail::upperMatrix<Real>(m));
+        auto B = Backend::matrix(detail::randomMatrix<Real>(m, n));
+        auto C = Backend::matrix(detail::zeroMatrix<Real>(m, n));
+        auto trmm = Backend::trmm(m, n, A, B, C);
+
+        for (auto _ : state)
+        {
+            prepareCache(state, A, B, C);
+            trmm();
+            DoNotOptimize(A);
+            DoNotOptimize(B);
+            DoNotOptimize(C);
+        }
+
+        setCounters<Real>(state.counters, complexity(trmmTag, m, n));
+        state.counters["m"] = m;
+        state.counters["n"] = n;
+    }
+
+
+    template <typename Backend, typename Real>
+    inline void benchmarkTrsm(State& state)
+    {
+        size_t const m = state.range(0);
+        size_t const n = state.range(1);
+
+        auto A = Backend::matrix(detail::upperMatrix<Real>(m));
+        auto B = Backend::matrix(detail::randomMatrix<Real>(m, n));
+        auto X = Backend::matrix(detail::zeroMatrix<Real>(m, n));
+        auto trsm = Backend::trsm(m, n, A, B, X);
+
+        for (auto _ : state)
+        {
+            prepareCache(state, A, B, X);
+            trsm();
+            DoNotOptimize(A);
+            DoNotOptimize(B);
+            DoNotOptimize(X);
+        }
+
+        setCounters<Real>(state.counters, complexity(trsmTag, false, m, n));
+        state.counters["m"] = m;
+        state.counters["n"] = n;
+    }
+
+
+    template <typename Backend, typename Real>
+    inline void benchmarkPotrf(State& state)
+    {
+        size_t const m = state.range(0);
+
+        detail::InputMatrix<Real> A0(m, m);
+        makePositiveDefinite(A0);
+
+        auto A = Backend::matrix(A0);
+        auto L = Backend::matrix(detail::zeroMatrix<Real>(m, m));
+        auto potrf = Backend::potrf(m, A, L);
+
+        for (auto _ : state)
+        {
+            prepareCache(state, A, L);
+            potrf();
+            DoNotOptimize(A);
+            DoNotOptimize(L);
+        }
+
+        setCounters<Real>(state.counters, complexityPotrf(m, m));
+        state.counters["m"] = m;
+    }
+
+
+    /// @brief Best case, see BM_getrf_static_plain_best_case: the identity input needs no pivoting and does not change.
+    template <typename Backend, typename Real>
+    inline void benchmarkGetrf(State& state)
+    {
+        size_t const m = state.range(0);
+        size_t const n = Backend::rectangularGetrf ? state.range(1) : m;
+
+        auto A = Backend::matrix(detail::identityMatrix<Real>(m, n));
+        auto getrf = Backend::getrf(m, n, A);
+
+        for (auto _ : state)
+        {
+            prepareCache(state, A);
+            getrf();
+            DoNotOptimize(A);
+        }
+
+        setCounters<Real>(state.counters, complexityGetrf(m, n));
+        state.counters["m"] = m;
+        state.counters["n"] = n;
+    }
+
+
+    template <typename Backend, typename Real>
+    inline void benchmarkTrmv(State& state)
+    {
+        size_t const m = state.range(0);
+
+        auto A = Backend::matrix(detail::upperMatrix<Real>(m));
+        auto x = Backend::vector(detail::randomVector<Real>(m));
+        auto y = Backend::vector(detail::InputVector<Real>(m, Real(0.)));
+        auto trmv = Backend::trmv(m, A, x, y);
+
+        for (auto _ : state)
+        {
+            prepareCache(state, A, x, y);
+            trmv();
+            DoNotOptimize(A);
+            DoNotOptimize(x);
+            DoNotOptimize(y);
+        }
+
+        setCounters<Real>(state.counters, complexity(trmvTag, m));
+        state.counters["m"] = m;
+    }
+
+
+    template <typename Backend, typename Real>
+    inline void benchmarkIamax(State& state)
+    {
+        size_t const n = state.range(0);
+
+        auto x = Backend::vector(detail::randomVector<Real>(n));
+        auto iamax = Backend::iamax(n, x);
+
+        for (auto _ : state)
+        {
+            prepareCache(state, x);
+            size_t const idx = iamax();
+            DoNotOptimize(idx);
+        }
+
+        setCounters<Real>(state.counters, complexity(iamaxTag, n));
+        state.counters["n"] = n;
+    }
+
+
+    /**
+     * @brief Register the benchmarks of the routines provided by a backend adapter.
+     *
+     * The benchmarks are named BM_<routine>_shapes<Real>, the same for every library,
+     * and use the shapes of @a benchmarkShapes(). An exception thrown by the adapter,
+     * e.g. when it cannot generate a kernel for a shape, skips the benchmark with an error.
+     *
+     * @return true
+     */
+    template <typename Backend, typename Real>
+    inline bool registerRoutineBenchmarks()
+    {
+        using MatrixType = detail::BackendMatrix<Backend, Real>;
+        std::string const suffix = std::string("_shapes<") + (std::is_same_v<Real, float> ? "float" : "double") + ">";
+
+        auto const add = [&suffix] (char const * routine, void (*f)(State&), void (*args)(::benchmark::internal::Benchmark *))
+        {
+            RegisterBenchmark((std::string("BM_") + routine + suffix).c_str(), [f] (State& state)
+            {
+                try
+                {
+                    f(state);
+                }
+                catch (std::exception const& e)
+                {
+                    state.SkipWithError(e.what());
+                }
+            })->Apply(args);
+        };
+
+        if constexpr (requires (MatrixType& A) { Backend::gemm(size_t {}, size_t {}, size_t {}, A, A, A, A); })
+            add("gemm", benchmarkGemm<Backend, Real>, gemmShapeArguments);
+
+        if constexpr (requires (MatrixType& A) { Backend::syrk(size_t {}, size_t {}, A, A, A); })
+            add("syrk", benchmarkSyrk<Backend, Real>, syrkShapeArguments);
+
+        if constexpr (requires (MatrixType& A) { Backend::trmm(size_t {}, size_t {}, A, A, A); })
+            add("trmm", benchmarkTrmm<Backend, Real>, rectangularShapeArguments);
+
+        if constexpr (requires (MatrixType& A) { Backend::trsm(size_t {}, size_t {}, A, A, A); })
+            add("trsm", benchmarkTrsm<Backend, Real>, rectangularShapeArguments);
+
+        if constexpr (requires (MatrixType& A) { Backend::potrf(size_t {}, A, A); })
+            add("potrf", benchmarkPotrf<Backend, Real>, squareShapeArguments);
+
+        if constexpr (requires (MatrixType& A) { Backend::getrf(size_t {}, size_t {}, A); })
+            add("getrf", benchmarkGetrf<Backend, Real>,
+                Backend::rectangularGetrf ? rectangularShapeArguments : squareShapeArguments);
+
+        if constexpr (requires { typename detail::BackendVector<Backend, Real>; })
+        {
+            using VectorType = detail::BackendVector<Backend, Real>;
+
+            if constexpr (requires (MatrixType& A, VectorType& x) { Backend::trmv(size_t {}, A, x, x); })
+                add("trmv", benchmarkTrmv<Backend, Real>, squareShapeArguments);
+
+            if constexpr (requires (VectorType& x) { Backend::iamax(size_t {}, x); })
+                add("iamax", benchmarkIamax<Backend, Real>, squareShapeArguments);
+        }
+
+        return true;
+    }
+}
+
+
+#define BLAST_ROUTINE_BENCHMARKS_CONCAT_IMPL(a, b) a ## b
+#define BLAST_ROUTINE_BENCHMARKS_CONCAT(a, b) BLAST_ROUTINE_BENCHMARKS_CONCAT_IMPL(a, b)
+
+/// @brief Register the benchmarks of all routines provided by a backend adapter, see bench/Routines.hpp.
+#define BLAST_ROUTINE_BENCHMARKS(Backend, Real) \
+    static bool const BLAST_ROUTINE_BENCHMARKS_CONCAT(routine_benchmarks_, __COUNTER__) [[maybe_unused]] = \
+        ::blast::benchmark::registerRoutineBenchmarks<Backend, Real>()
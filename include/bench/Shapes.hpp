@@ -0,0 +1,110 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace blast :: benchmark
+{
+    /**
+     * @brief Problem shape of a level-3 routine.
+     *
+     * For gemm, C(m x n) = A(m x k) * B(k x n). Routines with fewer dimensions use a subset:
+     * syrk uses (m, k), trmm, trsm and getrf use (m, n), and potrf uses m.
+     */
+    struct Shape
+    {
+        std::size_t m;
+        std::size_t n;
+        std::size_t k;
+
+        bool operator==(Shape const&) const = default;
+    };
+
+
+    /**
+     * @brief Aspect-ratio family of shapes with one small and two large dimensions, or all equal ones.
+     */
+    enum class ShapeFamily
+    {
+        /// @brief m = n = k
+        square,
+
+        /// @brief Small n, e.g. 200 x 8 x 200
+        tallSkinny,
+
+        /// @brief Small m, e.g. 8 x 200 x 200
+        shortWide,
+
+        /// @brief Small k, a rank-k update, e.g. 200 x 200 x 8
+        rankK
+    };
+
+
+    /**
+     * @brief All combinations of the given m, n and k values.
+     */
+    std::vector<Shape> shapeGrid(std::vector<std::size_t> const& m,
+        std::vector<std::size_t> const& n, std::vector<std::size_t> const& k);
+
+
+    /**
+     * @brief Shapes of an aspect-ratio family for all combinations of the large and small dimensions.
+     *
+     * For the square family, the small dimensions are ignored.
+     */
+    std::vector<Shape> shapeFamily(ShapeFamily family,
+        std::vector<std::size_t> const& large, std::vector<std::size_t> const& small);
+
+
+    /**
+     * @brief Read problem shapes from a CSV file.
+     *
+     * Every line contains "m[,n[,k]]"; missing dimensions are equal to m.
+     * Empty lines, lines starting with '#' and a non-numeric header line are skipped.
+     *
+     * @throw std::runtime_error if the file cannot be read or a line is invalid
+     */
+    std::vector<Shape> readShapes(std::string const& fileName);
+
+
+    /**
+     * @brief Shapes of the shape-sweep benchmarks.
+     *
+     * If the BLAST_BENCHMARK_SHAPES environment variable is set, the shapes are read from
+     * the CSV file it names, which allows replaying the shapes of a real problem.
+     * Otherwise, it is a 3-D grid of small sizes plus the tall-skinny, short-wide and rank-k families.
+     */
+    std::vector<Shape> const& benchmarkShapes();
+
+
+    /**
+     * @brief Add the distinct projections of @a benchmarkShapes() to the benchmark arguments.
+     *
+     * @param b benchmark
+     * @param dims dimensions used by the benchmark and their order, e.g. "mk" for syrk
+     */
+    void shapeArguments(::benchmark::internal::Benchmark * b, std::string_view dims);
+
+
+    /// @brief Shape-sweep arguments (m, n, k) of gemm.
+    void gemmShapeArguments(::benchmark::internal::Benchmark * b);
+
+    /// @brief Shape-sweep arguments (m, k) of syrk.
+    void syrkShapeArguments(::benchmark::internal::Benchmark * b);
+
+    /// @brief Shape-sweep arguments (m, n) of trmm, trsm and getrf.
+    void rectangularShapeArguments(::benchmark::internal::Benchmark * b);
+
+    /// @brief Shape-sweep arguments (m) of potrf and of routines for square matrices only.
+    void squareShapeArguments(::benchmark::internal::Benchmark * b);
+}
@@ -5,3 +5,34 @@
 #pragma once
 
 #define BENCHMARK_MAX_TRMM 50
+
+#include <bench/Complexity.hpp>
+
+
+namespace blast :: benchmark
+{
+    struct TrmmTag {};
+    static TrmmTag constexpr trmmTag;
+
+
+    /**
+     * @brief Algorithmic complexity of triangular matrix multiplication.
+     *
+     * @param m number of rows and columns in the triangular matrix
+     * @param n number of columns in the second matrix
+     *
+     * @return Complexity
+     */
+    inline Complexity complexity(TrmmTag, size_t m, size_t n)
+    {
+        return {
+            // Calculated as \sum_{j=0}^{n-1} \sum _{k=0}^{m-1} \sum _{i=0}^{k-1} 1
+            {"add", ((m * m - m) / 2) * n},
+            // Calculated as \sum_{j=0}^{n-1} \sum _{k=0}^{m-1} \sum _{i=0}^{k} 1
+            {"mul", ((m * m + m) / 2) * n},
+            // Triangle of the m x m matrix, the second matrix and the result
+            {"load", m * (m + 1) / 2 + m * n},
+            {"store", m * n}
+        };
+    }
+}
@@ -0,0 +1,35 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <bench/Complexity.hpp>
+
+
+namespace blast :: benchmark
+{
+    struct TrmvTag {};
+    static TrmvTag constexpr trmvTag;
+
+
+    /**
+     * @brief Algorithmic complexity of triangular matrix-vector multiplication.
+     *
+     * @param m number of rows and columns in the triangular matrix
+     *
+     * @return Complexity
+     */
+    inline Complexity complexity(TrmvTag, size_t m)
+    {
+        return {
+            // Calculated as \sum _{k=0}^{m-1} \sum _{i=0}^{k-1} 1
+            {"add", (m * m - m) / 2},
+            // Calculated as \sum _{k=0}^{m-1} \sum _{i=0}^{k} 1
+            {"mul", (m * m + m) / 2},
+            // Triangle of the matrix, the vector and the result
+            {"load", m * (m + 1) / 2 + m},
+            {"store", m}
+        };
+    }
+}
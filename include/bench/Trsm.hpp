@@ -31,7 +31,10 @@ namespace blast :: benchmark
         return {
             {"add", ((m * m - m) / 2) * n},
             {"mul", ((m * m - m) / 2) * n},
-            {"div", unit ? 0 : m}
+            {"div", unit ? 0 : m},
+            // Triangle of the m x m matrix, the right-hand side and the result
+            {"load", m * (m + 1) / 2 + m * n},
+            {"store", m * n}
         };
     }
 }
\ No newline at end of file
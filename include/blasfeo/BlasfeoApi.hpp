@@ -13,5 +13,7 @@
 #include "blasfeo_api/Syrk.hpp"
 #include "blasfeo_api/SyrkPotrf.hpp"
 #include "blasfeo_api/Trmm.hpp"
+#include "blasfeo_api/Trsm.hpp"
+#include "blasfeo_api/Getrf.hpp"
 #include "blasfeo_api/Gemm.hpp"
 #include "blasfeo_api/Alloc.hpp"
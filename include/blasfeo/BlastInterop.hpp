@@ -0,0 +1,169 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+/// @brief Zero-copy interoperability with BLAST panel matrices
+#pragma once
+
+#include <blasfeo/BlasfeoMatrix.hpp>
+#include <blasfeo/BlasfeoApi.hpp>
+#include <blasfeo/Matrix.hpp>
+#include <blasfeo/Exception.hpp>
+
+#include <blast/math/panel/CustomPanelMatrix.hpp>
+#include <blast/math/panel/DynamicPanelMatrixPointer.hpp>
+#include <blast/math/panel/PanelSize.hpp>
+#include <blast/math/StorageOrder.hpp>
+#include <blast/util/NextMultiple.hpp>
+
+#include <blasfeo_block_size.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+
+#if defined(LA_EXTERNAL_BLAS_WRAPPER)
+#   error "BLASFEO built with LA=EXTERNAL_BLAS_WRAPPER stores matrices in column-major format and cannot share memory with BLAST panel matrices"
+#endif
+
+
+namespace blasfeo
+{
+    /// @brief Height of a panel of a BLASFEO matrix with elements of type Real
+    template <typename Real>
+    inline size_t constexpr PanelSize_v = std::is_same_v<Real, double> ? D_PS : S_PS;
+
+
+    /// @brief True if BLASFEO and BLAST panel matrices with elements of type Real have the same memory layout
+    template <typename Real>
+    inline bool constexpr IsPanelLayoutCompatible_v = PanelSize_v<Real> == blast::PanelSize_v<Real>;
+
+
+    namespace detail
+    {
+        template <typename Real>
+        inline size_t panelSpacing(BlasfeoMatrix_t<Real> const& sA) noexcept
+        {
+            static_assert(IsPanelLayoutCompatible_v<Real>,
+                "BLASFEO and BLAST panel sizes differ for this element type and architecture");
+
+            return PanelSize_v<Real> * sA.cn;
+        }
+
+
+        template <typename Real>
+        inline blast::CustomPanelMatrix<Real> panelMatrix(BlasfeoMatrix_t<Real>& sA)
+        {
+            return blast::CustomPanelMatrix<Real>(sA.pA, sA.m, sA.n, panelSpacing<Real>(sA));
+        }
+    }
+
+
+    /// @brief BLAST panel matrix sharing the elements of a double-precision BLASFEO matrix.
+    ///
+    /// The returned matrix refers to the memory of @a sA; @a sA must outlive it.
+    ///
+    /// @throw std::invalid_argument if the BLASFEO matrix memory is not aligned on the SIMD register boundary
+    inline blast::CustomPanelMatrix<double> panelMatrix(blasfeo_dmat& sA)
+    {
+        return detail::panelMatrix<double>(sA);
+    }
+
+
+    /// @brief BLAST panel matrix sharing the elements of a single-precision BLASFEO matrix.
+    ///
+    /// The returned matrix refers to the memory of @a sA; @a sA must outlive it.
+    ///
+    /// @throw std::invalid_argument if the BLASFEO matrix memory is not aligned on the SIMD register boundary
+    inline blast::CustomPanelMatrix<float> panelMatrix(blasfeo_smat& sA)
+    {
+        return detail::panelMatrix<float>(sA);
+    }
+
+
+    /// @brief BLAST matrix pointer to element (i, j) of a double-precision BLASFEO matrix.
+    ///
+    /// @tparam AF true if the pointed element is aligned, i.e. @a i is a multiple of the panel size
+    template <bool AF>
+    inline auto ptr(blasfeo_dmat& sA, size_t i, size_t j)
+    {
+        return blast::DynamicPanelMatrixPointer<double, blast::columnMajor, AF, true>(
+            sA.pA, detail::panelSpacing<double>(sA), i, j);
+    }
+
+
+    /// @brief BLAST matrix pointer to element (i, j) of a single-precision BLASFEO matrix.
+    ///
+    /// @tparam AF true if the pointed element is aligned, i.e. @a i is a multiple of the panel size
+    template <bool AF>
+    inline auto ptr(blasfeo_smat& sA, size_t i, size_t j)
+    {
+        return blast::DynamicPanelMatrixPointer<float, blast::columnMajor, AF, true>(
+            sA.pA, detail::panelSpacing<float>(sA), i, j);
+    }
+
+
+    /// @brief BLASFEO matrix sharing the elements of a column-major BLAST panel matrix.
+    ///
+    /// The view refers to the memory of the BLAST matrix, which must outlive the view.
+    /// Only the inverted diagonal used by BLASFEO factorization routines is stored in the view itself,
+    /// which is why the view is not copyable.
+    ///
+    template <typename Real>
+    class PanelMatrixView
+    :   public BlasfeoMatrix_t<Real>
+    ,   public Matrix<PanelMatrixView<Real>>
+    {
+    public:
+        using ElementType = Real;
+
+        static_assert(IsPanelLayoutCompatible_v<Real>,
+            "BLASFEO and BLAST panel sizes differ for this element type and architecture");
+
+
+        /// @brief Create a view of a BLAST panel matrix.
+        template <typename MT>
+        requires std::is_same_v<blast::ElementType_t<MT>, Real>
+        explicit PanelMatrixView(blast::PanelMatrix<MT, blast::columnMajor>& A)
+        :   PanelMatrixView(data(*A), rows(*A), columns(*A), spacing(*A))
+        {
+        }
+
+
+        /// @brief Create a view of panel matrix memory.
+        ///
+        /// @param data pointer to the beginning of the first panel
+        /// @param m number of rows
+        /// @param n number of columns
+        /// @param spacing distance between the beginnings of two consecutive panels, in elements
+        ///
+        /// @throw std::invalid_argument if @a spacing is not a multiple of the panel size
+        PanelMatrixView(Real * data, size_t m, size_t n, size_t spacing)
+        :   dA_(blast::nextMultiple(std::min(m, n), PanelSize_v<Real>))
+        {
+            if (spacing % PanelSize_v<Real> != 0)
+                BLASFEO_THROW_EXCEPTION(std::invalid_argument {"Spacing is not a multiple of the BLASFEO panel size"});
+
+            // Let BLASFEO initialize the fields, then point them to the BLAST storage.
+            create_mat(m, n, *this, data);
+            this->cn = spacing / PanelSize_v<Real>;
+            this->dA = dA_.data();
+            this->use_dA = 0;
+            this->memsize = (this->pm * this->cn + dA_.size()) * sizeof(Real);
+        }
+
+
+        PanelMatrixView(PanelMatrixView const&) = delete;
+        PanelMatrixView& operator=(PanelMatrixView const&) = delete;
+
+
+    private:
+        std::vector<Real> dA_;
+    };
+
+
+    template <typename MT>
+    PanelMatrixView(blast::PanelMatrix<MT, blast::columnMajor>&) -> PanelMatrixView<blast::ElementType_t<MT>>;
+}
@@ -0,0 +1,35 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <blasfeo_d_blasfeo_api.h>
+#include <blasfeo_s_blasfeo_api.h>
+
+#include <blasfeo/SizeT.hpp>
+
+
+namespace blasfeo
+{
+    /// @brief D <= lu( C ) ; LU factorization with row pivoting
+    inline void getrf_rp(size_t m, size_t n,
+        blasfeo_dmat const& sC, size_t ci, size_t cj,
+        blasfeo_dmat& sD, size_t di, size_t dj, int * ipiv)
+    {
+        ::blasfeo_dgetrf_rp(m, n,
+            const_cast<blasfeo_dmat *>(&sC), ci, cj,
+            &sD, di, dj, ipiv);
+    }
+
+
+    /// @brief D <= lu( C ) ; LU factorization with row pivoting
+    inline void getrf_rp(size_t m, size_t n,
+        blasfeo_smat const& sC, size_t ci, size_t cj,
+        blasfeo_smat& sD, size_t di, size_t dj, int * ipiv)
+    {
+        ::blasfeo_sgetrf_rp(m, n,
+            const_cast<blasfeo_smat *>(&sC), ci, cj,
+            &sD, di, dj, ipiv);
+    }
+}
@@ -56,4 +56,24 @@ namespace blasfeo
     {
         ::blasfeo_strmm_rutn(m, n, alpha, const_cast<blasfeo_smat *>(&sA), ai, aj, const_cast<blasfeo_smat *>(&sB), bi, bj, &sD, di, dj);
     }
+
+
+    /// @brief D <= alpha * A * B ; A upper triangular
+    inline void trmm_lunn(size_t m, size_t n, double alpha,
+        blasfeo_dmat const& sA, size_t ai, size_t aj,
+        blasfeo_dmat const& sB, size_t bi, size_t bj,
+        blasfeo_dmat& sD, size_t di, size_t dj)
+    {
+        ::blasfeo_dtrmm_lunn(m, n, alpha, const_cast<blasfeo_dmat *>(&sA), ai, aj, const_cast<blasfeo_dmat *>(&sB), bi, bj, &sD, di, dj);
+    }
+
+
+    /// @brief D <= alpha * A * B ; A upper triangular
+    inline void trmm_lunn(size_t m, size_t n, float alpha,
+        blasfeo_smat const& sA, size_t ai, size_t aj,
+        blasfeo_smat const& sB, size_t bi, size_t bj,
+        blasfeo_smat& sD, size_t di, size_t dj)
+    {
+        ::blasfeo_strmm_lunn(m, n, alpha, const_cast<blasfeo_smat *>(&sA), ai, aj, const_cast<blasfeo_smat *>(&sB), bi, bj, &sD, di, dj);
+    }
 }
@@ -0,0 +1,65 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <blasfeo_d_blasfeo_api.h>
+#include <blasfeo_s_blasfeo_api.h>
+
+#include <blasfeo/SizeT.hpp>
+
+
+namespace blasfeo
+{
+    /// @brief D <= alpha * A^{-1} * B ; A upper triangular with non-unit diagonal
+    inline void trsm_lunn(size_t m, size_t n, double alpha,
+        blasfeo_dmat const& sA, size_t ai, size_t aj,
+        blasfeo_dmat const& sB, size_t bi, size_t bj,
+        blasfeo_dmat& sD, size_t di, size_t dj)
+    {
+        ::blasfeo_dtrsm_lunn(m, n, alpha,
+            const_cast<blasfeo_dmat *>(&sA), ai, aj,
+            const_cast<blasfeo_dmat *>(&sB), bi, bj,
+            &sD, di, dj);
+    }
+
+
+    /// @brief D <= alpha * A^{-1} * B ; A upper triangular with non-unit diagonal
+    inline void trsm_lunn(size_t m, size_t n, float alpha,
+        blasfeo_smat const& sA, size_t ai, size_t aj,
+        blasfeo_smat const& sB, size_t bi, size_t bj,
+        blasfeo_smat& sD, size_t di, size_t dj)
+    {
+        ::blasfeo_strsm_lunn(m, n, alpha,
+            const_cast<blasfeo_smat *>(&sA), ai, aj,
+            const_cast<blasfeo_smat *>(&sB), bi, bj,
+            &sD, di, dj);
+    }
+
+
+    /// @brief D <= alpha * A^{-1} * B ; A lower triangular with non-unit diagonal
+    inline void trsm_llnn(size_t m, size_t n, double alpha,
+        blasfeo_dmat const& sA, size_t ai, size_t aj,
+        blasfeo_dmat const& sB, size_t bi, size_t bj,
+        blasfeo_dmat& sD, size_t di, size_t dj)
+    {
+        ::blasfeo_dtrsm_llnn(m, n, alpha,
+            const_cast<blasfeo_dmat *>(&sA), ai, aj,
+            const_cast<blasfeo_dmat *>(&sB), bi, bj,
+            &sD, di, dj);
+    }
+
+
+    /// @brief D <= alpha * A^{-1} * B ; A lower triangular with non-unit diagonal
+    inline void trsm_llnn(size_t m, size_t n, float alpha,
+        blasfeo_smat const& sA, size_t ai, size_t aj,
+        blasfeo_smat const& sB, size_t bi, size_t bj,
+        blasfeo_smat& sD, size_t di, size_t dj)
+    {
+        ::blasfeo_strsm_llnn(m, n, alpha,
+            const_cast<blasfeo_smat *>(&sA), ai, aj,
+            const_cast<blasfeo_smat *>(&sB), bi, bj,
+            &sD, di, dj);
+    }
+}
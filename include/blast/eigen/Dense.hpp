@@ -0,0 +1,94 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+/// @brief Zero-copy interoperability with Eigen dense matrices
+#pragma once
+
+#include <blast/math/dense/CustomMatrix.hpp>
+#include <blast/math/dense/CustomStaticMatrix.hpp>
+#include <blast/math/dense/DynamicMatrixPointer.hpp>
+#include <blast/math/dense/StaticMatrixPointer.hpp>
+#include <blast/math/StorageOrder.hpp>
+#include <blast/system/Inline.hpp>
+#include <blast/util/Types.hpp>
+
+#include <Eigen/Core>
+
+#include <type_traits>
+
+
+namespace blast
+{
+    namespace detail
+    {
+        /// @brief Eigen dense object with directly accessible, unit inner stride storage,
+        /// e.g. @a Eigen::Matrix, @a Eigen::Map, @a Eigen::Ref or a @a Eigen::Block of those.
+        template <typename E>
+        concept EigenDirectAccess = std::is_base_of_v<Eigen::DenseBase<E>, E>
+            && (E::Flags & Eigen::DirectAccessBit) != 0
+            && E::InnerStrideAtCompileTime == 1;
+
+
+        /// @brief Eigen dense object whose size and outer stride are known at compile time
+        template <typename E>
+        concept EigenStatic = E::RowsAtCompileTime != Eigen::Dynamic
+            && E::ColsAtCompileTime != Eigen::Dynamic
+            && E::OuterStrideAtCompileTime != Eigen::Dynamic;
+    }
+
+
+    /// @brief Matrix referring to the elements of an Eigen dense object.
+    ///
+    /// No elements are copied; @a x must outlive the result. Objects with compile-time
+    /// size and outer stride, such as fixed-size @a Eigen::Matrix, are mapped onto
+    /// a @a CustomStaticMatrix, so that BLAST algorithms use static matrix pointers.
+    /// Other objects are mapped onto a @a CustomMatrix. The element type of the result
+    /// is const if @a x only provides read access to its elements.
+    ///
+    /// Eigen does not guarantee SIMD alignment and padding in the BLAST sense,
+    /// therefore these properties are specified by the caller and checked at run time.
+    /// @a gemm, @a syrkLower and @a ger work on the default unaligned and unpadded views
+    /// of any size and do not access memory outside the matrix.
+    /// Algorithms reading and writing whole SIMD registers, such as dense @a potrf,
+    /// need padded matrices, e.g. a number of rows of a column-major matrix which
+    /// is a multiple of the SIMD size, or an @a Eigen::OuterStride which is,
+    /// and do not accept unpadded ones.
+    ///
+    /// @tparam AF true if the storage is aligned on the SIMD register boundary
+    /// @tparam PF true if the storage is padded to a multiple of the SIMD size
+    ///
+    /// @param x Eigen object with direct access to its elements and unit inner stride
+    ///
+    /// @throw std::invalid_argument if the storage of @a x does not satisfy @a AF or @a PF
+    ///
+    template <bool AF = false, bool PF = false, typename X>
+    requires detail::EigenDirectAccess<std::remove_cvref_t<X>>
+    inline auto asMatrix(X&& x)
+    {
+        using E = std::remove_cvref_t<X>;
+        using T = std::remove_pointer_t<decltype(x.data())>;
+        StorageOrder constexpr SO = E::IsRowMajor ? rowMajor : columnMajor;
+
+        if constexpr (detail::EigenStatic<E>)
+            return CustomStaticMatrix<T, E::RowsAtCompileTime, E::ColsAtCompileTime, SO, AF, PF, E::OuterStrideAtCompileTime>(x.data());
+        else
+            return CustomMatrix<T, SO, AF, PF>(x.data(), x.rows(), x.cols(), x.outerStride());
+    }
+
+
+    /// @brief Pointer to element (i, j) of an Eigen dense object.
+    ///
+    /// The result is a @a StaticMatrixPointer if the size and the outer stride of @a x are known at compile time,
+    /// and a @a DynamicMatrixPointer otherwise.
+    ///
+    /// @tparam AF true if the pointed element is aligned
+    ///
+    template <bool AF, typename X>
+    requires detail::EigenDirectAccess<std::remove_cvref_t<X>>
+    BLAST_ALWAYS_INLINE auto ptr(X&& x, size_t i, size_t j)
+    {
+        auto m = asMatrix(x);
+        return ptr<AF>(m, i, j);
+    }
+}
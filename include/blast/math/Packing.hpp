@@ -0,0 +1,22 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+
+namespace blast
+{
+    /**
+     * @brief Defines which operands of a matrix-matrix product are packed into panel format
+     * before the register-blocked kernels are executed.
+     */
+    enum class Packing
+    {
+        none,       //!< Operate on the operands directly
+        a,          //!< Pack A
+        b,          //!< Pack B
+        ab,         //!< Pack A and B
+        automatic   //!< Pack B if the packing cost is amortized over enough tiles, and pack A if it is row-major
+    };
+}
@@ -0,0 +1,63 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <concepts>
+
+
+namespace blast
+{
+    /**
+     * @brief Compile-time scalar 1.
+     *
+     * Can be passed instead of the alpha scalar to level-3 routines,
+     * in which case the multiplication by alpha is omitted.
+     */
+    struct One
+    {
+        template <typename T>
+        explicit constexpr operator T() const noexcept
+        {
+            return T(1);
+        }
+    };
+
+
+    /**
+     * @brief Compile-time scalar 0.
+     *
+     * Can be passed instead of the beta scalar to level-3 routines,
+     * in which case the C matrix is not read.
+     */
+    struct Zero
+    {
+        template <typename T>
+        explicit constexpr operator T() const noexcept
+        {
+            return T(0);
+        }
+    };
+
+
+    /// @brief Compile-time scalar 1
+    inline One constexpr one {};
+
+
+    /// @brief Compile-time scalar 0
+    inline Zero constexpr zero {};
+
+
+    /**
+     * @brief Tests if @a S can be passed as a scalar argument to a routine operating on elements of type @a T
+     *
+     * Any type implicitly convertible to @a T is accepted, e.g. a double or an int literal for float matrices,
+     * as well as the compile-time scalars @a One and @a Zero.
+     *
+     * @tparam S scalar argument type
+     * @tparam T matrix element type
+     */
+    template <typename S, typename T>
+    concept ScalarArgument = std::convertible_to<S, T> || std::same_as<S, One> || std::same_as<S, Zero>;
+}
@@ -10,3 +10,4 @@
 #include <blast/math/simd/SimdSize.hpp>
 #include <blast/math/simd/IsSimdAligned.hpp>
 #include <blast/math/simd/RegisterCapacity.hpp>
+#include <blast/math/simd/Prefetch.hpp>
@@ -0,0 +1,53 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <blast/system/CacheLine.hpp>
+#include <blast/util/Types.hpp>
+
+
+namespace blast
+{
+    /**
+     * @brief Defines how the spacing (leading dimension) of a dynamically-sized matrix is chosen.
+     */
+    enum class SpacingPolicy
+    {
+        none,           //!< Smallest spacing satisfying the alignment requirements
+        avoidAliasing   //!< Add one cache line to the spacing if it is a multiple of @a ALIASING_STRIDE
+    };
+
+
+    /// @brief Spacing policy used by dynamically-sized matrices unless specified otherwise.
+    SpacingPolicy constexpr DEFAULT_SPACING_POLICY = SpacingPolicy::none;
+
+
+    /// @brief Byte strides which are multiples of this value map consecutive columns
+    /// (or panels) to at most two L1 cache sets, which causes conflict misses in the register-blocked kernels.
+    ///
+    /// The value is half of the size of one way of a 32 KiB 8-way or 48 KiB 12-way L1 cache.
+    /// This is the case for leading dimensions of 256, 512, 1024... doubles.
+    size_t constexpr ALIASING_STRIDE = 2048;
+
+
+    /**
+     * @brief Adjust a minimal matrix spacing according to a spacing policy.
+     *
+     * @tparam T matrix element type
+     *
+     * @param spacing minimal spacing in elements, a multiple of the SIMD size of @a T
+     * @param policy spacing policy
+     *
+     * @return spacing in elements, a multiple of the SIMD size of @a T
+     */
+    template <typename T>
+    inline size_t constexpr adjustSpacing(size_t spacing, SpacingPolicy policy) noexcept
+    {
+        if (policy == SpacingPolicy::avoidAliasing && spacing > 0 && spacing * sizeof(T) % ALIASING_STRIDE == 0)
+            return spacing + CACHE_LINE_SIZE / sizeof(T);
+
+        return spacing;
+    }
+}
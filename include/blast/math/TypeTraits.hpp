@@ -10,6 +10,7 @@
 #include <blast/math/typetraits/IsContiguous.hpp>
 #include <blast/math/typetraits/IsStaticallySpaced.hpp>
 #include <blast/math/typetraits/IsView.hpp>
+#include <blast/math/typetraits/IsExpression.hpp>
 #include <blast/math/typetraits/ElementType.hpp>
 #include <blast/math/typetraits/StorageOrder.hpp>
 #include <blast/math/typetraits/Spacing.hpp>
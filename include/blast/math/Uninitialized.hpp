@@ -0,0 +1,33 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+
+namespace blast
+{
+    /**
+     * @brief Tag type selecting matrix constructors that do not initialize the matrix elements.
+     *
+     * Only the padding elements are set to 0, to prevent denormals from appearing in calculations.
+     * The logical elements of the matrix have indeterminate values and must be written before they are read.
+     * This saves a full pass over memory for matrices which are overwritten right after construction,
+     * e.g. gemm or potrf outputs.
+     */
+    struct Uninitialized
+    {
+        explicit Uninitialized() = default;
+    };
+
+
+    /**
+     * @brief Tag value selecting matrix constructors that do not initialize the matrix elements.
+     *
+     * \code
+     * DynamicMatrix<double> D(uninitialized, m, n);
+     * gemm(A, B, C, D);
+     * \endcode
+     */
+    inline Uninitialized constexpr uninitialized {};
+}
@@ -0,0 +1,31 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <blast/util/Types.hpp>
+
+
+namespace blast
+{
+    /**
+     * @brief Epilogue which leaves the register tile unchanged.
+     *
+     * Register-blocked algorithms accepting an epilogue call it as
+     *
+     * epilogue(ker, i, j, m, n);
+     *
+     * right before @a ker is stored to the output matrix, where ker is a @a RegisterMatrix
+     * holding the result tile, (i, j) are indices of the top left corner of the tile
+     * in the output matrix, and (m, n) are the dimensions of the tile. For partial tiles m and n
+     * are smaller than ker.rows() and ker.columns(), and only the top left m by n elements of ker are stored.
+     */
+    struct NoEpilogue
+    {
+        template <typename Ker>
+        void operator()(Ker&, size_t, size_t, size_t, size_t) const noexcept
+        {
+        }
+    };
+}
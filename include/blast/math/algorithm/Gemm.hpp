@@ -5,10 +5,18 @@
 #pragma once
 
 #include <blast/math/TypeTraits.hpp>
+#include <blast/math/Packing.hpp>
+#include <blast/math/ScalarTag.hpp>
+#include <blast/math/algorithm/Epilogue.hpp>
 #include <blast/math/algorithm/Tile.hpp>
 #include <blast/math/register_matrix/Gemm.hpp>
+#include <blast/math/panel/DynamicPanelMatrixPointer.hpp>
+#include <blast/math/panel/Pack.hpp>
+#include <blast/math/simd/Prefetch.hpp>
+#include <blast/math/simd/SimdSize.hpp>
 #include <blast/math/Matrix.hpp>
 #include <blast/util/Exception.hpp>
+#include <blast/util/Profile.hpp>
 
 
 namespace blast
@@ -44,6 +52,8 @@ namespace blast
     >
     inline void gemm(size_t M, size_t N, size_t K, ST1 alpha, MPA A, MPB B, ST2 beta, MPC C, MPD D)
     {
+        BLAST_PROFILE_SCOPE(gemm, M, N, K);
+
         using ET = std::remove_cv_t<ElementType_t<MPD>>;
 
         tile<ET, StorageOrder_v<MPD>>(
@@ -62,6 +72,265 @@ namespace blast
     }
 
 
+    /**
+     * @brief Matrix-matrix multiplication with @a MatrixPointer arguments and software prefetching
+     *
+     * D := alpha*A*B + beta*C
+     *
+     * Same as the version without the @a PFD parameter, but the register-blocked kernels
+     * prefetch columns of A and rows of B @a PFD iterations ahead of their use.
+     * With @a PFD = DEFAULT_PREFETCH_DISTANCE, the distance is @a PrefetchDistance_v of the element type of D
+     * for the current architecture. The best distance also depends on the matrix sizes,
+     * and can be measured with the BM_gemm_dynamic_plain_prefetch benchmark.
+     *
+     * @tparam PFD prefetch distance, in iterations of the K loop. 0 disables prefetching.
+     *
+     * @param M the number of rows of the matrices A, C, and D.
+     * @param N the number of columns of the matrices B and C.
+     * @param K the number of columns of the matrix A and the number of rows of the matrix B.
+     * @param alpha the scalar alpha
+     * @param A the matrix A
+     * @param B the matrix B
+     * @param beta the scalar beta
+     * @param C the matrix C
+     * @param D the output matrix D
+     */
+    template <
+        size_t PFD, typename ST1, MatrixPointer MPA, MatrixPointer MPB,
+        typename ST2, MatrixPointer MPC, MatrixPointer MPD
+    >
+    inline void gemm(size_t M, size_t N, size_t K, ST1 alpha, MPA A, MPB B, ST2 beta, MPC C, MPD D)
+    {
+        BLAST_PROFILE_SCOPE(gemm, M, N, K);
+
+        using ET = std::remove_cv_t<ElementType_t<MPD>>;
+        size_t constexpr PD = PFD == DEFAULT_PREFETCH_DISTANCE ? PrefetchDistance_v<ET> : PFD;
+
+        tile<ET, StorageOrder_v<MPD>>(
+            xsimd::default_arch {},
+            D.cachePreferredTraversal,
+            M, N,
+            [&] (auto& ker, size_t i, size_t j)
+            {
+                gemm<PD>(ker, K, alpha, A(i, 0), (~B)(0, j), beta, C(i, j), D(i, j));
+            },
+            [&] (auto& ker, size_t i, size_t j, size_t m, size_t n)
+            {
+                gemm<PD>(ker, K, alpha, A(i, 0), (~B)(0, j), beta, C(i, j), D(i, j), m, n);
+            }
+        );
+    }
+
+
+    /**
+     * @brief Matrix-matrix multiplication with @a MatrixPointer arguments and an epilogue
+     *
+     * D := epilogue(alpha*A*B + beta*C)
+     *
+     * For every register tile of D, @a epilogue is called as
+     *
+     * epilogue(ker, i, j, m, n);
+     *
+     * after the tile of alpha*A*B + beta*C has been computed in the @a RegisterMatrix ker
+     * and before it is stored to D. Here (i, j) is the top left corner of the tile and (m, n) is its size.
+     * The epilogue can modify ker in place, which fuses element-wise post-processing
+     * of the result with the matrix product and saves a pass over D.
+     *
+     * @param M the number of rows of the matrices A, C, and D.
+     * @param N the number of columns of the matrices B and C.
+     * @param K the number of columns of the matrix A and the number of rows of the matrix B.
+     * @param alpha the scalar alpha
+     * @param A the matrix A
+     * @param B the matrix B
+     * @param beta the scalar beta
+     * @param C the matrix C
+     * @param D the output matrix D
+     * @param epilogue functor applied to each register tile before it is stored
+     */
+    template <
+        typename ST1, MatrixPointer MPA, MatrixPointer MPB,
+        typename ST2, MatrixPointer MPC, MatrixPointer MPD, typename F
+    >
+    inline void gemm(size_t M, size_t N, size_t K, ST1 alpha, MPA A, MPB B, ST2 beta, MPC C, MPD D, F&& epilogue)
+    {
+        BLAST_PROFILE_SCOPE(gemm, M, N, K);
+
+        using ET = std::remove_cv_t<ElementType_t<MPD>>;
+
+        tile<ET, StorageOrder_v<MPD>>(
+            xsimd::default_arch {},
+            D.cachePreferredTraversal,
+            M, N,
+            [&] (auto& ker, size_t i, size_t j)
+            {
+                gemm(ker, K, alpha, A(i, 0), (~B)(0, j), beta, C(i, j), D(i, j),
+                    [&] (auto& r) { epilogue(r, i, j, r.rows(), r.columns()); });
+            },
+            [&] (auto& ker, size_t i, size_t j, size_t m, size_t n)
+            {
+                gemm(ker, K, alpha, A(i, 0), (~B)(0, j), beta, C(i, j), D(i, j), m, n,
+                    [&] (auto& r) { epilogue(r, i, j, m, n); });
+            }
+        );
+    }
+
+
+    namespace detail
+    {
+        /**
+         * @brief Check that the sizes of the arguments of D := alpha*A*B + beta*C match
+         *
+         * @throw std::invalid_argument if A is not M by K, B is not K by N, or C or D is not M by N
+         */
+        template <Matrix MT1, Matrix MT2, Matrix MT3, Matrix MT4>
+        inline void gemmCheckSizes(MT1 const& A, MT2 const& B, MT3 const& C, MT4 const& D)
+        {
+            size_t const M = rows(A);
+            size_t const N = columns(B);
+            size_t const K = columns(A);
+
+            if (rows(B) != K)
+                BLAST_THROW_EXCEPTION(std::invalid_argument {"Matrix sizes do not match"});
+
+            if (rows(C) != M || columns(C) != N)
+                BLAST_THROW_EXCEPTION(std::invalid_argument {"Matrix sizes do not match"});
+
+            if (rows(D) != M || columns(D) != N)
+                BLAST_THROW_EXCEPTION(std::invalid_argument {"Matrix sizes do not match"});
+        }
+
+
+        /**
+         * @brief Tests if a matrix can be packed into a panel buffer by @a gemm
+         *
+         * Panel matrices are already in the packed format, and static matrices are small enough
+         * to not benefit from packing.
+         */
+        template <typename MT>
+        bool constexpr IsGemmPackable_v = IsDenseMatrix_v<MT> && !IsStatic_v<MT>;
+
+
+        /**
+         * @brief Minimum size of B in bytes for which @a Packing::automatic packs B.
+         *
+         * A smaller B stays in the L1 cache between the row tiles of D regardless of its leading dimension,
+         * so packing it only adds a pass over B.
+         */
+        inline size_t constexpr gemmPackBMinBytes = 32 * 1024;
+
+
+        /**
+         * @brief Decide whether packing B pays off for a gemm of given size.
+         *
+         * Each column block of B is streamed once per row tile of D. Packing is worth
+         * its one additional pass over B if B does not fit in the L1 cache
+         * and is reused by at least two row tiles.
+         *
+         * @tparam T matrix element type
+         *
+         * @param M the number of rows of the matrices A, C, and D.
+         * @param N the number of columns of the matrices B and C.
+         * @param K the number of columns of the matrix A and the number of rows of the matrix B.
+         *
+         * @return true if B should be packed
+         */
+        template <typename T>
+        inline bool constexpr gemmPackB(size_t M, size_t N, size_t K) noexcept
+        {
+            return M > 3 * SimdSize_v<T> && N * K * sizeof(T) >= gemmPackBMinBytes;
+        }
+
+
+        /**
+         * @brief Decide whether A is packed for a given packing mode.
+         *
+         * A row-major A is always packed in the automatic mode: without packing, the kernels
+         * have to transpose blocks of A on the fly for every column tile of D.
+         *
+         * @tparam P operand packing mode
+         * @tparam MT type of the matrix A
+         */
+        template <Packing P, typename MT>
+        bool constexpr gemmPackA = IsGemmPackable_v<MT>
+            && (P == Packing::a || P == Packing::ab || (P == Packing::automatic && StorageOrder_v<MT> == rowMajor));
+
+
+        /**
+         * @brief Tests if B can be packed for a given packing mode.
+         *
+         * In the automatic mode, gemmPackB() decides at run time whether B is actually packed.
+         *
+         * @tparam P operand packing mode
+         * @tparam MT type of the matrix B
+         */
+        template <Packing P, typename MT>
+        bool constexpr gemmPackBEnabled = IsGemmPackable_v<MT>
+            && (P == Packing::b || P == Packing::ab || P == Packing::automatic);
+    }
+
+
+    /**
+     * @brief Matrix-matrix multiplication for @a DenseMatrix arguments with operand packing
+     *
+     * D := alpha*A*B + beta*C
+     *
+     * Depending on @a P, B and A are copied into thread-local buffers with the layout of a column-major
+     * (for A) and row-major (for B) @a DynamicPanelMatrix, and the panel kernels are run on the packed copies.
+     * Only dynamically-sized dense operands are packed; other operands are used directly.
+     *
+     * @tparam P operand packing mode
+     *
+     * @param alpha the scalar alpha
+     * @param A the matrix A
+     * @param B the matrix B
+     * @param beta the scalar beta
+     * @param C the matrix C
+     * @param D the output matrix D
+     */
+    template <Packing P, typename ST1, Matrix MT1, Matrix MT2, typename ST2, Matrix MT3, Matrix MT4>
+    inline void gemm(ST1 alpha, MT1 const& A, MT2 const& B, ST2 beta, MT3 const& C, MT4& D)
+    {
+        BLAST_PROFILE_SCOPE(gemm, rows(A), columns(B), columns(A));
+
+        using ET = std::remove_cv_t<ElementType_t<MT4>>;
+        size_t constexpr SS = SimdSize_v<ET>;
+
+        detail::gemmCheckSizes(A, B, C, D);
+
+        size_t const M = rows(A);
+        size_t const N = columns(B);
+        size_t const K = columns(A);
+
+        auto const gemm_a = [&] (auto b)
+        {
+            if constexpr (detail::gemmPackA<P, MT1>)
+            {
+                // A is packed as a column-major panel matrix
+                ET * const a_packed = detail::packBuffer<ET, 0>(nextMultiple(M, SS) * K);
+                packPanel(M, K, ptr(A), a_packed);
+                gemm(M, N, K, alpha, DynamicPanelMatrixPointer<ET const, columnMajor, true, true>(a_packed, SS * K, 0, 0),
+                    b, beta, ptr(C), ptr(D));
+            }
+            else
+                gemm(M, N, K, alpha, ptr(A), b, beta, ptr(C), ptr(D));
+        };
+
+        if constexpr (detail::gemmPackBEnabled<P, MT2>)
+        {
+            if (P != Packing::automatic || detail::gemmPackB<ET>(M, N, K))
+            {
+                // B is packed as a row-major panel matrix, i.e. B^T is packed as a column-major panel matrix
+                ET * const b_packed = detail::packBuffer<ET, 1>(nextMultiple(N, SS) * K);
+                packPanel(N, K, trans(ptr(B)), b_packed);
+                gemm_a(trans(DynamicPanelMatrixPointer<ET const, columnMajor, true, true>(b_packed, SS * K, 0, 0)));
+                return;
+            }
+        }
+
+        gemm_a(ptr(B));
+    }
+
+
     /**
      * @brief Matrix-matrix multiplication for @a DenseMatrix arguments
      *
@@ -70,6 +339,11 @@ namespace blast
      * alpha and beta are scalars, and A, B and C are matrices, with A
      * an m by k matrix, B a k by n matrix and C an m by n matrix.
      *
+     * The operands are used directly, except a dynamically-sized row-major A, e.g. trans(A)
+     * of a column-major matrix, which is packed as with gemm<Packing::a>(). The kernels would otherwise
+     * transpose the blocks of a row-major A element by element for every column tile of D.
+     * Use gemm<Packing::automatic>() to also pack large B into panel format.
+     *
      * @param alpha the scalar alpha
      * @param A the matrix A
      * @param B the matrix B
@@ -80,20 +354,62 @@ namespace blast
     template <typename ST1, Matrix MT1, Matrix MT2, typename ST2, Matrix MT3, Matrix MT4>
     inline void gemm(ST1 alpha, MT1 const& A, MT2 const& B, ST2 beta, MT3 const& C, MT4& D)
     {
-        size_t const M = rows(A);
-        size_t const N = columns(B);
-        size_t const K = columns(A);
+        if constexpr (detail::gemmPackA<Packing::automatic, MT1>)
+            gemm<Packing::a>(alpha, A, B, beta, C, D);
+        else
+        {
+            detail::gemmCheckSizes(A, B, C, D);
+            gemm(rows(A), columns(B), columns(A), alpha, ptr(A), ptr(B), beta, ptr(C), ptr(D));
+        }
+    }
 
-        if (rows(B) != K)
-            BLAST_THROW_EXCEPTION(std::invalid_argument {"Matrix sizes do not match"});
 
-        if (rows(C) != M || columns(C) != N)
-            BLAST_THROW_EXCEPTION(std::invalid_argument {"Matrix sizes do not match"});
+    /**
+     * @brief Matrix-matrix multiplication for @a DenseMatrix arguments with software prefetching
+     *
+     * D := alpha*A*B + beta*C
+     *
+     * gemm<DEFAULT_PREFETCH_DISTANCE>() uses the default distance of the architecture, see @a PrefetchDistance_v.
+     *
+     * @tparam PFD prefetch distance, in iterations of the K loop. 0 disables prefetching.
+     *
+     * @param alpha the scalar alpha
+     * @param A the matrix A
+     * @param B the matrix B
+     * @param beta the scalar beta
+     * @param C the matrix C
+     * @param D the output matrix D
+     */
+    template <size_t PFD, typename ST1, Matrix MT1, Matrix MT2, typename ST2, Matrix MT3, Matrix MT4>
+    inline void gemm(ST1 alpha, MT1 const& A, MT2 const& B, ST2 beta, MT3 const& C, MT4& D)
+    {
+        detail::gemmCheckSizes(A, B, C, D);
+
+        gemm<PFD>(rows(A), columns(B), columns(A), alpha, ptr(A), ptr(B), beta, ptr(C), ptr(D));
+    }
+
 
-        if (rows(D) != M || columns(D) != N)
-            BLAST_THROW_EXCEPTION(std::invalid_argument {"Matrix sizes do not match"});
+    /**
+     * @brief Matrix-matrix multiplication for @a DenseMatrix arguments with an epilogue
+     *
+     * D := epilogue(alpha*A*B + beta*C)
+     *
+     * See the @a MatrixPointer version for the description of the @a epilogue.
+     *
+     * @param alpha the scalar alpha
+     * @param A the matrix A
+     * @param B the matrix B
+     * @param beta the scalar beta
+     * @param C the matrix C
+     * @param D the output matrix D
+     * @param epilogue functor applied to each register tile before it is stored
+     */
+    template <typename ST1, Matrix MT1, Matrix MT2, typename ST2, Matrix MT3, Matrix MT4, typename F>
+    inline void gemm(ST1 alpha, MT1 const& A, MT2 const& B, ST2 beta, MT3 const& C, MT4& D, F&& epilogue)
+    {
+        detail::gemmCheckSizes(A, B, C, D);
 
-        gemm(M, N, K, alpha, ptr(A), ptr(B), beta, ptr(C), ptr(D));
+        gemm(rows(A), columns(B), columns(A), alpha, ptr(A), ptr(B), beta, ptr(C), ptr(D), epilogue);
     }
 
 
@@ -113,7 +429,6 @@ namespace blast
     template <Matrix MT1, Matrix MT2, Matrix MT3, Matrix MT4>
     inline void gemm(MT1 const& A, MT2 const& B, MT3 const& C, MT4& D)
     {
-        using ET = ElementType_t<MT4>;
-        gemm(ET(1.), A, B, ET(1.), C, D);
+        gemm(one, A, B, one, C, D);
     }
 }
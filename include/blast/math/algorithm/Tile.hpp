@@ -13,8 +13,11 @@
 #endif
 
 #include <blast/math/StorageOrder.hpp>
+#include <blast/util/TileStats.hpp>
 #include <blast/util/Types.hpp>
 
+#include <type_traits>
+
 
 namespace blast
 {
@@ -44,10 +47,29 @@ namespace blast
      * @param n number of matrix columns
      * @param f_full functor to call on full tiles
      * @param f_partial functor to call on partial tiles
+     *
+     * If BLAST_TILE_STATS is defined, the tiles are counted, see blast/util/TileStats.hpp.
      */
     template <typename ET, StorageOrder SO, typename FF, typename FP, typename Arch>
     inline void tile(Arch arch, StorageOrder traversal_order, size_t m, size_t n, FF&& f_full, FP&& f_partial)
     {
+#if defined(BLAST_TILE_STATS)
+        detail::tile<ET, SO>(arch, traversal_order, m, n,
+            [&] (auto& ker, size_t i, size_t j)
+            {
+                using KT = std::remove_reference_t<decltype(ker)>;
+                profile::detail::recordTile<KT::rows(), KT::columns()>(true);
+                f_full(ker, i, j);
+            },
+            [&] (auto& ker, size_t i, size_t j, size_t km, size_t kn)
+            {
+                using KT = std::remove_reference_t<decltype(ker)>;
+                profile::detail::recordTile<KT::rows(), KT::columns()>(false);
+                f_partial(ker, i, j, km, kn);
+            }
+        );
+#else
         detail::tile<ET, SO>(arch, traversal_order, m, n, f_full, f_partial);
+#endif
     }
 }
@@ -7,22 +7,32 @@
 #include <blast/math/Matrix.hpp>
 #include <blast/math/RegisterMatrix.hpp>
 #include <blast/math/algorithm/Gemm.hpp>
+#include <blast/math/algorithm/Epilogue.hpp>
 #include <blast/math/UpLo.hpp>
+#include <blast/math/ScalarTag.hpp>
 #include <blast/system/Tile.hpp>
 #include <blast/system/Inline.hpp>
 #include <blast/util/Exception.hpp>
+#include <blast/util/Profile.hpp>
 
 #include <stdexcept>
+#include <type_traits>
 
 
 namespace blast
 {
     namespace detail
     {
-        template <size_t KM, size_t KN, typename T, typename P1, typename P2, typename P3>
-        requires MatrixPointer<P1, T> && (P1::storageOrder == columnMajor) && MatrixPointer<P2, T> && MatrixPointer<P3, T>
-        BLAST_ALWAYS_INLINE void trmmLeftUpper_backend(size_t M, size_t N, T alpha, P1 a, P2 b, P3 c)
+        /// @brief Computes rows [i, i + KM) of C = alpha * A * B; A upper-triangular.
+        ///
+        /// @a a, @a b and @a c point to A(i, i), B(i, 0) and C(i, 0).
+        /// @a i is used only to pass the tile coordinates to @a epilogue.
+        ///
+        template <size_t KM, size_t KN, typename ST, typename P1, typename P2, typename P3, typename F>
+        requires MatrixPointer<P1> && (P1::storageOrder == columnMajor) && MatrixPointer<P2> && MatrixPointer<P3>
+        BLAST_ALWAYS_INLINE void trmmLeftUpper_backend(size_t M, size_t N, ST alpha, P1 a, P2 b, P3 c, size_t i, F& epilogue)
         {
+            using T = std::remove_cv_t<ElementType_t<P3>>;
             size_t constexpr TILE_SIZE = TileSize_v<T>;
             static_assert(KM % TILE_SIZE == 0);
 
@@ -35,8 +45,9 @@ namespace blast
                 for (; j + KN <= N; j += KN)
                 {
                     ker.reset();
-                    ker.trmm(alpha, a, UpLo::Upper, false, b(0, j));
+                    ker.trmm(T(alpha), a, UpLo::Upper, false, b(0, j));
                     gemm(ker, M - KM, alpha, a(0, KM), b(KM, j));
+                    epilogue(ker, i, j, KM, KN);
                     ker.store(c(0, j));
                 }
 
@@ -45,6 +56,7 @@ namespace blast
                     auto const md = KM, nd = N - j;
                     ker.reset();
                     gemm(ker, M, alpha, a, b(0, j), md, nd);
+                    epilogue(ker, i, j, md, nd);
                     ker.store(c(0, j), md, nd);
                 }
             }
@@ -58,6 +70,7 @@ namespace blast
                     auto const md = M, nd = KN;
                     ker.reset();
                     gemm(ker, M, alpha, a, b(0, j), md, nd);
+                    epilogue(ker, i, j, md, nd);
                     ker.store(c(0, j), md, nd);
                 }
 
@@ -66,6 +79,7 @@ namespace blast
                     auto const md = M, nd = N - j;
                     ker.reset();
                     gemm(ker, M, alpha, a, b(0, j), md, nd);
+                    epilogue(ker, i, j, md, nd);
                     ker.store(c(0, j), md, nd);
                 }
             }
@@ -73,7 +87,7 @@ namespace blast
     }
 
 
-    /// @brief C = alpha * A * B; A upper- or lower-triangular. Matrix pointer arguments.
+    /// @brief C = epilogue(alpha * A * B); A upper- or lower-triangular. Matrix pointer arguments.
     ///
     /// See https://netlib.org/lapack/explore-html-3.6.1/d1/d54/group__double__blas__level3_gaf07edfbb2d2077687522652c9e283e1e.html
     ///
@@ -89,13 +103,18 @@ namespace blast
     /// @param diagonal_unit specifies whether or not A is unit triangular
     /// @param B pointer to top left element of matrix B
     /// @param C pointer to top left element of matrix C
+    /// @param epilogue functor called as epilogue(ker, i, j, m, n) on each register tile before it is stored,
+    /// see @a NoEpilogue
     ///
-    template <typename ST, typename MPA, typename MPB, typename MPC>
-    requires MatrixPointer<MPA, ST> && MatrixPointer<MPB, ST> && MatrixPointer<MPC, ST>
+    template <typename ST, typename MPA, typename MPB, typename MPC, typename F>
+    requires MatrixPointer<MPA> && MatrixPointer<MPB> && MatrixPointer<MPC>
+        && ScalarArgument<ST, std::remove_cv_t<ElementType_t<MPC>>>
         && (StorageOrder_v<MPA> == columnMajor) && (StorageOrder_v<MPC> == columnMajor)
-    inline void trmm(size_t M, size_t N, ST alpha, MPA A, UpLo uplo, bool diagonal_unit, MPB B, MPC C)
+    inline void trmm(size_t M, size_t N, ST alpha, MPA A, UpLo uplo, bool diagonal_unit, MPB B, MPC C, F&& epilogue)
     {
-        using ET = ST;
+        BLAST_PROFILE_SCOPE(trmm, M, N);
+
+        using ET = std::remove_cv_t<ElementType_t<MPC>>;
         size_t constexpr TILE_SIZE = TileSize_v<ET>;
 
         if (diagonal_unit)
@@ -109,15 +128,15 @@ namespace blast
             // it is more efficient to apply 2 * TILE_SIZE kernel 2 times than 3 * TILE_SIZE + 1 * TILE_SIZE kernel.
             for (; i + 2 * TILE_SIZE < M && i + 4 * TILE_SIZE != M; i += 3 * TILE_SIZE)
                 detail::trmmLeftUpper_backend<3 * TILE_SIZE, TILE_SIZE>(
-                    M - i, N, alpha, A(i, i), B(i, 0), C(i, 0));
+                    M - i, N, alpha, A(i, i), B(i, 0), C(i, 0), i, epilogue);
 
             for (; i + 1 * TILE_SIZE < M; i += 2 * TILE_SIZE)
                 detail::trmmLeftUpper_backend<2 * TILE_SIZE, TILE_SIZE>(
-                    M - i, N, alpha, A(i, i), B(i, 0), C(i, 0));
+                    M - i, N, alpha, A(i, i), B(i, 0), C(i, 0), i, epilogue);
 
             for (; i + 0 * TILE_SIZE < M; i += 1 * TILE_SIZE)
                 detail::trmmLeftUpper_backend<1 * TILE_SIZE, TILE_SIZE>(
-                    M - i, N, alpha, A(i, i), B(i, 0), C(i, 0));
+                    M - i, N, alpha, A(i, i), B(i, 0), C(i, 0), i, epilogue);
         }
         else
         {
@@ -126,7 +145,7 @@ namespace blast
     }
 
 
-    /// @brief C = alpha * B * A; A upper- or lower-triangular. Matrix pointer arguments.
+    /// @brief C = epilogue(alpha * B * A); A upper- or lower-triangular. Matrix pointer arguments.
     ///
     /// See https://netlib.org/lapack/explore-html-3.6.1/d1/d54/group__double__blas__level3_gaf07edfbb2d2077687522652c9e283e1e.html
     ///
@@ -142,13 +161,18 @@ namespace blast
     /// @param uplo specifies whether the matrix A is an upper or lower triangular
     /// @param diagonal_unit specifies whether or not A is unit triangular
     /// @param C pointer to top left element of matrix C
+    /// @param epilogue functor called as epilogue(ker, i, j, m, n) on each register tile before it is stored,
+    /// see @a NoEpilogue
     ///
-    template <typename ST, typename MPB, typename MPA, typename MPC>
-    requires MatrixPointer<MPB, ST> && MatrixPointer<MPA, ST> && MatrixPointer<MPC, ST>
+    template <typename ST, typename MPB, typename MPA, typename MPC, typename F>
+    requires MatrixPointer<MPB> && MatrixPointer<MPA> && MatrixPointer<MPC>
+        && ScalarArgument<ST, std::remove_cv_t<ElementType_t<MPC>>>
         && (StorageOrder_v<MPB> == columnMajor) && (StorageOrder_v<MPC> == columnMajor)
-    inline void trmm(size_t M, size_t N, ST alpha, MPB B, MPA A, UpLo uplo, bool diagonal_unit, MPC C)
+    inline void trmm(size_t M, size_t N, ST alpha, MPB B, MPA A, UpLo uplo, bool diagonal_unit, MPC C, F&& epilogue)
     {
-        using ET = ST;
+        BLAST_PROFILE_SCOPE(trmm, M, N);
+
+        using ET = std::remove_cv_t<ElementType_t<MPC>>;
         size_t constexpr TILE_SIZE = TileSize_v<ET>;
 
         if (uplo == UpLo::Lower)
@@ -166,24 +190,27 @@ namespace blast
                 for (; i + 3 * TILE_SIZE <= M && i + 4 * TILE_SIZE != M; i += 3 * TILE_SIZE)
                 {
                     RegisterMatrix<ET, 3 * TILE_SIZE, TILE_SIZE, columnMajor> ker;
-                    ker.trmm(alpha, B(i, j), A(j, j), UpLo::Lower, diagonal_unit);
+                    ker.trmm(ET(alpha), B(i, j), A(j, j), UpLo::Lower, diagonal_unit);
                     gemm(ker, N - j - TILE_SIZE, alpha, B(i, j + TILE_SIZE), A(j + TILE_SIZE, j));
+                    epilogue(ker, i, j, ker.rows(), ker.columns());
                     ker.store(C(i, j));
                 }
 
                 for (; i + 2 * TILE_SIZE <= M; i += 2 * TILE_SIZE)
                 {
                     RegisterMatrix<ET, 2 * TILE_SIZE, TILE_SIZE, columnMajor> ker;
-                    ker.trmm(alpha, B(i, j), A(j, j), UpLo::Lower, diagonal_unit);
+                    ker.trmm(ET(alpha), B(i, j), A(j, j), UpLo::Lower, diagonal_unit);
                     gemm(ker, N - j - TILE_SIZE, alpha, B(i, j + TILE_SIZE), A(j + TILE_SIZE, j));
+                    epilogue(ker, i, j, ker.rows(), ker.columns());
                     ker.store(C(i, j));
                 }
 
                 for (; i + 1 * TILE_SIZE <= M; i += 1 * TILE_SIZE)
                 {
                     RegisterMatrix<ET, 1 * TILE_SIZE, TILE_SIZE, columnMajor> ker;
-                    ker.trmm(alpha, B(i, j), A(j, j), UpLo::Lower, diagonal_unit);
+                    ker.trmm(ET(alpha), B(i, j), A(j, j), UpLo::Lower, diagonal_unit);
                     gemm(ker, N - j - TILE_SIZE, alpha, B(i, j + TILE_SIZE), A(j + TILE_SIZE, j));
+                    epilogue(ker, i, j, ker.rows(), ker.columns());
                     ker.store(C(i, j));
                 }
 
@@ -191,8 +218,9 @@ namespace blast
                 if (i < M)
                 {
                     RegisterMatrix<ET, TILE_SIZE, TILE_SIZE, columnMajor> ker;
-                    ker.trmm(alpha, B(i, j), A(j, j), UpLo::Lower, diagonal_unit, M - i, ker.columns());
+                    ker.trmm(ET(alpha), B(i, j), A(j, j), UpLo::Lower, diagonal_unit, M - i, ker.columns());
                     gemm(ker, N - j - TILE_SIZE, alpha, B(i, j + TILE_SIZE), A(j + TILE_SIZE, j), M - i, ker.columns());
+                    epilogue(ker, i, j, M - i, ker.columns());
                     ker.store(C(i, j), M - i, ker.columns());
                 }
             }
@@ -208,21 +236,24 @@ namespace blast
                 for (; i + 3 * TILE_SIZE <= M && i + 4 * TILE_SIZE != M; i += 3 * TILE_SIZE)
                 {
                     RegisterMatrix<ET, 3 * TILE_SIZE, TILE_SIZE, columnMajor> ker;
-                    ker.trmm(alpha, B(i, j), A(j, j), UpLo::Lower, diagonal_unit, ker.rows(), N - j);
+                    ker.trmm(ET(alpha), B(i, j), A(j, j), UpLo::Lower, diagonal_unit, ker.rows(), N - j);
+                    epilogue(ker, i, j, ker.rows(), N - j);
                     ker.store(C(i, j), ker.rows(), N - j);
                 }
 
                 for (; i + 2 * TILE_SIZE <= M; i += 2 * TILE_SIZE)
                 {
                     RegisterMatrix<ET, 2 * TILE_SIZE, TILE_SIZE, columnMajor> ker;
-                    ker.trmm(alpha, B(i, j), A(j, j), UpLo::Lower, diagonal_unit, ker.rows(), N - j);
+                    ker.trmm(ET(alpha), B(i, j), A(j, j), UpLo::Lower, diagonal_unit, ker.rows(), N - j);
+                    epilogue(ker, i, j, ker.rows(), N - j);
                     ker.store(C(i, j), ker.rows(), N - j);
                 }
 
                 for (; i + 1 * TILE_SIZE <= M; i += 1 * TILE_SIZE)
                 {
                     RegisterMatrix<ET, 1 * TILE_SIZE, TILE_SIZE, columnMajor> ker;
-                    ker.trmm(alpha, B(i, j), A(j, j), UpLo::Lower, diagonal_unit, ker.rows(), N - j);
+                    ker.trmm(ET(alpha), B(i, j), A(j, j), UpLo::Lower, diagonal_unit, ker.rows(), N - j);
+                    epilogue(ker, i, j, ker.rows(), N - j);
                     ker.store(C(i, j), ker.rows(), N - j);
                 }
 
@@ -230,7 +261,8 @@ namespace blast
                 if (i < M)
                 {
                     RegisterMatrix<ET, TILE_SIZE, TILE_SIZE, columnMajor> ker;
-                    ker.trmm(alpha, B(i, j), A(j, j), UpLo::Lower, diagonal_unit, M - i, N - j);
+                    ker.trmm(ET(alpha), B(i, j), A(j, j), UpLo::Lower, diagonal_unit, M - i, N - j);
+                    epilogue(ker, i, j, M - i, N - j);
                     ker.store(C(i, j), M - i, N - j);
                 }
             }
@@ -242,7 +274,49 @@ namespace blast
     }
 
 
-    /// @brief C = alpha * A * B; A upper- or lower-triangular. Matrix arguments.
+    /// @brief C = alpha * A * B; A upper- or lower-triangular. Matrix pointer arguments.
+    ///
+    /// @param M the number of rows of B
+    /// @param N the number of columns of B
+    /// @param alpha the scalar alpha
+    /// @param A pointer to top left element of matrix A
+    /// @param uplo specifies whether the matrix A is an upper or lower triangular
+    /// @param diagonal_unit specifies whether or not A is unit triangular
+    /// @param B pointer to top left element of matrix B
+    /// @param C pointer to top left element of matrix C
+    ///
+    template <typename ST, typename MPA, typename MPB, typename MPC>
+    requires MatrixPointer<MPA> && MatrixPointer<MPB> && MatrixPointer<MPC>
+        && ScalarArgument<ST, std::remove_cv_t<ElementType_t<MPC>>>
+        && (StorageOrder_v<MPA> == columnMajor) && (StorageOrder_v<MPC> == columnMajor)
+    inline void trmm(size_t M, size_t N, ST alpha, MPA A, UpLo uplo, bool diagonal_unit, MPB B, MPC C)
+    {
+        trmm(M, N, alpha, A, uplo, diagonal_unit, B, C, NoEpilogue {});
+    }
+
+
+    /// @brief C = alpha * B * A; A upper- or lower-triangular. Matrix pointer arguments.
+    ///
+    /// @param M the number of rows of B
+    /// @param N the number of columns of B
+    /// @param alpha the scalar alpha
+    /// @param B pointer to top left element of matrix B
+    /// @param A pointer to top left element of matrix A
+    /// @param uplo specifies whether the matrix A is an upper or lower triangular
+    /// @param diagonal_unit specifies whether or not A is unit triangular
+    /// @param C pointer to top left element of matrix C
+    ///
+    template <typename ST, typename MPB, typename MPA, typename MPC>
+    requires MatrixPointer<MPB> && MatrixPointer<MPA> && MatrixPointer<MPC>
+        && ScalarArgument<ST, std::remove_cv_t<ElementType_t<MPC>>>
+        && (StorageOrder_v<MPB> == columnMajor) && (StorageOrder_v<MPC> == columnMajor)
+    inline void trmm(size_t M, size_t N, ST alpha, MPB B, MPA A, UpLo uplo, bool diagonal_unit, MPC C)
+    {
+        trmm(M, N, alpha, B, A, uplo, diagonal_unit, C, NoEpilogue {});
+    }
+
+
+    /// @brief C = epilogue(alpha * A * B); A upper- or lower-triangular. Matrix arguments.
     ///
     /// See https://netlib.org/lapack/explore-html-3.6.1/d1/d54/group__double__blas__level3_gaf07edfbb2d2077687522652c9e283e1e.html
     ///
@@ -256,14 +330,13 @@ namespace blast
     /// @param diag specifies whether or not A is unit triangular
     /// @param B matrix B
     /// @param C matrix C
+    /// @param epilogue functor called as epilogue(ker, i, j, m, n) on each register tile before it is stored,
+    /// see @a NoEpilogue
     ///
-    template <typename ST, typename MT1, typename MT2, typename MT3>
-    requires Matrix<MT1, ST> && Matrix<MT2, ST> && Matrix<MT3, ST>
-    inline void trmm(ST alpha, MT1 const& A, UpLo uplo, bool diag, MT2 const& B, MT3& C)
+    template <typename ST, typename MT1, typename MT2, typename MT3, typename F>
+    requires Matrix<MT1> && Matrix<MT2> && Matrix<MT3> && ScalarArgument<ST, ElementType_t<MT3>>
+    inline void trmm(ST alpha, MT1 const& A, UpLo uplo, bool diag, MT2 const& B, MT3& C, F&& epilogue)
     {
-        using ET = ST;
-        size_t constexpr TILE_SIZE = TileSize_v<ET>;
-
         size_t const M = rows(B);
         size_t const N = columns(B);
 
@@ -273,11 +346,28 @@ namespace blast
         if (rows(C) != M || columns(C) != N)
             BLAST_THROW_EXCEPTION(std::invalid_argument {"Matrix sizes do not match"});
 
-        trmm(M, N, alpha, ptr(A), uplo, diag, ptr(B), ptr(C));
+        trmm(M, N, alpha, ptr(A), uplo, diag, ptr(B), ptr(C), epilogue);
     }
 
 
-    /// @brief C = alpha * B * A + C; A lower-triangular. Matrix arguments.
+    /// @brief C = alpha * A * B; A upper- or lower-triangular. Matrix arguments.
+    ///
+    /// @param alpha the scalar alpha
+    /// @param A matrix A
+    /// @param uplo specifies whether the matrix A is an upper or lower triangular
+    /// @param diag specifies whether or not A is unit triangular
+    /// @param B matrix B
+    /// @param C matrix C
+    ///
+    template <typename ST, typename MT1, typename MT2, typename MT3>
+    requires Matrix<MT1> && Matrix<MT2> && Matrix<MT3> && ScalarArgument<ST, ElementType_t<MT3>>
+    inline void trmm(ST alpha, MT1 const& A, UpLo uplo, bool diag, MT2 const& B, MT3& C)
+    {
+        trmm(alpha, A, uplo, diag, B, C, NoEpilogue {});
+    }
+
+
+    /// @brief C = epilogue(alpha * B * A); A lower-triangular. Matrix arguments.
     ///
     /// See https://netlib.org/lapack/explore-html-3.6.1/d1/d54/group__double__blas__level3_gaf07edfbb2d2077687522652c9e283e1e.html
     ///
@@ -291,11 +381,13 @@ namespace blast
     /// @param uplo specifies whether the matrix A is an upper or lower triangular
     /// @param diag specifies whether or not A is unit triangular
     /// @param C matrix C
+    /// @param epilogue functor called as epilogue(ker, i, j, m, n) on each register tile before it is stored,
+    /// see @a NoEpilogue
     ///
-    template <typename ET, typename MTB, typename MTA, typename MTC>
-    requires Matrix<MTB, ET> && Matrix<MTA, ET> && Matrix<MTC, ET>
+    template <typename ST, typename MTB, typename MTA, typename MTC, typename F>
+    requires Matrix<MTB> && Matrix<MTA> && Matrix<MTC> && ScalarArgument<ST, ElementType_t<MTC>>
         && (StorageOrder_v<MTB> == columnMajor) && (StorageOrder_v<MTC> == columnMajor)
-    inline void trmm(ET alpha, MTB const& B, MTA const& A, UpLo uplo, bool diag, MTC& C)
+    inline void trmm(ST alpha, MTB const& B, MTA const& A, UpLo uplo, bool diag, MTC& C, F&& epilogue)
     {
         size_t const M = rows(B);
         size_t const N = columns(B);
@@ -306,6 +398,24 @@ namespace blast
         if (rows(C) != M || columns(C) != N)
             BLAZE_THROW_INVALID_ARGUMENT("Matrix sizes do not match");
 
-        trmm(M, N, alpha, ptr(B), ptr(A), uplo, diag, ptr(C));
+        trmm(M, N, alpha, ptr(B), ptr(A), uplo, diag, ptr(C), epilogue);
+    }
+
+
+    /// @brief C = alpha * B * A + C; A lower-triangular. Matrix arguments.
+    ///
+    /// @param alpha the scalar alpha
+    /// @param B matrix B
+    /// @param A matrix A
+    /// @param uplo specifies whether the matrix A is an upper or lower triangular
+    /// @param diag specifies whether or not A is unit triangular
+    /// @param C matrix C
+    ///
+    template <typename ST, typename MTB, typename MTA, typename MTC>
+    requires Matrix<MTB> && Matrix<MTA> && Matrix<MTC> && ScalarArgument<ST, ElementType_t<MTC>>
+        && (StorageOrder_v<MTB> == columnMajor) && (StorageOrder_v<MTC> == columnMajor)
+    inline void trmm(ST alpha, MTB const& B, MTA const& A, UpLo uplo, bool diag, MTC& C)
+    {
+        trmm(alpha, B, A, uplo, diag, C, NoEpilogue {});
     }
 }
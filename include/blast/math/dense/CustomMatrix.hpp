@@ -0,0 +1,257 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <blast/math/TypeTraits.hpp>
+#include <blast/math/StorageOrder.hpp>
+#include <blast/math/simd/SimdSize.hpp>
+#include <blast/math/simd/IsSimdAligned.hpp>
+#include <blast/util/Exception.hpp>
+#include <blast/util/NextMultiple.hpp>
+#include <blast/util/Types.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+
+namespace blast
+{
+    /// @brief Row/column major matrix using memory provided by the caller.
+    ///
+    /// The matrix does not own its elements; copy construction creates another view of the same elements.
+    /// Assignment always copies the elements, like for any other matrix type.
+    /// The caller is responsible for keeping the memory alive while the matrix is in use.
+    /// A matrix with a const element type @a T is a read-only view.
+    ///
+    /// If @a PF is true, the padding elements of the storage must be initialized by the caller,
+    /// preferably to 0 to prevent denorms in calculations.
+    ///
+    /// @tparam T element type of the matrix, possibly const
+    /// @tparam SO storage order of matrix elements
+    /// @tparam AF true if the storage is aligned on the SIMD register boundary
+    /// @tparam PF true if the storage is padded to a multiple of the SIMD size
+    ///
+    template <typename T, bool SO = columnMajor, bool AF = false, bool PF = false>
+    class CustomMatrix
+    {
+    public:
+        using ElementType = T;
+
+
+        /// @brief Create a matrix on a user-provided buffer with minimal spacing.
+        ///
+        /// The spacing is the number of rows (columns) for column-major (row-major) matrices,
+        /// rounded up to a multiple of the SIMD size if @a PF is true.
+        ///
+        /// @param data pointer to the element (0, 0)
+        /// @param m number of rows
+        /// @param n number of columns
+        ///
+        CustomMatrix(T * data, size_t m, size_t n)
+        :   CustomMatrix {data, m, n, PF ? nextMultiple(SO == columnMajor ? m : n, SS) : (SO == columnMajor ? m : n)}
+        {
+        }
+
+
+        /// @brief Create a matrix on a user-provided buffer.
+        ///
+        /// @param data pointer to the element (0, 0)
+        /// @param m number of rows
+        /// @param n number of columns
+        /// @param spacing distance between the beginnings of two consecutive columns (rows)
+        /// of a column-major (row-major) matrix, in elements
+        ///
+        /// @throw std::invalid_argument if @a spacing is too small or @a data and @a spacing
+        /// do not satisfy the alignment and padding requirements
+        ///
+        CustomMatrix(T * data, size_t m, size_t n, size_t spacing)
+        :   m_ {m}
+        ,   n_ {n}
+        ,   spacing_ {spacing}
+        ,   v_ {data}
+        {
+            if (spacing_ < (SO == columnMajor ? m_ : n_))
+                BLAST_THROW_EXCEPTION(std::invalid_argument {"Spacing is less than the matrix size"});
+
+            if ((AF || PF) && spacing_ % SS != 0)
+                BLAST_THROW_EXCEPTION(std::invalid_argument {"Spacing is not a multiple of SIMD size"});
+
+            if (AF && !isSimdAligned(v_))
+                BLAST_THROW_EXCEPTION(std::invalid_argument {"Data pointer is not aligned"});
+        }
+
+
+        CustomMatrix(CustomMatrix const&) = default;
+
+
+        /// @brief Copy the elements of a matrix of the same size.
+        ///
+        /// @throw std::invalid_argument if the sizes of the matrices do not match
+        ///
+        CustomMatrix& operator=(CustomMatrix const& rhs) requires (!std::is_const_v<T>)
+        {
+            if (rhs.m_ != m_ || rhs.n_ != n_)
+                BLAST_THROW_EXCEPTION(std::invalid_argument {"Matrix sizes do not match"});
+
+            for (size_t i = 0; i < m_; ++i)
+                for (size_t j = 0; j < n_; ++j)
+                    (*this)(i, j) = rhs(i, j);
+
+            return *this;
+        }
+
+
+        CustomMatrix& operator=(T val) noexcept
+        {
+            for (size_t i = 0; i < m_; ++i)
+                for (size_t j = 0; j < n_; ++j)
+                    (*this)(i, j) = val;
+
+            return *this;
+        }
+
+
+        /// @brief Evaluate a matrix expression, see @a assign().
+        ///
+        /// Products such as alpha*A*B + beta*C are evaluated by a single BLAST kernel call without temporaries.
+        ///
+        template <typename Expr>
+        requires IsExpression_v<Expr>
+        CustomMatrix& operator=(Expr const& expr)
+        {
+            assign(*this, expr);
+            return *this;
+        }
+
+
+        T const& operator()(size_t i, size_t j) const noexcept
+        {
+            return v_[elementIndex(i, j)];
+        }
+
+
+        T& operator()(size_t i, size_t j) noexcept
+        {
+            return v_[elementIndex(i, j)];
+        }
+
+
+        size_t rows() const noexcept
+        {
+            return m_;
+        }
+
+
+        size_t columns() const noexcept
+        {
+            return n_;
+        }
+
+
+        size_t spacing() const noexcept
+        {
+            return spacing_;
+        }
+
+
+        T * data() noexcept
+        {
+            return v_;
+        }
+
+
+        T const * data() const noexcept
+        {
+            return v_;
+        }
+
+
+        /**
+         * @brief Set all matrix elements to 0
+         */
+        void reset() noexcept
+        {
+            *this = T {};
+        }
+
+
+    private:
+        static size_t constexpr SS = SimdSize_v<T>;
+
+        size_t m_;
+        size_t n_;
+        size_t spacing_;
+        T * v_;
+
+
+        size_t elementIndex(size_t i, size_t j) const noexcept
+        {
+            return SO == columnMajor ? i + j * spacing_ : i * spacing_ + j;
+        }
+    };
+
+
+    template <typename T, bool SO, bool AF, bool PF>
+    inline size_t constexpr rows(CustomMatrix<T, SO, AF, PF> const& m) noexcept
+    {
+        return m.rows();
+    }
+
+
+    template <typename T, bool SO, bool AF, bool PF>
+    inline size_t constexpr columns(CustomMatrix<T, SO, AF, PF> const& m) noexcept
+    {
+        return m.columns();
+    }
+
+
+    template <typename T, bool SO, bool AF, bool PF>
+    inline size_t constexpr spacing(CustomMatrix<T, SO, AF, PF> const& m) noexcept
+    {
+        return m.spacing();
+    }
+
+
+    template <typename T, bool SO, bool AF, bool PF>
+    inline constexpr T * data(CustomMatrix<T, SO, AF, PF>& m) noexcept
+    {
+        return m.data();
+    }
+
+
+    template <typename T, bool SO, bool AF, bool PF>
+    inline constexpr T const * data(CustomMatrix<T, SO, AF, PF> const& m) noexcept
+    {
+        return m.data();
+    }
+
+
+    template <typename T, bool SO, bool AF, bool PF>
+    inline void reset(CustomMatrix<T, SO, AF, PF>& m) noexcept
+    {
+        m.reset();
+    }
+
+
+    template <typename T, bool SO, bool AF, bool PF>
+    struct IsDenseMatrix<CustomMatrix<T, SO, AF, PF>> : std::true_type {};
+
+
+    template <typename T, bool SO, bool AF, bool PF>
+    struct IsStatic<CustomMatrix<T, SO, AF, PF>> : std::false_type {};
+
+
+    template <typename T, bool SO, bool AF, bool PF>
+    struct StorageOrderHelper<CustomMatrix<T, SO, AF, PF>> : std::integral_constant<StorageOrder, StorageOrder(SO)> {};
+
+
+    template <typename T, bool SO, bool AF, bool PF>
+    struct IsAligned<CustomMatrix<T, SO, AF, PF>> : std::integral_constant<bool, AF> {};
+
+
+    template <typename T, bool SO, bool AF, bool PF>
+    struct IsPadded<CustomMatrix<T, SO, AF, PF>> : std::integral_constant<bool, PF> {};
+}
@@ -0,0 +1,215 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <blast/math/TypeTraits.hpp>
+#include <blast/math/StorageOrder.hpp>
+#include <blast/math/simd/SimdSize.hpp>
+#include <blast/math/simd/IsSimdAligned.hpp>
+#include <blast/util/Exception.hpp>
+#include <blast/util/NextMultiple.hpp>
+#include <blast/util/Types.hpp>
+
+#include <stdexcept>
+#include <type_traits>
+
+
+namespace blast
+{
+    /// @brief Matrix with statically defined size and spacing using memory provided by the caller.
+    ///
+    /// This is the statically-sized counterpart of @a CustomMatrix. The matrix does not own its elements;
+    /// copying a @a CustomStaticMatrix copies the view, not the elements.
+    /// A matrix with a const element type @a T is a read-only view.
+    ///
+    /// @tparam T element type of the matrix, possibly const
+    /// @tparam M number of rows
+    /// @tparam N number of columns
+    /// @tparam SO storage order of matrix elements
+    /// @tparam AF true if the storage is aligned on the SIMD register boundary
+    /// @tparam PF true if the storage is padded to a multiple of the SIMD size
+    /// @tparam S distance between the beginnings of two consecutive columns (rows)
+    /// of a column-major (row-major) matrix, in elements
+    ///
+    template <typename T, size_t M, size_t N, bool SO = columnMajor, bool AF = false, bool PF = false,
+        size_t S = PF ? nextMultiple(SO == columnMajor ? M : N, SimdSize_v<T>) : (SO == columnMajor ? M : N)>
+    class CustomStaticMatrix
+    {
+    public:
+        using ElementType = T;
+        static bool constexpr storageOrder = SO;
+
+        static_assert(S >= (SO == columnMajor ? M : N), "Spacing is less than the matrix size");
+        static_assert(!(AF || PF) || S % SimdSize_v<T> == 0, "Spacing is not a multiple of SIMD size");
+
+
+        /// @brief Create a matrix on a user-provided buffer.
+        ///
+        /// @param data pointer to the element (0, 0)
+        ///
+        /// @throw std::invalid_argument if @a data is not aligned and @a AF is true
+        ///
+        explicit CustomStaticMatrix(T * data)
+        :   v_ {data}
+        {
+            if (AF && !isSimdAligned(v_))
+                BLAST_THROW_EXCEPTION(std::invalid_argument {"Data pointer is not aligned"});
+        }
+
+
+        CustomStaticMatrix(CustomStaticMatrix const&) = default;
+        CustomStaticMatrix& operator=(CustomStaticMatrix const&) = default;
+
+
+        CustomStaticMatrix& operator=(T val) noexcept
+        {
+            for (size_t i = 0; i < M; ++i)
+                for (size_t j = 0; j < N; ++j)
+                    (*this)(i, j) = val;
+
+            return *this;
+        }
+
+
+        /// @brief Evaluate a matrix expression, see @a assign().
+        ///
+        /// Products such as alpha*A*B + beta*C are evaluated by a single BLAST kernel call without temporaries.
+        ///
+        template <typename Expr>
+        requires IsExpression_v<Expr>
+        CustomStaticMatrix& operator=(Expr const& expr)
+        {
+            assign(*this, expr);
+            return *this;
+        }
+
+
+        constexpr T const& operator()(size_t i, size_t j) const noexcept
+        {
+            return v_[elementIndex(i, j)];
+        }
+
+
+        constexpr T& operator()(size_t i, size_t j) noexcept
+        {
+            return v_[elementIndex(i, j)];
+        }
+
+
+        static size_t constexpr rows() noexcept
+        {
+            return M;
+        }
+
+
+        static size_t constexpr columns() noexcept
+        {
+            return N;
+        }
+
+
+        static size_t constexpr spacing() noexcept
+        {
+            return S;
+        }
+
+
+        constexpr T * data() noexcept
+        {
+            return v_;
+        }
+
+
+        constexpr T const * data() const noexcept
+        {
+            return v_;
+        }
+
+
+        /**
+         * @brief Set all matrix elements to 0
+         */
+        void reset() noexcept
+        {
+            *this = T {};
+        }
+
+
+    private:
+        T * v_;
+
+
+        static size_t constexpr elementIndex(size_t i, size_t j) noexcept
+        {
+            return SO == columnMajor ? i + S * j : S * i + j;
+        }
+    };
+
+
+    template <typename T, size_t M, size_t N, bool SO, bool AF, bool PF, size_t S>
+    inline size_t constexpr rows(CustomStaticMatrix<T, M, N, SO, AF, PF, S> const& m) noexcept
+    {
+        return m.rows();
+    }
+
+
+    template <typename T, size_t M, size_t N, bool SO, bool AF, bool PF, size_t S>
+    inline size_t constexpr columns(CustomStaticMatrix<T, M, N, SO, AF, PF, S> const& m) noexcept
+    {
+        return m.columns();
+    }
+
+
+    template <typename T, size_t M, size_t N, bool SO, bool AF, bool PF, size_t S>
+    inline size_t constexpr spacing(CustomStaticMatrix<T, M, N, SO, AF, PF, S> const& m) noexcept
+    {
+        return m.spacing();
+    }
+
+
+    template <typename T, size_t M, size_t N, bool SO, bool AF, bool PF, size_t S>
+    inline constexpr T * data(CustomStaticMatrix<T, M, N, SO, AF, PF, S>& m) noexcept
+    {
+        return m.data();
+    }
+
+
+    template <typename T, size_t M, size_t N, bool SO, bool AF, bool PF, size_t S>
+    inline constexpr T const * data(CustomStaticMatrix<T, M, N, SO, AF, PF, S> const& m) noexcept
+    {
+        return m.data();
+    }
+
+
+    template <typename T, size_t M, size_t N, bool SO, bool AF, bool PF, size_t S>
+    inline void reset(CustomStaticMatrix<T, M, N, SO, AF, PF, S>& m) noexcept
+    {
+        m.reset();
+    }
+
+
+    template <typename T, size_t M, size_t N, bool SO, bool AF, bool PF, size_t S>
+    struct IsDenseMatrix<CustomStaticMatrix<T, M, N, SO, AF, PF, S>> : std::true_type {};
+
+
+    template <typename T, size_t M, size_t N, bool SO, bool AF, bool PF, size_t S>
+    struct IsStatic<CustomStaticMatrix<T, M, N, SO, AF, PF, S>> : std::true_type {};
+
+
+    template <typename T, size_t M, size_t N, bool SO, bool AF, bool PF, size_t S>
+    struct Spacing<CustomStaticMatrix<T, M, N, SO, AF, PF, S>> : std::integral_constant<size_t, S> {};
+
+
+    template <typename T, size_t M, size_t N, bool SO, bool AF, bool PF, size_t S>
+    struct StorageOrderHelper<CustomStaticMatrix<T, M, N, SO, AF, PF, S>> : std::integral_constant<StorageOrder, StorageOrder(SO)> {};
+
+
+    template <typename T, size_t M, size_t N, bool SO, bool AF, bool PF, size_t S>
+    struct IsAligned<CustomStaticMatrix<T, M, N, SO, AF, PF, S>> : std::integral_constant<bool, AF> {};
+
+
+    template <typename T, size_t M, size_t N, bool SO, bool AF, bool PF, size_t S>
+    struct IsPadded<CustomStaticMatrix<T, M, N, SO, AF, PF, S>> : std::integral_constant<bool, PF> {};
+}
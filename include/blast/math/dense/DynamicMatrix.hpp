@@ -6,20 +6,26 @@
 
 #include <blast/math/TypeTraits.hpp>
 #include <blast/math/StorageOrder.hpp>
+#include <blast/math/SpacingPolicy.hpp>
+#include <blast/math/Uninitialized.hpp>
 #include <blast/math/simd/SimdSize.hpp>
 #include <blast/system/CacheLine.hpp>
 #include <blast/system/Restrict.hpp>
 #include <blast/util/NextMultiple.hpp>
 #include <blast/util/Types.hpp>
 
-#include <new>
-#include <stdexcept>
+#include <algorithm>
+#include <memory_resource>
+#include <utility>
 
 
 namespace blast
 {
     /// @brief Row/column major matrix with dynamically defined size.
     ///
+    /// The memory is obtained from a @a std::pmr::memory_resource, which allows to allocate
+    /// matrices from an arena such as @a std::pmr::monotonic_buffer_resource.
+    ///
     /// @tparam T element type of the matrix
     /// @tparam SO storage order of panel elements
     ///
@@ -30,32 +36,119 @@ namespace blast
         using ElementType = T;
 
 
-        explicit DynamicMatrix(size_t m, size_t n)
+        /// @brief Create a matrix of given size with all elements initialized to 0.
+        ///
+        /// @param m number of rows
+        /// @param n number of columns
+        /// @param mr memory resource used to allocate the matrix elements
+        ///
+        explicit DynamicMatrix(size_t m, size_t n, std::pmr::memory_resource * mr = std::pmr::get_default_resource())
+        :   DynamicMatrix {m, n, DEFAULT_SPACING_POLICY, mr}
+        {
+        }
+
+
+        /// @brief Create a matrix of given size and spacing policy with all elements initialized to 0.
+        ///
+        /// @param m number of rows
+        /// @param n number of columns
+        /// @param policy spacing policy
+        /// @param mr memory resource used to allocate the matrix elements
+        ///
+        DynamicMatrix(size_t m, size_t n, SpacingPolicy policy, std::pmr::memory_resource * mr = std::pmr::get_default_resource())
+        :   DynamicMatrix {uninitialized, m, n, policy, mr}
+        {
+            std::fill_n(v_, capacity_, T {});
+        }
+
+
+        /// @brief Create a matrix of given size without initializing its elements.
+        ///
+        /// Only the padding elements are set to 0, see @a Uninitialized.
+        ///
+        /// @param m number of rows
+        /// @param n number of columns
+        /// @param mr memory resource used to allocate the matrix elements
+        ///
+        DynamicMatrix(Uninitialized, size_t m, size_t n, std::pmr::memory_resource * mr = std::pmr::get_default_resource())
+        :   DynamicMatrix {uninitialized, m, n, DEFAULT_SPACING_POLICY, mr}
+        {
+        }
+
+
+        /// @brief Create a matrix of given size and spacing policy without initializing its elements.
+        ///
+        /// Only the padding elements are set to 0, see @a Uninitialized.
+        ///
+        /// @param m number of rows
+        /// @param n number of columns
+        /// @param policy spacing policy
+        /// @param mr memory resource used to allocate the matrix elements
+        ///
+        DynamicMatrix(Uninitialized, size_t m, size_t n, SpacingPolicy policy, std::pmr::memory_resource * mr = std::pmr::get_default_resource())
         :   m_ {m}
         ,   n_ {n}
-        ,   spacing_ {nextMultiple(SO == columnMajor ? m : n, SimdSize_v<T>)}
-        // Initialize padding elements to 0 to prevent denorms in calculations.
-        // Denorms can significantly impair performance, see https://github.com/giaf/blasfeo/issues/103
-        ,   v_ {new(std::align_val_t {alignment_}) T[spacing_ * (SO == columnMajor ? n : m)] {}}
+        ,   spacing_ {adjustSpacing<T>(nextMultiple(SO == columnMajor ? m : n, SimdSize_v<T>), policy)}
+        ,   capacity_ {spacing_ * (SO == columnMajor ? n : m)}
+        ,   mr_ {mr}
+        ,   v_ {allocate(capacity_, mr)}
         {
+            // Initialize padding elements to 0 to prevent denorms in calculations.
+            // Denorms can significantly impair performance, see https://github.com/giaf/blasfeo/issues/103
+            size_t const inner = SO == columnMajor ? m_ : n_;
+            size_t const outer = SO == columnMajor ? n_ : m_;
+
+            if (inner < spacing_)
+                for (size_t k = 0; k < outer; ++k)
+                    std::fill_n(v_ + k * spacing_ + inner, spacing_ - inner, T {});
         }
 
 
+        /// @brief Copy constructor.
+        ///
+        /// Following @a std::pmr conventions, the copy uses the default memory resource.
+        ///
         DynamicMatrix(DynamicMatrix const& rhs)
+        :   DynamicMatrix {rhs, std::pmr::get_default_resource()}
+        {
+        }
+
+
+        /// @brief Copy a matrix using a specified memory resource.
+        ///
+        /// @param rhs matrix to copy
+        /// @param mr memory resource used to allocate the matrix elements
+        ///
+        DynamicMatrix(DynamicMatrix const& rhs, std::pmr::memory_resource * mr)
+        :   m_ {rhs.m_}
+        ,   n_ {rhs.n_}
+        ,   spacing_ {rhs.spacing_}
+        ,   capacity_ {rhs.capacity_}
+        ,   mr_ {mr}
+        ,   v_ {allocate(capacity_, mr)}
         {
-            throw std::logic_error {"Not implemented"};
+            std::copy_n(rhs.v_, capacity_, v_);
         }
 
 
+        /// @brief Move constructor.
+        ///
+        /// Takes over the memory and the memory resource of @a rhs, leaving @a rhs empty.
+        ///
         DynamicMatrix(DynamicMatrix&& rhs) noexcept
+        :   m_ {std::exchange(rhs.m_, 0)}
+        ,   n_ {std::exchange(rhs.n_, 0)}
+        ,   spacing_ {std::exchange(rhs.spacing_, 0)}
+        ,   capacity_ {std::exchange(rhs.capacity_, 0)}
+        ,   mr_ {rhs.mr_}
+        ,   v_ {std::exchange(rhs.v_, nullptr)}
         {
-            throw std::logic_error {"Not implemented"};
         }
 
 
         ~DynamicMatrix()
         {
-            delete[] v_;
+            deallocate();
         }
 
 
@@ -69,16 +162,62 @@ namespace blast
         }
 
 
-        DynamicMatrix& operator=(DynamicMatrix const& val)
+        /// @brief Evaluate a matrix expression, see @a assign().
+        ///
+        /// Products such as alpha*A*B + beta*C are evaluated by a single BLAST kernel call without temporaries.
+        ///
+        template <typename Expr>
+        requires IsExpression_v<Expr>
+        DynamicMatrix& operator=(Expr const& expr)
         {
-            throw std::logic_error {"Not implemented"};
+            assign(*this, expr);
             return *this;
         }
 
 
-        DynamicMatrix& operator=(DynamicMatrix&& val) noexcept
+        /// @brief Copy assignment.
+        ///
+        /// The memory is reallocated from the memory resource of this matrix if the sizes do not match.
+        ///
+        DynamicMatrix& operator=(DynamicMatrix const& rhs)
         {
-            throw std::logic_error {"Not implemented"};
+            if (this != &rhs)
+            {
+                if (capacity_ != rhs.capacity_)
+                {
+                    T * const v = allocate(rhs.capacity_, mr_);
+                    deallocate();
+                    v_ = v;
+                }
+
+                m_ = rhs.m_;
+                n_ = rhs.n_;
+                spacing_ = rhs.spacing_;
+                capacity_ = rhs.capacity_;
+                std::copy_n(rhs.v_, capacity_, v_);
+            }
+
+            return *this;
+        }
+
+
+        /// @brief Move assignment.
+        ///
+        /// Takes over the memory and the memory resource of @a rhs, leaving @a rhs empty.
+        ///
+        DynamicMatrix& operator=(DynamicMatrix&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                deallocate();
+                m_ = std::exchange(rhs.m_, 0);
+                n_ = std::exchange(rhs.n_, 0);
+                spacing_ = std::exchange(rhs.spacing_, 0);
+                capacity_ = std::exchange(rhs.capacity_, 0);
+                mr_ = rhs.mr_;
+                v_ = std::exchange(rhs.v_, nullptr);
+            }
+
             return *this;
         }
 
@@ -125,12 +264,21 @@ namespace blast
         }
 
 
+        /**
+         * @brief Memory resource used to allocate the matrix elements
+         */
+        std::pmr::memory_resource * resource() const noexcept
+        {
+            return mr_;
+        }
+
+
         /**
          * @brief Set all matrix elements to 0
          */
         void reset() noexcept
         {
-            std::fill_n(v_, spacing_ * (SO == columnMajor ? n_ : m_), T {});
+            std::fill_n(v_, capacity_, T {});
         }
 
 
@@ -141,9 +289,26 @@ namespace blast
         size_t m_;
         size_t n_;
         size_t spacing_;
+        size_t capacity_;
+        std::pmr::memory_resource * mr_;
         T * BLAST_RESTRICT v_;
 
 
+        static T * allocate(size_t capacity, std::pmr::memory_resource * mr)
+        {
+            return static_cast<T *>(mr->allocate(capacity * sizeof(T), alignment_));
+        }
+
+
+        void deallocate() noexcept
+        {
+            if (v_)
+                mr_->deallocate(v_, capacity_ * sizeof(T), alignment_);
+
+            v_ = nullptr;
+        }
+
+
         size_t elementIndex(size_t i, size_t j) const noexcept
         {
             return SO == columnMajor ? i + j * spacing_ : i * spacing_ + j;
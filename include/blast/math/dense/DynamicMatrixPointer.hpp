@@ -93,6 +93,15 @@ namespace blast
         }
 
 
+        /**
+         * @brief Hint the processor to bring the pointed element into the L1 cache.
+         */
+        void prefetch() const noexcept
+        {
+            blast::prefetch(ptr_);
+        }
+
+
         size_t spacing() const noexcept
         {
             return spacing_;
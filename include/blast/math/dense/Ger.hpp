@@ -5,6 +5,7 @@
 #pragma once
 
 #include <blast/util/Exception.hpp>
+#include <blast/util/Profile.hpp>
 #include <blast/system/Tile.hpp>
 #include <blast/math/RegisterMatrix.hpp>
 #include <blast/math/Matrix.hpp>
@@ -45,6 +46,8 @@ namespace blast
         MatrixPointer<MPB, Scalar> && (StorageOrder_v<MPB> == columnMajor)
     inline void ger(size_t M, size_t N, Scalar alpha, VPX x, VPY y, MPA A, MPB B)
     {
+        BLAST_PROFILE_SCOPE(ger, M, N);
+
         using ET = Scalar;
         size_t constexpr TILE_SIZE = TileSize_v<ET>;
 
@@ -251,6 +254,8 @@ namespace blast
         DenseMatrix<MT1, rowMajor>& B
     )
     {
+        BLAST_PROFILE_SCOPE(ger, size(x), size(y));
+
         size_t const M = size(x);
         size_t const N = size(y);
 
@@ -15,6 +15,7 @@
 #include <blast/math/dense/Trsm.hpp>
 #include <blast/math/algorithm/Gemm.hpp>
 #include <blast/system/Tile.hpp>
+#include <blast/util/Profile.hpp>
 
 #include <blaze/util/Exception.h>
 #include <blaze/util/constraints/SameType.h>
@@ -52,6 +53,8 @@ namespace blast
     template <typename MT>
     inline void getrf(DenseMatrix<MT, columnMajor>& A, size_t * ipiv)
     {
+        BLAST_PROFILE_SCOPE(getrf, rows(A), columns(A));
+
         using ET = ElementType_t<MT>;
         size_t constexpr NB = TileSize_v<ET>;
 
@@ -141,6 +144,8 @@ namespace blast
     template <typename MT>
     inline void getrf(DenseMatrix<MT, rowMajor>& A, size_t * ipiv)
     {
+        BLAST_PROFILE_SCOPE(getrf, rows(A), columns(A));
+
         using ET = ElementType_t<MT>;
 
         size_t const M = rows(A);
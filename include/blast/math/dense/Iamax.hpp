@@ -16,6 +16,7 @@
 
 
 #include <blast/util/Exception.hpp>
+#include <blast/util/Profile.hpp>
 #include <blast/math/Vector.hpp>
 
 #include <cmath>
@@ -67,6 +68,8 @@ namespace blast
     requires VectorPointer<VP>
     inline size_t iamax(size_t n, VP x)
     {
+        BLAST_PROFILE_SCOPE(iamax, n);
+
         BLAST_USER_ASSERT(n > 0, "Vector must be non-empty");
 
 #if 1
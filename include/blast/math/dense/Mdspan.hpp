@@ -0,0 +1,181 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <version>
+
+#if !defined(__cpp_lib_mdspan)
+#   error "std::mdspan is not supported by the standard library"
+#endif
+
+#include <blast/math/dense/CustomMatrix.hpp>
+#include <blast/math/dense/DynamicMatrixPointer.hpp>
+#include <blast/math/StorageOrder.hpp>
+#include <blast/system/Inline.hpp>
+#include <blast/util/Exception.hpp>
+#include <blast/util/Types.hpp>
+
+#include <mdspan>
+#include <stdexcept>
+#include <type_traits>
+
+
+namespace blast
+{
+    /// @brief @a std::mdspan accessor policy declaring the alignment and padding of the underlying storage.
+    ///
+    /// Elements are accessed in the same way as with @a std::default_accessor. The flags tell BLAST
+    /// that it can use aligned SIMD loads and stores (@a AF) and access whole SIMD registers
+    /// past the end of a row or a column (@a PF) of the matrix wrapped by an @a std::mdspan.
+    /// Neither guarantee holds for an offset data handle, e.g. of a submdspan.
+    ///
+    /// Without the guarantees, e.g. with @a std::default_accessor, @a gemm, @a syrkLower and @a ger
+    /// use masked SIMD loads and stores at the end of a column (row) and do not access memory outside the matrix.
+    /// Algorithms which need padded storage, such as dense @a potrf, do not accept unpadded matrices.
+    ///
+    /// @tparam T element type
+    /// @tparam AF true if the data handle is aligned on the SIMD register boundary
+    /// @tparam PF true if the storage is padded to a multiple of the SIMD size
+    ///
+    template <typename T, bool AF, bool PF>
+    struct SimdAccessor
+    {
+        using offset_policy = SimdAccessor<T, false, false>;
+        using element_type = T;
+        using reference = T&;
+        using data_handle_type = T *;
+
+        static bool constexpr aligned = AF;
+        static bool constexpr padded = PF;
+
+
+        constexpr SimdAccessor() noexcept = default;
+
+
+        /// @brief Conversion from an accessor with a non-const element type or stronger guarantees.
+        template <typename U, bool AF1, bool PF1>
+        requires std::is_convertible_v<U(*)[], T(*)[]> && (AF1 || !AF) && (PF1 || !PF)
+        constexpr SimdAccessor(SimdAccessor<U, AF1, PF1>) noexcept
+        {
+        }
+
+
+        constexpr reference access(data_handle_type p, size_t i) const noexcept
+        {
+            return p[i];
+        }
+
+
+        constexpr typename offset_policy::data_handle_type offset(data_handle_type p, size_t i) const noexcept
+        {
+            return p + i;
+        }
+    };
+
+
+    /// @brief Tests if an @a std::mdspan accessor policy guarantees SIMD-aligned storage.
+    ///
+    /// Specialize for user-defined accessors.
+    template <typename Accessor>
+    struct IsAlignedAccessor : std::false_type {};
+
+
+    template <typename T, bool AF, bool PF>
+    struct IsAlignedAccessor<SimdAccessor<T, AF, PF>> : std::integral_constant<bool, AF> {};
+
+
+    template <typename Accessor>
+    bool constexpr IsAlignedAccessor_v = IsAlignedAccessor<Accessor>::value;
+
+
+    /// @brief Tests if an @a std::mdspan accessor policy guarantees storage padded to a multiple of the SIMD size.
+    ///
+    /// Specialize for user-defined accessors.
+    template <typename Accessor>
+    struct IsPaddedAccessor : std::false_type {};
+
+
+    template <typename T, bool AF, bool PF>
+    struct IsPaddedAccessor<SimdAccessor<T, AF, PF>> : std::integral_constant<bool, PF> {};
+
+
+    template <typename Accessor>
+    bool constexpr IsPaddedAccessor_v = IsPaddedAccessor<Accessor>::value;
+
+
+    namespace detail
+    {
+        template <typename Layout>
+        struct MdspanStorageOrder;
+
+
+        template <>
+        struct MdspanStorageOrder<std::layout_left> : std::integral_constant<StorageOrder, columnMajor> {};
+
+
+        template <>
+        struct MdspanStorageOrder<std::layout_right> : std::integral_constant<StorageOrder, rowMajor> {};
+
+
+        template <typename Layout>
+        concept MdspanOrderedLayout = requires { MdspanStorageOrder<Layout>::value; };
+    }
+
+
+    /// @brief Matrix referring to the elements of a 2-dimensional @a std::mdspan with a given storage order.
+    ///
+    /// No elements are copied. Alignment and padding of the result are taken from the accessor policy.
+    /// This overload is intended for @a std::layout_stride, whose storage order is only known at run time.
+    ///
+    /// @tparam SO expected storage order; the elements of a column (row) of a column-major
+    /// (row-major) matrix must be contiguous
+    ///
+    /// @throw std::invalid_argument if the layout does not have the storage order @a SO,
+    /// or the strides and the data handle do not satisfy the accessor guarantees
+    ///
+    template <StorageOrder SO, typename T, typename Extents, typename Layout, typename Accessor>
+    requires (Extents::rank() == 2) && std::is_same_v<typename Accessor::data_handle_type, T *>
+    inline auto asMatrix(std::mdspan<T, Extents, Layout, Accessor> const& m)
+    {
+        size_t constexpr inner = SO == columnMajor ? 0 : 1;
+        size_t constexpr outer = 1 - inner;
+
+        if (m.extent(inner) > 1 && m.stride(inner) != 1)
+            BLAST_THROW_EXCEPTION(std::invalid_argument {"mdspan layout does not match the storage order"});
+
+        return CustomMatrix<T, SO, IsAlignedAccessor_v<Accessor>, IsPaddedAccessor_v<Accessor>>(
+            m.data_handle(), m.extent(0), m.extent(1), m.stride(outer));
+    }
+
+
+    /// @brief Matrix referring to the elements of a 2-dimensional @a std::mdspan
+    /// with @a std::layout_left or @a std::layout_right.
+    ///
+    /// No elements are copied. The result is column-major for @a std::layout_left and row-major for @a std::layout_right.
+    /// Alignment and padding of the result are taken from the accessor policy.
+    ///
+    /// @throw std::invalid_argument if the strides and the data handle do not satisfy the accessor guarantees
+    ///
+    template <typename T, typename Extents, detail::MdspanOrderedLayout Layout, typename Accessor>
+    requires (Extents::rank() == 2) && std::is_same_v<typename Accessor::data_handle_type, T *>
+    inline auto asMatrix(std::mdspan<T, Extents, Layout, Accessor> const& m)
+    {
+        return asMatrix<detail::MdspanStorageOrder<Layout>::value>(m);
+    }
+
+
+    /// @brief Pointer to element (i, j) of a 2-dimensional @a std::mdspan
+    /// with @a std::layout_left or @a std::layout_right.
+    ///
+    /// @tparam AF true if the pointed element is aligned
+    ///
+    template <bool AF, typename T, typename Extents, detail::MdspanOrderedLayout Layout, typename Accessor>
+    requires (Extents::rank() == 2) && std::is_same_v<typename Accessor::data_handle_type, T *>
+    BLAST_ALWAYS_INLINE auto ptr(std::mdspan<T, Extents, Layout, Accessor> const& m, size_t i, size_t j)
+    {
+        auto matrix = asMatrix(m);
+        return ptr<AF>(matrix, i, j);
+    }
+}
@@ -9,19 +9,22 @@
 #include <blast/math/RowColumnVectorPointer.hpp>
 #include <blast/math/RegisterMatrix.hpp>
 #include <blast/system/Tile.hpp>
+#include <blast/util/Profile.hpp>
 
 #include <blast/blaze/Math.hpp>
 
 #include <algorithm>
+#include <type_traits>
 
 
 namespace blast
 {
     template <size_t KM, size_t KN, typename MT1, typename MT2>
-    BLAZE_ALWAYS_INLINE void potrf_backend(size_t k, size_t i,
-        blaze::DenseMatrix<MT1, columnMajor> const& A, blaze::DenseMatrix<MT2, columnMajor>& L)
+    BLAZE_ALWAYS_INLINE void potrf_backend(size_t k, size_t i, MT1 const& A, MT2& L)
     {
-        using ET = blaze::ElementType_t<MT1>;
+        using ET = ElementType_t<MT1>;
+        bool constexpr AF1 = IsAligned_v<MT1>;
+        bool constexpr AF2 = IsAligned_v<MT2>;
         size_t constexpr TILE_SIZE = TileSize_v<ET>;
 
         size_t const M = rows(A);
@@ -32,10 +35,10 @@ namespace blast
 
         RegisterMatrix<ET, KM, KN, columnMajor> ker;
 
-        ker.load(1., ptr<aligned>(*A, i, k));
+        ker.load(1., ptr<AF1>(A, i, k));
 
-        auto a = ptr<aligned>(*L, i, 0);
-        auto b = ptr<aligned>(*L, k, 0);
+        auto a = ptr<AF2>(L, i, 0);
+        auto b = ptr<AF2>(L, k, 0);
 
         for (size_t l = 0; l < k; ++l)
             ker.ger(ET(-1.), column(a(0, l)), row(trans(b)(l, 0)));
@@ -46,31 +49,47 @@ namespace blast
             ker.potrf();
 
             if (k + KN <= N)
-                ker.storeLower(ptr<aligned>(*L, i, k));
+                ker.storeLower(ptr<AF2>(L, i, k));
             else
-                ker.storeLower(ptr<aligned>(*L, i, k), std::min(M - i, KM), N - k);
+                ker.storeLower(ptr<AF2>(L, i, k), std::min(M - i, KM), N - k);
         }
         else
         {
             // Off-diagonal blocks
-            ker.trsm(Side::Right, UpLo::Upper, ptr<aligned>(*L, k, k).trans());
+            ker.trsm(Side::Right, UpLo::Upper, ptr<AF2>(L, k, k).trans());
 
             if (k + KN <= N)
-                ker.store(ptr<aligned>(*L, i, k));
+                ker.store(ptr<AF2>(L, i, k));
             else
-                ker.store(ptr<aligned>(*L, i, k), std::min(M - i, KM), N - k);
+                ker.store(ptr<AF2>(L, i, k), std::min(M - i, KM), N - k);
         }
     }
 
 
-    template <typename MT1, typename MT2>
-    inline void potrf(
-        blaze::DenseMatrix<MT1, columnMajor> const& A, blaze::DenseMatrix<MT2, columnMajor>& L)
+    /**
+     * @brief Cholesky decomposition of a column-major dense matrix
+     *
+     * L := chol(A), where L is lower-triangular.
+     *
+     * Only the lower triangle of A is read, and only the lower triangle of L is written.
+     * Works with padded Blaze dense matrices and with padded BLAST dense matrices such as
+     * @a DynamicMatrix, @a StaticMatrix and @a CustomMatrix.
+     *
+     * @param A the matrix to decompose
+     * @param L the output matrix
+     */
+    template <Matrix MT1, Matrix MT2>
+    requires IsDenseMatrix_v<MT1> && IsDenseMatrix_v<MT2>
+        && (StorageOrder_v<MT1> == columnMajor) && (StorageOrder_v<MT2> == columnMajor)
+        && IsPadded_v<MT1> && IsPadded_v<MT2>
+    inline void potrf(MT1 const& A, MT2& L)
     {
-        using ET = blaze::ElementType_t<MT1>;
+        BLAST_PROFILE_SCOPE(potrf, rows(A), columns(A));
+
+        using ET = ElementType_t<MT1>;
         size_t constexpr TILE_SIZE = TileSize_v<ET>;
 
-        BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE(blaze::ElementType_t<MT2>, ET);
+        static_assert(std::is_same_v<ElementType_t<MT2>, ET>, "Matrix element types must be the same");
 
         size_t const M = rows(A);
         size_t const N = columns(A);
@@ -95,13 +114,13 @@ namespace blast
             size_t i = k;
 
             for (; i + 2 * TILE_SIZE < M; i += 3 * TILE_SIZE)
-                potrf_backend<3 * TILE_SIZE, KN>(k, i, *A, *L);
+                potrf_backend<3 * TILE_SIZE, KN>(k, i, A, L);
 
             for (; i + 1 * TILE_SIZE < M; i += 2 * TILE_SIZE)
-                potrf_backend<2 * TILE_SIZE, KN>(k, i, *A, *L);
+                potrf_backend<2 * TILE_SIZE, KN>(k, i, A, L);
 
             for (; i + 0 * TILE_SIZE < M; i += 1 * TILE_SIZE)
-                potrf_backend<1 * TILE_SIZE, KN>(k, i, *A, *L);
+                potrf_backend<1 * TILE_SIZE, KN>(k, i, A, L);
         }
     }
 }
@@ -6,6 +6,7 @@
 
 #include <blast/math/Forward.hpp>
 #include <blast/math/StorageOrder.hpp>
+#include <blast/math/Uninitialized.hpp>
 #include <blast/math/Simd.hpp>
 #include <blast/math/TypeTraits.hpp>
 #include <blast/system/CacheLine.hpp>
@@ -40,6 +41,24 @@ namespace blast
         }
 
 
+        /**
+         * @brief Create a matrix without initializing its elements.
+         *
+         * Only the padding elements are set to 0, see @a Uninitialized.
+         */
+        explicit StaticMatrix(Uninitialized) noexcept
+        {
+            // Initialize padding elements to 0 to prevent denorms in calculations.
+            // Denorms can significantly impair performance, see https://github.com/giaf/blasfeo/issues/103
+            size_t constexpr inner = SO == columnMajor ? M : N;
+            size_t constexpr outer = SO == columnMajor ? N : M;
+
+            if constexpr (inner < spacing_)
+                for (size_t k = 0; k < outer; ++k)
+                    std::fill_n(v_ + k * spacing_ + inner, spacing_ - inner, T {});
+        }
+
+
         StaticMatrix(T const& v) noexcept
         {
             std::fill_n(v_, capacity_, v);
@@ -97,6 +116,20 @@ namespace blast
         }
 
 
+        /**
+         * @brief Evaluate a matrix expression, see @a assign().
+         *
+         * Products such as alpha*A*B + beta*C are evaluated by a single BLAST kernel call without temporaries.
+         */
+        template <typename Expr>
+        requires IsExpression_v<Expr>
+        StaticMatrix& operator=(Expr const& expr)
+        {
+            assign(*this, expr);
+            return *this;
+        }
+
+
         constexpr T const& operator()(size_t i, size_t j) const noexcept
         {
             return v_[elementIndex(i, j)];
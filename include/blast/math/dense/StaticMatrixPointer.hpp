@@ -9,6 +9,7 @@
 #include <blast/math/simd/SimdVec.hpp>
 #include <blast/math/simd/SimdMask.hpp>
 #include <blast/math/simd/IsSimdAligned.hpp>
+#include <blast/math/simd/Prefetch.hpp>
 #include <blast/math/TypeTraits.hpp>
 #include <blast/util/Assert.hpp>
 
@@ -94,6 +95,15 @@ namespace blast
         }
 
 
+        /**
+         * @brief Hint the processor to bring the pointed element into the L1 cache.
+         */
+        void prefetch() const noexcept
+        {
+            blast::prefetch(ptr_);
+        }
+
+
         /**
          * @brief Offset pointer by specified number of rows and columns
          *
@@ -6,32 +6,78 @@
 
 #include <blast/math/dense/SyrkBackend.hpp>
 #include <blast/math/register_matrix/Gemm.hpp>
+#include <blast/math/algorithm/Epilogue.hpp>
+#include <blast/math/ScalarTag.hpp>
 #include <blast/system/Tile.hpp>
+#include <blast/math/Matrix.hpp>
+#include <blast/math/TypeTraits.hpp>
+#include <blast/util/Exception.hpp>
+#include <blast/util/Profile.hpp>
 #include <blast/blaze/Math.hpp>
 
+#include <stdexcept>
+#include <type_traits>
+
 
 namespace blast
 {
-    template <typename ST1, typename MT1, typename ST2, typename MT2, typename MT3>
-    inline void syrkLower(
-        ST1 alpha,
-        DenseMatrix<MT1, columnMajor> const& A,
-        ST2 beta, DenseMatrix<MT2, columnMajor> const& C, DenseMatrix<MT3, columnMajor>& D)
+    namespace detail
+    {
+        /// @brief R := beta * C; C is not read if @a beta is @a Zero.
+        template <typename T, size_t M, size_t N, StorageOrder SO, typename ST, typename P, typename... Args>
+        BLAST_ALWAYS_INLINE void syrkLoadC(RegisterMatrix<T, M, N, SO>& ker, ST beta, P c, Args... args) noexcept
+        {
+            if constexpr (std::is_same_v<ST, Zero>)
+                ker.reset();
+            else
+                ker.load(T(beta), c, args...);
+        }
+    }
+
+
+    /**
+     * @brief Symmetric rank-k update with an epilogue
+     *
+     * D := epilogue(alpha*A*A^T + beta*C)
+     *
+     * Only the lower triangle of D is computed.
+     *
+     * For every register tile of the lower triangle of D, @a epilogue is called as
+     *
+     * epilogue(ker, i, j, m, n);
+     *
+     * before the tile is stored, see @a NoEpilogue.
+     *
+     * @param alpha the scalar alpha
+     * @param A the matrix A
+     * @param beta the scalar beta
+     * @param C the matrix C
+     * @param D the output matrix D
+     * @param epilogue functor applied to each register tile before it is stored
+     */
+    template <typename ST1, Matrix MT1, typename ST2, Matrix MT2, Matrix MT3, typename F>
+    requires (StorageOrder_v<MT1> == columnMajor && StorageOrder_v<MT2> == columnMajor && StorageOrder_v<MT3> == columnMajor)
+    inline void syrkLower(ST1 alpha, MT1 const& A, ST2 beta, MT2 const& C, MT3& D, F&& epilogue)
     {
-        using ET = ElementType_t<MT1>;
+        BLAST_PROFILE_SCOPE(syrk, rows(A), columns(A));
+
+        using ET = std::remove_cv_t<ElementType_t<MT1>>;
+        bool constexpr AF1 = IsAligned_v<MT1>;
+        bool constexpr AF2 = IsAligned_v<MT2>;
+        bool constexpr AF3 = IsAligned_v<MT3>;
         size_t constexpr TILE_SIZE = TileSize_v<ET>;
 
-        BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE(ElementType_t<MT2>, ET);
-        BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE(ElementType_t<MT3>, ET);
+        static_assert(std::is_same_v<std::remove_cv_t<ElementType_t<MT2>>, ET>);
+        static_assert(std::is_same_v<std::remove_cv_t<ElementType_t<MT3>>, ET>);
 
         size_t const M = rows(A);
         size_t const K = columns(A);
 
         if (rows(C) != M || columns(C) != M)
-            BLAZE_THROW_INVALID_ARGUMENT("Matrix sizes do not match");
+            BLAST_THROW_EXCEPTION(std::invalid_argument {"Matrix sizes do not match"});
 
         if (rows(D) != M || columns(D) != M)
-            BLAZE_THROW_INVALID_ARGUMENT("Matrix sizes do not match");
+            BLAST_THROW_EXCEPTION(std::invalid_argument {"Matrix sizes do not match"});
 
         size_t j = 0;
 
@@ -45,46 +91,50 @@ namespace blast
             for (; i + 3 * TILE_SIZE <= M && i + 4 * TILE_SIZE != M; i += 3 * TILE_SIZE)
             {
                 RegisterMatrix<ET, 3 * TILE_SIZE, TILE_SIZE, columnMajor> ker;
-                ker.load(beta, ptr<aligned>(*C, i, j));
-                gemm(ker, K, alpha, ptr<aligned>(*A, i, 0), trans(ptr<aligned>(*A, j, 0)));
+                detail::syrkLoadC(ker, beta, ptr<AF2>(C, i, j));
+                gemm(ker, K, alpha, ptr<AF1>(A, i, 0), trans(ptr<AF1>(A, j, 0)));
+                epilogue(ker, i, j, ker.rows(), ker.columns());
                 if (i == j)
-                    ker.storeLower(ptr<aligned>(*D, i, j));
+                    ker.storeLower(ptr<AF3>(D, i, j));
                 else
-                    ker.store(ptr<aligned>(*D, i, j));
+                    ker.store(ptr<AF3>(D, i, j));
             }
 
             for (; i + 2 * TILE_SIZE <= M; i += 2 * TILE_SIZE)
             {
                 RegisterMatrix<ET, 2 * TILE_SIZE, TILE_SIZE, columnMajor> ker;
-                ker.load(beta, ptr<aligned>(*C, i, j));
-                gemm(ker, K, alpha, ptr<aligned>(*A, i, 0), trans(ptr<aligned>(*A, j, 0)));
+                detail::syrkLoadC(ker, beta, ptr<AF2>(C, i, j));
+                gemm(ker, K, alpha, ptr<AF1>(A, i, 0), trans(ptr<AF1>(A, j, 0)));
+                epilogue(ker, i, j, ker.rows(), ker.columns());
                 if (i == j)
-                    ker.storeLower(ptr<aligned>(*D, i, j));
+                    ker.storeLower(ptr<AF3>(D, i, j));
                 else
-                    ker.store(ptr<aligned>(*D, i, j));
+                    ker.store(ptr<AF3>(D, i, j));
             }
 
             for (; i + 1 * TILE_SIZE <= M; i += 1 * TILE_SIZE)
             {
                 RegisterMatrix<ET, 1 * TILE_SIZE, TILE_SIZE, columnMajor> ker;
-                ker.load(beta, ptr<aligned>(*C, i, j));
-                gemm(ker, K, alpha, ptr<aligned>(*A, i, 0), trans(ptr<aligned>(*A, j, 0)));
+                detail::syrkLoadC(ker, beta, ptr<AF2>(C, i, j));
+                gemm(ker, K, alpha, ptr<AF1>(A, i, 0), trans(ptr<AF1>(A, j, 0)));
+                epilogue(ker, i, j, ker.rows(), ker.columns());
                 if (i == j)
-                    ker.storeLower(ptr<aligned>(*D, i, j));
+                    ker.storeLower(ptr<AF3>(D, i, j));
                 else
-                    ker.store(ptr<aligned>(*D, i, j));
+                    ker.store(ptr<AF3>(D, i, j));
             }
 
             // Bottom side
             if (i < M)
             {
                 RegisterMatrix<ET, TILE_SIZE, TILE_SIZE, columnMajor> ker;
-                ker.load(beta, ptr<aligned>(*C, i, j), M - i, ker.columns());
-                gemm(ker, K, alpha, ptr<aligned>(*A, i, 0), trans(ptr<aligned>(*A, j, 0)), M - i, ker.columns());
+                detail::syrkLoadC(ker, beta, ptr<AF2>(C, i, j), M - i, ker.columns());
+                gemm(ker, K, alpha, ptr<AF1>(A, i, 0), trans(ptr<AF1>(A, j, 0)), M - i, ker.columns());
+                epilogue(ker, i, j, M - i, ker.columns());
                 if (i == j)
-                    ker.storeLower(ptr<aligned>(*D, i, j), M - i, ker.columns());
+                    ker.storeLower(ptr<AF3>(D, i, j), M - i, ker.columns());
                 else
-                    ker.store(ptr<aligned>(*D, i, j), M - i, ker.columns());
+                    ker.store(ptr<AF3>(D, i, j), M - i, ker.columns());
             }
         }
 
@@ -99,48 +149,73 @@ namespace blast
             for (; i + 3 * TILE_SIZE <= M && i + 4 * TILE_SIZE != M; i += 3 * TILE_SIZE)
             {
                 RegisterMatrix<ET, 3 * TILE_SIZE, TILE_SIZE, columnMajor> ker;
-                ker.load(beta, ptr<aligned>(*C, i, j), ker.rows(), M - j);
-                gemm(ker, K, alpha, ptr<aligned>(*A, i, 0), trans(ptr<aligned>(*A, j, 0)), ker.rows(), M - j);
+                detail::syrkLoadC(ker, beta, ptr<AF2>(C, i, j), ker.rows(), M - j);
+                gemm(ker, K, alpha, ptr<AF1>(A, i, 0), trans(ptr<AF1>(A, j, 0)), ker.rows(), M - j);
+                epilogue(ker, i, j, ker.rows(), M - j);
 
                 if (i == j)
-                    ker.storeLower(ptr<aligned>(*D, i, j), ker.rows(), M - j);
+                    ker.storeLower(ptr<AF3>(D, i, j), ker.rows(), M - j);
                 else
-                    ker.store(ptr<aligned>(*D, i, j), ker.rows(), M - j);
+                    ker.store(ptr<AF3>(D, i, j), ker.rows(), M - j);
             }
 
             for (; i + 2 * TILE_SIZE <= M; i += 2 * TILE_SIZE)
             {
                 RegisterMatrix<ET, 2 * TILE_SIZE, TILE_SIZE, columnMajor> ker;
-                ker.load(beta, ptr<aligned>(*C, i, j), ker.rows(), M - j);
-                gemm(ker, K, alpha, ptr<aligned>(*A, i, 0), trans(ptr<aligned>(*A, j, 0)), ker.rows(), M - j);
+                detail::syrkLoadC(ker, beta, ptr<AF2>(C, i, j), ker.rows(), M - j);
+                gemm(ker, K, alpha, ptr<AF1>(A, i, 0), trans(ptr<AF1>(A, j, 0)), ker.rows(), M - j);
+                epilogue(ker, i, j, ker.rows(), M - j);
                 if (i == j)
-                    ker.storeLower(ptr<aligned>(*D, i, j), ker.rows(), M - j);
+                    ker.storeLower(ptr<AF3>(D, i, j), ker.rows(), M - j);
                 else
-                    ker.store(ptr<aligned>(*D, i, j), ker.rows(), M - j);
+                    ker.store(ptr<AF3>(D, i, j), ker.rows(), M - j);
             }
 
             for (; i + 1 * TILE_SIZE <= M; i += 1 * TILE_SIZE)
             {
                 RegisterMatrix<ET, 1 * TILE_SIZE, TILE_SIZE, columnMajor> ker;
-                ker.load(beta, ptr<aligned>(*C, i, j), ker.rows(), M - j);
-                gemm(ker, K, alpha, ptr<aligned>(*A, i, 0), trans(ptr<aligned>(*A, j, 0)), ker.rows(), M - j);
+                detail::syrkLoadC(ker, beta, ptr<AF2>(C, i, j), ker.rows(), M - j);
+                gemm(ker, K, alpha, ptr<AF1>(A, i, 0), trans(ptr<AF1>(A, j, 0)), ker.rows(), M - j);
+                epilogue(ker, i, j, ker.rows(), M - j);
                 if (i == j)
-                    ker.storeLower(ptr<aligned>(*D, i, j), ker.rows(), M - j);
+                    ker.storeLower(ptr<AF3>(D, i, j), ker.rows(), M - j);
                 else
-                    ker.store(ptr<aligned>(*D, i, j), ker.rows(), M - j);
+                    ker.store(ptr<AF3>(D, i, j), ker.rows(), M - j);
             }
 
             // Bottom-right corner
             if (i < M)
             {
                 RegisterMatrix<ET, TILE_SIZE, TILE_SIZE, columnMajor> ker;
-                ker.load(beta, ptr<aligned>(*C, i, j), ker.rows(), M - j);
-                gemm(ker, K, alpha, ptr<aligned>(*A, i, 0), trans(ptr<aligned>(*A, j, 0)), M - i, M - j);
+                detail::syrkLoadC(ker, beta, ptr<AF2>(C, i, j), M - i, M - j);
+                gemm(ker, K, alpha, ptr<AF1>(A, i, 0), trans(ptr<AF1>(A, j, 0)), M - i, M - j);
+                epilogue(ker, i, j, M - i, M - j);
                 if (i == j)
-                    ker.storeLower(ptr<aligned>(*D, i, j), M - i, M - j);
+                    ker.storeLower(ptr<AF3>(D, i, j), M - i, M - j);
                 else
-                    ker.store(ptr<aligned>(*D, i, j), M - i, M - j);
+                    ker.store(ptr<AF3>(D, i, j), M - i, M - j);
             }
         }
     }
+
+
+    /**
+     * @brief Symmetric rank-k update
+     *
+     * D := alpha*A*A^T + beta*C
+     *
+     * Only the lower triangle of D is computed.
+     *
+     * @param alpha the scalar alpha
+     * @param A the matrix A
+     * @param beta the scalar beta
+     * @param C the matrix C
+     * @param D the output matrix D
+     */
+    template <typename ST1, Matrix MT1, typename ST2, Matrix MT2, Matrix MT3>
+    requires (StorageOrder_v<MT1> == columnMajor && StorageOrder_v<MT2> == columnMajor && StorageOrder_v<MT3> == columnMajor)
+    inline void syrkLower(ST1 alpha, MT1 const& A, ST2 beta, MT2 const& C, MT3& D)
+    {
+        syrkLower(alpha, A, beta, C, D, NoEpilogue {});
+    }
 }
@@ -0,0 +1,242 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <blast/math/expressions/Operand.hpp>
+#include <blast/math/expressions/MatMatMultExpr.hpp>
+#include <blast/math/expressions/MatScalarMultExpr.hpp>
+#include <blast/math/expressions/MatTransExpr.hpp>
+#include <blast/math/algorithm/Gemm.hpp>
+#include <blast/math/dense/Syrk.hpp>
+#include <blast/math/ScalarTag.hpp>
+#include <blast/math/TypeTraits.hpp>
+#include <blast/util/Exception.hpp>
+#include <blast/util/Types.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+
+namespace blast
+{
+    /**
+     * @brief Expression object for alpha*A*B + beta*C
+     *
+     * Assigning the expression to a dense matrix D evaluates it with a single @a gemm() call,
+     * without temporaries. D can be the same matrix as C, but not as A or B.
+     *
+     * @tparam MT1 type of the matrix A
+     * @tparam MT2 type of the matrix B
+     * @tparam ST1 type of the scalar alpha
+     * @tparam MT3 type of the matrix C
+     * @tparam ST2 type of the scalar beta
+     */
+    template <typename MT1, typename MT2, typename ST1, typename MT3, typename ST2>
+    class MatMatMultAddExpr
+    {
+    public:
+        using ElementType = std::remove_cv_t<ElementType_t<MT1>>;
+        using ProductType = MatMatMultExpr<MT1, MT2, ST1>;
+
+
+        MatMatMultAddExpr(ProductType const& product, MT3 const& addend, ST2 scalar)
+        :   product_ {product}
+        ,   addend_ {addend}
+        ,   scalar_ {scalar}
+        {
+            if (rows(addend) != rows(product) || columns(addend) != columns(product))
+                BLAST_THROW_EXCEPTION(std::invalid_argument {"Matrix sizes do not match"});
+        }
+
+
+        /**
+         * @brief 2D-access to the elements of the expression.
+         *
+         * Computes one element of the product, which is inefficient; use assignment to evaluate the expression.
+         *
+         * @param i row index
+         * @param j column index
+         *
+         * @return The resulting value.
+         */
+        ElementType operator()(size_t i, size_t j) const noexcept
+        {
+            return product_(i, j) + ElementType(scalar_) * addend_(i, j);
+        }
+
+
+        friend size_t rows(MatMatMultAddExpr const& e) noexcept
+        {
+            return rows(e.addend_);
+        }
+
+
+        friend size_t columns(MatMatMultAddExpr const& e) noexcept
+        {
+            return columns(e.addend_);
+        }
+
+
+        /**
+         * @brief Returns the product alpha*A*B.
+         */
+        ProductType const& product() const noexcept
+        {
+            return product_;
+        }
+
+
+        /**
+         * @brief Returns the matrix C.
+         */
+        MT3 const& addend() const noexcept
+        {
+            return addend_;
+        }
+
+
+        /**
+         * @brief Returns the scalar beta.
+         */
+        ST2 scalar() const noexcept
+        {
+            return scalar_;
+        }
+
+    private:
+        ProductType product_;
+        detail::OperandStorage_t<MT3> addend_;
+        ST2 scalar_;
+    };
+
+
+    template <typename MT1, typename MT2, typename ST1, typename MT3, typename ST2>
+    struct IsExpression<MatMatMultAddExpr<MT1, MT2, ST1, MT3, ST2>> : std::integral_constant<bool, true> {};
+
+
+    /**
+     * @brief Sum of a matrix product and a dense matrix
+     *
+     * @return expression representing alpha*A*B + C
+     */
+    template <typename MT1, typename MT2, typename ST1, detail::DenseOperand MT3>
+    inline auto operator+(MatMatMultExpr<MT1, MT2, ST1> const& AB, MT3 const& C)
+    {
+        return MatMatMultAddExpr<MT1, MT2, ST1, MT3, One> {AB, C, one};
+    }
+
+
+    /**
+     * @brief Sum of a dense matrix and a matrix product
+     *
+     * @return expression representing alpha*A*B + C
+     */
+    template <detail::DenseOperand MT3, typename MT1, typename MT2, typename ST1>
+    inline auto operator+(MT3 const& C, MatMatMultExpr<MT1, MT2, ST1> const& AB)
+    {
+        return AB + C;
+    }
+
+
+    /**
+     * @brief Sum of a matrix product and a scaled dense matrix
+     *
+     * @return expression representing alpha*A*B + beta*C
+     */
+    template <typename MT1, typename MT2, typename ST1, typename MT3, typename ST2>
+    inline auto operator+(MatMatMultExpr<MT1, MT2, ST1> const& AB, MatScalarMultExpr<MT3, ST2> const& C)
+    {
+        return MatMatMultAddExpr<MT1, MT2, ST1, MT3, ST2> {AB, C.operand(), C.scalar()};
+    }
+
+
+    /**
+     * @brief Sum of a scaled dense matrix and a matrix product
+     *
+     * @return expression representing alpha*A*B + beta*C
+     */
+    template <typename MT3, typename ST2, typename MT1, typename MT2, typename ST1>
+    inline auto operator+(MatScalarMultExpr<MT3, ST2> const& C, MatMatMultExpr<MT1, MT2, ST1> const& AB)
+    {
+        return AB + C;
+    }
+
+
+    /**
+     * @brief Difference of a matrix product and a dense matrix
+     *
+     * @return expression representing alpha*A*B - C
+     */
+    template <typename MT1, typename MT2, typename ST1, detail::DenseOperand MT3>
+    inline auto operator-(MatMatMultExpr<MT1, MT2, ST1> const& AB, MT3 const& C)
+    {
+        using ET = std::remove_cv_t<ElementType_t<MT3>>;
+        return MatMatMultAddExpr<MT1, MT2, ST1, MT3, ET> {AB, C, ET(-1)};
+    }
+
+
+    /**
+     * @brief Difference of a matrix product and a scaled dense matrix
+     *
+     * @return expression representing alpha*A*B - beta*C
+     */
+    template <typename MT1, typename MT2, typename ST1, typename MT3, typename ST2>
+    requires std::is_arithmetic_v<ST2>
+    inline auto operator-(MatMatMultExpr<MT1, MT2, ST1> const& AB, MatScalarMultExpr<MT3, ST2> const& C)
+    {
+        return MatMatMultAddExpr<MT1, MT2, ST1, MT3, ST2> {AB, C.operand(), -C.scalar()};
+    }
+
+
+    /**
+     * @brief Evaluate D := alpha*A*B + beta*C
+     *
+     * @param D output matrix
+     * @param expr expression
+     *
+     * @return @a D
+     *
+     * @throw std::invalid_argument if @a D is an operand of the product; it may be the same matrix as C
+     */
+    template <Matrix MT, typename MT1, typename MT2, typename ST1, typename MT3, typename ST2>
+    inline MT& assign(MT& D, MatMatMultAddExpr<MT1, MT2, ST1, MT3, ST2> const& expr)
+    {
+        auto const& AB = expr.product();
+
+        if (detail::refersTo(AB.leftOperand(), D) || detail::refersTo(AB.rightOperand(), D))
+            BLAST_THROW_EXCEPTION(std::invalid_argument {"Output matrix aliases an operand of the product"});
+
+        gemm(AB.scalar(), AB.leftOperand(), AB.rightOperand(), expr.scalar(), expr.addend(), D);
+        return D;
+    }
+
+
+    /**
+     * @brief Evaluate the lower triangle of D := alpha*A*A^T + beta*C
+     *
+     * Evaluated with a single @a syrkLower() call. The strictly upper triangles of C and D are not referenced.
+     * A, C and D must be column-major. D must not be the same matrix as A.
+     *
+     * @param D output matrix
+     * @param expr expression, which must be of the form alpha*A*trans(A) + beta*C
+     *
+     * @return @a D
+     */
+    template <Matrix MT, typename MT1, typename ST1, typename MT3, typename ST2>
+    inline MT& assignLower(MT& D, MatMatMultAddExpr<MT1, MatTransExpr<MT1>, ST1, MT3, ST2> const& expr)
+    {
+        auto const& AAT = expr.product();
+
+        if (std::addressof(AAT.rightOperand().operand()) != std::addressof(AAT.leftOperand()))
+            BLAST_THROW_EXCEPTION(std::invalid_argument {"Expression is not of the form A*trans(A) + C"});
+
+        if (detail::refersTo(AAT.leftOperand(), D))
+            BLAST_THROW_EXCEPTION(std::invalid_argument {"Output matrix aliases an operand of the product"});
+
+        syrkLower(AAT.scalar(), AAT.leftOperand(), expr.scalar(), expr.addend(), D);
+        return D;
+    }
+}
@@ -0,0 +1,195 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <blast/math/expressions/Operand.hpp>
+#include <blast/math/expressions/MatScalarMultExpr.hpp>
+#include <blast/math/expressions/MatTransExpr.hpp>
+#include <blast/math/algorithm/Gemm.hpp>
+#include <blast/math/dense/Syrk.hpp>
+#include <blast/math/ScalarTag.hpp>
+#include <blast/math/TypeTraits.hpp>
+#include <blast/util/Exception.hpp>
+#include <blast/util/Types.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+
+namespace blast
+{
+    /**
+     * @brief Expression object for the scaled product of two dense matrices alpha*A*B
+     *
+     * Assigning the expression to a dense matrix D evaluates it with a single @a gemm() call,
+     * without temporaries. D must not be the same matrix as A or B; assignment throws @a std::invalid_argument if it is.
+     *
+     * @tparam MT1 type of the left-hand side matrix A
+     * @tparam MT2 type of the right-hand side matrix B
+     * @tparam ST scalar type, @a One if the product is not scaled
+     */
+    template <typename MT1, typename MT2, typename ST>
+    class MatMatMultExpr
+    {
+    public:
+        using ElementType = std::remove_cv_t<ElementType_t<MT1>>;
+
+
+        MatMatMultExpr(MT1 const& lhs, MT2 const& rhs, ST scalar)
+        :   lhs_ {lhs}
+        ,   rhs_ {rhs}
+        ,   scalar_ {scalar}
+        {
+            if (columns(lhs) != rows(rhs))
+                BLAST_THROW_EXCEPTION(std::invalid_argument {"Matrix sizes do not match"});
+        }
+
+
+        /**
+         * @brief 2D-access to the elements of the product.
+         *
+         * Computes one element of the product, which is inefficient; use assignment to evaluate the expression.
+         *
+         * @param i row index
+         * @param j column index
+         *
+         * @return The resulting value.
+         */
+        ElementType operator()(size_t i, size_t j) const noexcept
+        {
+            ElementType s {};
+
+            for (size_t k = 0; k < columns(lhs_); ++k)
+                s += lhs_(i, k) * rhs_(k, j);
+
+            return ElementType(scalar_) * s;
+        }
+
+
+        friend size_t rows(MatMatMultExpr const& e) noexcept
+        {
+            return rows(e.lhs_);
+        }
+
+
+        friend size_t columns(MatMatMultExpr const& e) noexcept
+        {
+            return columns(e.rhs_);
+        }
+
+
+        /**
+         * @brief Returns the left-hand side matrix operand.
+         */
+        MT1 const& leftOperand() const noexcept
+        {
+            return lhs_;
+        }
+
+
+        /**
+         * @brief Returns the right-hand side matrix operand.
+         */
+        MT2 const& rightOperand() const noexcept
+        {
+            return rhs_;
+        }
+
+
+        /**
+         * @brief Returns the scalar operand.
+         */
+        ST scalar() const noexcept
+        {
+            return scalar_;
+        }
+
+    private:
+        detail::OperandStorage_t<MT1> lhs_;
+        detail::OperandStorage_t<MT2> rhs_;
+        ST scalar_;
+    };
+
+
+    template <typename MT1, typename MT2, typename ST>
+    struct IsExpression<MatMatMultExpr<MT1, MT2, ST>> : std::integral_constant<bool, true> {};
+
+
+    /**
+     * @brief Product of two dense matrices
+     *
+     * @param A left-hand side matrix
+     * @param B right-hand side matrix
+     *
+     * @return expression representing A*B
+     */
+    template <detail::DenseOperand MT1, detail::DenseOperand MT2>
+    inline auto operator*(MT1 const& A, MT2 const& B)
+    {
+        return MatMatMultExpr<MT1, MT2, One> {A, B, one};
+    }
+
+
+    /**
+     * @brief Product of a scaled dense matrix and a dense matrix
+     *
+     * @param A left-hand side scaled matrix alpha*A
+     * @param B right-hand side matrix
+     *
+     * @return expression representing alpha*A*B
+     */
+    template <typename MT1, typename ST, detail::DenseOperand MT2>
+    inline auto operator*(MatScalarMultExpr<MT1, ST> const& A, MT2 const& B)
+    {
+        return MatMatMultExpr<MT1, MT2, ST> {A.operand(), B, A.scalar()};
+    }
+
+
+    /**
+     * @brief Evaluate D := alpha*A*B
+     *
+     * @param D output matrix
+     * @param expr product expression
+     *
+     * @return @a D
+     *
+     * @throw std::invalid_argument if @a D is an operand of the product
+     */
+    template <Matrix MT, typename MT1, typename MT2, typename ST>
+    inline MT& assign(MT& D, MatMatMultExpr<MT1, MT2, ST> const& expr)
+    {
+        if (detail::refersTo(expr.leftOperand(), D) || detail::refersTo(expr.rightOperand(), D))
+            BLAST_THROW_EXCEPTION(std::invalid_argument {"Output matrix aliases an operand of the product"});
+
+        gemm(expr.scalar(), expr.leftOperand(), expr.rightOperand(), zero, D, D);
+        return D;
+    }
+
+
+    /**
+     * @brief Evaluate the lower triangle of D := alpha*A*A^T
+     *
+     * Evaluated with a single @a syrkLower() call. The strictly upper triangle of D is not referenced.
+     * A and D must be column-major. D must not be the same matrix as A.
+     *
+     * @param D output matrix
+     * @param expr product expression, which must be of the form alpha*A*trans(A)
+     *
+     * @return @a D
+     */
+    template <Matrix MT, typename MT1, typename ST>
+    inline MT& assignLower(MT& D, MatMatMultExpr<MT1, MatTransExpr<MT1>, ST> const& expr)
+    {
+        if (std::addressof(expr.rightOperand().operand()) != std::addressof(expr.leftOperand()))
+            BLAST_THROW_EXCEPTION(std::invalid_argument {"Expression is not of the form A*trans(A)"});
+
+        if (detail::refersTo(expr.leftOperand(), D))
+            BLAST_THROW_EXCEPTION(std::invalid_argument {"Output matrix aliases an operand of the product"});
+
+        syrkLower(expr.scalar(), expr.leftOperand(), zero, D, D);
+        return D;
+    }
+}
@@ -0,0 +1,106 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <blast/math/expressions/Operand.hpp>
+#include <blast/math/TypeTraits.hpp>
+#include <blast/math/Matrix.hpp>
+#include <blast/util/Types.hpp>
+
+#include <type_traits>
+
+
+namespace blast
+{
+    /**
+     * @brief Expression object for the product of a scalar and a dense matrix
+     *
+     * The expression is not evaluated on its own; it is an operand
+     * of @a MatMatMultExpr and @a MatMatMultAddExpr.
+     *
+     * @tparam MT matrix type
+     * @tparam ST scalar type
+     */
+    template <typename MT, typename ST>
+    class MatScalarMultExpr
+    {
+    public:
+        using ElementType = std::remove_cv_t<ElementType_t<MT>>;
+
+
+        MatScalarMultExpr(MT const& matrix, ST scalar) noexcept
+        :   m_ {matrix}
+        ,   scalar_ {scalar}
+        {
+        }
+
+
+        /**
+         * @brief 2D-access to the matrix elements.
+         *
+         * @param i row index
+         * @param j column index
+         *
+         * @return The resulting value.
+         */
+        ElementType operator()(size_t i, size_t j) const noexcept
+        {
+            return ElementType(scalar_) * m_(i, j);
+        }
+
+
+        friend size_t rows(MatScalarMultExpr const& e) noexcept
+        {
+            return rows(e.m_);
+        }
+
+
+        friend size_t columns(MatScalarMultExpr const& e) noexcept
+        {
+            return columns(e.m_);
+        }
+
+
+        /**
+         * @brief Returns the matrix operand.
+         */
+        MT const& operand() const noexcept
+        {
+            return m_;
+        }
+
+
+        /**
+         * @brief Returns the scalar operand.
+         */
+        ST scalar() const noexcept
+        {
+            return scalar_;
+        }
+
+    private:
+        detail::OperandStorage_t<MT> m_;
+        ST scalar_;
+    };
+
+
+    template <typename MT, typename ST>
+    struct IsExpression<MatScalarMultExpr<MT, ST>> : std::integral_constant<bool, true> {};
+
+
+    /**
+     * @brief Product of a scalar and a dense matrix
+     *
+     * @param alpha scalar
+     * @param A matrix
+     *
+     * @return expression representing alpha*A
+     */
+    template <detail::ScalarOperand ST, detail::DenseOperand MT>
+    inline auto operator*(ST alpha, MT const& A) noexcept
+    {
+        return MatScalarMultExpr<MT, ST> {A, alpha};
+    }
+}
@@ -0,0 +1,121 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <blast/math/expressions/Operand.hpp>
+#include <blast/math/dense/Trsm.hpp>
+#include <blast/math/UpLo.hpp>
+#include <blast/math/TypeTraits.hpp>
+#include <blast/util/Exception.hpp>
+#include <blast/util/Types.hpp>
+
+#include <stdexcept>
+#include <type_traits>
+
+
+namespace blast
+{
+    /**
+     * @brief Expression object for the solution X of A*X = B, with A triangular
+     *
+     * Assigning the expression to a dense matrix X evaluates it with a single @a trsm() call,
+     * without temporaries. X can be the same matrix as B.
+     *
+     * @tparam UPLO whether A is lower- or upper-triangular
+     * @tparam UNIT whether A has unit diagonal
+     * @tparam MT1 type of the matrix A
+     * @tparam MT2 type of the matrix B
+     */
+    template <UpLo UPLO, bool UNIT, typename MT1, typename MT2>
+    class MatSolveExpr
+    {
+    public:
+        using ElementType = std::remove_cv_t<ElementType_t<MT2>>;
+
+
+        MatSolveExpr(MT1 const& A, MT2 const& B)
+        :   lhs_ {A}
+        ,   rhs_ {B}
+        {
+            if (rows(A) != columns(A) || rows(A) != rows(B))
+                BLAST_THROW_EXCEPTION(std::invalid_argument {"Matrix sizes do not match"});
+        }
+
+
+        friend size_t rows(MatSolveExpr const& e) noexcept
+        {
+            return rows(e.rhs_);
+        }
+
+
+        friend size_t columns(MatSolveExpr const& e) noexcept
+        {
+            return columns(e.rhs_);
+        }
+
+
+        /**
+         * @brief Returns the triangular matrix A.
+         */
+        MT1 const& leftOperand() const noexcept
+        {
+            return lhs_;
+        }
+
+
+        /**
+         * @brief Returns the right-hand side B.
+         */
+        MT2 const& rightOperand() const noexcept
+        {
+            return rhs_;
+        }
+
+    private:
+        detail::OperandStorage_t<MT1> lhs_;
+        detail::OperandStorage_t<MT2> rhs_;
+    };
+
+
+    template <UpLo UPLO, bool UNIT, typename MT1, typename MT2>
+    struct IsExpression<MatSolveExpr<UPLO, UNIT, MT1, MT2>> : std::integral_constant<bool, true> {};
+
+
+    /**
+     * @brief Solution of a triangular system A*X = B
+     *
+     * Only the UPLO triangle of A is referenced. The triangle refers to A as passed,
+     * e.g. for a lower-triangular L the system L^T*X = B is solved by solve<UpLo::Upper>(trans(L), B).
+     *
+     * @tparam UPLO whether A is lower- or upper-triangular
+     * @tparam UNIT whether A has unit diagonal
+     *
+     * @param A triangular matrix
+     * @param B right-hand side
+     *
+     * @return expression representing A^{-1}*B
+     */
+    template <UpLo UPLO, bool UNIT = false, detail::DenseOperand MT1, detail::DenseOperand MT2>
+    inline auto solve(MT1 const& A, MT2 const& B)
+    {
+        return MatSolveExpr<UPLO, UNIT, MT1, MT2> {A, B};
+    }
+
+
+    /**
+     * @brief Evaluate X := A^{-1}*B
+     *
+     * @param X output matrix
+     * @param expr solution expression
+     *
+     * @return @a X
+     */
+    template <Matrix MT, UpLo UPLO, bool UNIT, typename MT1, typename MT2>
+    inline MT& assign(MT& X, MatSolveExpr<UPLO, UNIT, MT1, MT2> const& expr)
+    {
+        trsm<UPLO, UNIT>(expr.leftOperand(), expr.rightOperand(), X);
+        return X;
+    }
+}
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <blast/math/TypeTraits.hpp>
+#include <blast/math/Matrix.hpp>
 #include <blast/util/Types.hpp>
 
 #include <type_traits>
@@ -159,6 +160,15 @@ namespace blast
     }
 
 
+    /**
+     * @brief Specialization for @a MatTransExpr
+     *
+     * @tparam MT expression operand type
+     */
+    template <typename MT>
+    struct IsExpression<MatTransExpr<MT>> : std::integral_constant<bool, true> {};
+
+
     /**
      * @brief Specialization for @a MatTransExpr
      *
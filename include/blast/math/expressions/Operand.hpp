@@ -0,0 +1,68 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <blast/math/TypeTraits.hpp>
+#include <blast/math/ScalarTag.hpp>
+
+#include <blaze/math/typetraits/IsMatrix.h>
+
+#include <memory>
+#include <type_traits>
+
+
+namespace blast :: detail
+{
+    /**
+     * @brief Dense matrix operand of a BLAST matrix expression
+     *
+     * Blaze matrices are excluded, because Blaze provides its own expression templates for them.
+     *
+     * @tparam MT matrix type
+     */
+    template <typename MT>
+    concept DenseOperand = Matrix<MT> && IsDenseMatrix_v<MT> && !blaze::IsMatrix_v<MT>;
+
+
+    /**
+     * @brief Scalar operand of a BLAST matrix expression
+     *
+     * @tparam ST scalar type
+     */
+    template <typename ST>
+    concept ScalarOperand = std::is_arithmetic_v<ST> || std::is_same_v<ST, One> || std::is_same_v<ST, Zero>;
+
+
+    /**
+     * @brief Type used to store an operand inside of an expression object.
+     *
+     * Expressions are stored by value, matrices by reference.
+     *
+     * @tparam MT operand type
+     */
+    template <typename MT>
+    using OperandStorage_t = std::conditional_t<IsExpression_v<MT>, MT const, MT const&>;
+
+
+    /**
+     * @brief Checks whether an operand of an expression refers to a given matrix object.
+     *
+     * Expressions such as trans(A) refer to the matrix they wrap.
+     * Only object addresses are compared; distinct views of the same memory are not detected.
+     *
+     * @param operand expression operand
+     * @param m matrix
+     *
+     * @return true if @a operand is @a m or an expression of @a m
+     */
+    template <typename OT, typename MT>
+    inline bool refersTo(OT const& operand, MT const& m) noexcept
+    {
+        if constexpr (requires { operand.operand(); })
+            return refersTo(operand.operand(), m);
+        else
+            return static_cast<void const *>(std::addressof(operand)) == static_cast<void const *>(std::addressof(m));
+    }
+}
@@ -0,0 +1,242 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <blast/math/PanelMatrix.hpp>
+#include <blast/math/panel/DynamicPanelMatrix.hpp>
+#include <blast/math/simd/SimdSize.hpp>
+#include <blast/math/simd/IsSimdAligned.hpp>
+#include <blast/math/TypeTraits.hpp>
+#include <blast/util/Exception.hpp>
+
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Types.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+
+#include <stdexcept>
+#include <type_traits>
+
+
+namespace blast
+{
+    using namespace blaze;
+
+
+    /// @brief Panel matrix using memory provided by the caller.
+    ///
+    /// The matrix does not own its elements; copy construction creates another view of the same elements.
+    /// Assignment always copies the elements, like for any other matrix type.
+    /// The caller is responsible for keeping the memory alive while the matrix is in use.
+    ///
+    /// The memory must have the layout of a @a DynamicPanelMatrix: it must be aligned on the SIMD register boundary
+    /// and hold ceil(m / SS) panels (ceil(n / SS) for row-major matrices) which are @a spacing elements apart,
+    /// where SS is the SIMD size. The padding elements of the last panel must be initialized by the caller,
+    /// preferably to 0 to prevent denorms in calculations.
+    ///
+    /// @tparam Type element type of the matrix
+    /// @tparam SO storage order of panel elements
+    template <typename Type, bool SO = columnMajor>
+    class CustomPanelMatrix
+    :   public PanelMatrix<CustomPanelMatrix<Type, SO>, SO>
+    {
+    public:
+        using This          = CustomPanelMatrix<Type, SO>;  //!< Type of this CustomPanelMatrix instance.
+        using BaseType      = PanelMatrix<This, SO>;        //!< Base type of this CustomPanelMatrix instance.
+        using ResultType    = DynamicPanelMatrix<Type, SO>;   //!< Result type for expression template evaluations.
+        using OppositeType  = DynamicPanelMatrix<Type, !SO>;  //!< Result type with opposite storage order for expression template evaluations.
+        using TransposeType = DynamicPanelMatrix<Type, !SO>;  //!< Transpose type for expression template evaluations.
+        using ElementType   = Type;                         //!< Type of the matrix elements.
+        using ReturnType    = const Type&;                  //!< Return type for expression template evaluations.
+        using CompositeType = const This&;                  //!< Data type for composite expression templates.
+
+        using Reference      = Type&;        //!< Reference to a non-constant matrix value.
+        using ConstReference = const Type&;  //!< Reference to a constant matrix value.
+        using Pointer        = Type*;        //!< Pointer to a non-constant matrix value.
+        using ConstPointer   = const Type*;  //!< Pointer to a constant matrix value.
+
+        static_assert(!std::is_const_v<Type>, "CustomPanelMatrix element type must not be const");
+
+
+        /// @brief Create a matrix on a user-provided buffer with minimal spacing.
+        ///
+        /// @param data pointer to the beginning of the first panel
+        /// @param m number of rows
+        /// @param n number of columns
+        ///
+        CustomPanelMatrix(Type * data, size_t m, size_t n)
+        :   CustomPanelMatrix {data, m, n, SS * (SO == columnMajor ? n : m)}
+        {
+        }
+
+
+        /// @brief Create a matrix on a user-provided buffer.
+        ///
+        /// @param data pointer to the beginning of the first panel
+        /// @param m number of rows
+        /// @param n number of columns
+        /// @param spacing distance between the beginnings of two consecutive panels, in elements
+        ///
+        /// @throw std::invalid_argument if @a spacing is too small or @a data and @a spacing
+        /// do not satisfy the alignment requirements
+        ///
+        CustomPanelMatrix(Type * data, size_t m, size_t n, size_t spacing)
+        :   m_ {m}
+        ,   n_ {n}
+        ,   spacing_ {spacing}
+        ,   v_ {data}
+        {
+            if (spacing_ < SS * (SO == columnMajor ? n_ : m_))
+                BLAST_THROW_EXCEPTION(std::invalid_argument {"Spacing is less than the panel size"});
+
+            if (spacing_ % SS != 0)
+                BLAST_THROW_EXCEPTION(std::invalid_argument {"Spacing is not a multiple of SIMD size"});
+
+            if (!isSimdAligned(v_))
+                BLAST_THROW_EXCEPTION(std::invalid_argument {"Data pointer is not aligned"});
+        }
+
+
+        CustomPanelMatrix(CustomPanelMatrix const&) = default;
+
+
+        /// @brief Copy the elements of a matrix of the same size.
+        ///
+        /// @throw std::invalid_argument if the sizes of the matrices do not match
+        ///
+        CustomPanelMatrix& operator=(CustomPanelMatrix const& rhs)
+        {
+            if (rhs.m_ != m_ || rhs.n_ != n_)
+                BLAST_THROW_EXCEPTION(std::invalid_argument {"Matrix sizes do not match"});
+
+            for (size_t i = 0; i < m_; ++i)
+                for (size_t j = 0; j < n_; ++j)
+                    (*this)(i, j) = rhs(i, j);
+
+            return *this;
+        }
+
+
+        CustomPanelMatrix& operator=(Type val) noexcept
+        {
+            for (size_t i = 0; i < m_; ++i)
+                for (size_t j = 0; j < n_; ++j)
+                    (*this)(i, j) = val;
+
+            return *this;
+        }
+
+
+        template< typename MT    // Type of the right-hand side matrix
+            , bool SO2 >      // Storage order of the right-hand side matrix
+        CustomPanelMatrix& operator=(blaze::Matrix<MT, SO2> const& rhs)
+        {
+            assign(*this, *rhs);
+            return *this;
+        }
+
+
+        ConstReference operator()(size_t i, size_t j) const noexcept
+        {
+            return v_[elementIndex(i, j)];
+        }
+
+
+        Reference operator()(size_t i, size_t j) noexcept
+        {
+            return v_[elementIndex(i, j)];
+        }
+
+
+        size_t rows() const noexcept
+        {
+            return m_;
+        }
+
+
+        size_t columns() const noexcept
+        {
+            return n_;
+        }
+
+
+        size_t spacing() const noexcept
+        {
+            return spacing_;
+        }
+
+
+        Type * data() noexcept
+        {
+            return v_;
+        }
+
+
+        Type const * data() const noexcept
+        {
+            return v_;
+        }
+
+
+        /**
+         * @brief Set all matrix elements to 0
+         */
+        void reset() noexcept
+        {
+            *this = Type {};
+        }
+
+
+    private:
+        static size_t constexpr SS = SimdSize_v<Type>;
+
+        size_t m_;
+        size_t n_;
+        size_t spacing_;
+
+        Type * v_;
+
+
+        size_t elementIndex(size_t i, size_t j) const noexcept
+        {
+            return SO == columnMajor
+                ? i / SS * spacing_ + i % SS + j * SS
+                : j / SS * spacing_ + j % SS + i * SS;
+        }
+    };
+
+
+    /**
+     * @brief Specialization for @a CustomPanelMatrix
+     */
+    template <typename T, bool SO>
+    struct StorageOrderHelper<CustomPanelMatrix<T, SO>> : std::integral_constant<StorageOrder, StorageOrder(SO)> {};
+}
+
+
+namespace blaze
+{
+    template <typename T, bool SO>
+    struct HasMutableDataAccess<blast::CustomPanelMatrix<T, SO>>
+    :   public TrueType
+    {};
+
+
+    template <typename T, bool SO>
+    struct IsStatic<blast::CustomPanelMatrix<T, SO>>
+    :   public FalseType
+    {};
+
+
+    template <typename T, bool SO>
+    struct IsAligned<blast::CustomPanelMatrix<T, SO>>
+    :   public TrueType
+    {};
+
+
+    template <typename T, bool SO>
+    struct IsPadded<blast::CustomPanelMatrix<T, SO>>
+    :   public TrueType
+    {};
+}
@@ -5,6 +5,8 @@
 #pragma once
 
 #include <blast/math/PanelMatrix.hpp>
+#include <blast/math/SpacingPolicy.hpp>
+#include <blast/math/Uninitialized.hpp>
 #include <blast/math/views/submatrix/BaseTemplate.hpp>
 #include <blast/math/simd/SimdSize.hpp>
 #include <blast/math/TypeTraits.hpp>
@@ -18,8 +20,10 @@
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/system/Restrict.h>
 
-#include <new>
+#include <algorithm>
+#include <memory_resource>
 #include <type_traits>
+#include <utility>
 
 
 namespace blast
@@ -54,34 +58,123 @@ namespace blast
 
 
 
-        explicit DynamicPanelMatrix(size_t m, size_t n)
+        /// @brief Create a matrix of given size with all elements initialized to 0.
+        ///
+        /// @param m number of rows
+        /// @param n number of columns
+        /// @param mr memory resource used to allocate the matrix elements
+        ///
+        explicit DynamicPanelMatrix(size_t m, size_t n, std::pmr::memory_resource * mr = std::pmr::get_default_resource())
+        :   DynamicPanelMatrix {m, n, DEFAULT_SPACING_POLICY, mr}
+        {
+        }
+
+
+        /// @brief Create a matrix of given size and spacing policy with all elements initialized to 0.
+        ///
+        /// @param m number of rows
+        /// @param n number of columns
+        /// @param policy spacing policy
+        /// @param mr memory resource used to allocate the matrix elements
+        ///
+        DynamicPanelMatrix(size_t m, size_t n, SpacingPolicy policy, std::pmr::memory_resource * mr = std::pmr::get_default_resource())
+        :   DynamicPanelMatrix {uninitialized, m, n, policy, mr}
+        {
+            std::fill_n(v_, capacity_, Type {});
+        }
+
+
+        /// @brief Create a matrix of given size without initializing its elements.
+        ///
+        /// Only the padding elements of the last panel are set to 0, see @a Uninitialized.
+        ///
+        /// @param m number of rows
+        /// @param n number of columns
+        /// @param mr memory resource used to allocate the matrix elements
+        ///
+        DynamicPanelMatrix(Uninitialized, size_t m, size_t n, std::pmr::memory_resource * mr = std::pmr::get_default_resource())
+        :   DynamicPanelMatrix {uninitialized, m, n, DEFAULT_SPACING_POLICY, mr}
+        {
+        }
+
+
+        /// @brief Create a matrix of given size and spacing policy without initializing its elements.
+        ///
+        /// Only the padding elements of the last panel are set to 0, see @a Uninitialized.
+        ///
+        /// @param m number of rows
+        /// @param n number of columns
+        /// @param policy spacing policy
+        /// @param mr memory resource used to allocate the matrix elements
+        ///
+        DynamicPanelMatrix(Uninitialized, size_t m, size_t n, SpacingPolicy policy, std::pmr::memory_resource * mr = std::pmr::get_default_resource())
         :   m_ {m}
         ,   n_ {n}
-        ,   spacing_ {SS * (SO == columnMajor ? n : m)}
-        ,   capacity_ {spacing_ * nextMultiple(SO == columnMajor ? m : n, SS)}
-        // Initialize padding elements to 0 to prevent denorms in calculations.
-        // Initialize padding elements to 0 to prevent denorms in calculations.
-        // Denorms can significantly impair performance, see https://github.com/giaf/blasfeo/issues/103
-        ,   v_ {new(std::align_val_t {alignment_}) Type[capacity_] {}}
+        ,   spacing_ {adjustSpacing<Type>(SS * (SO == columnMajor ? n : m), policy)}
+        ,   capacity_ {spacing_ * (nextMultiple(SO == columnMajor ? m : n, SS) / SS)}
+        ,   mr_ {mr}
+        ,   v_ {allocate(capacity_, mr)}
         {
+            // Initialize padding elements to 0 to prevent denorms in calculations.
+            // Denorms can significantly impair performance, see https://github.com/giaf/blasfeo/issues/103
+            size_t const inner = SO == columnMajor ? m_ : n_;
+            size_t const outer = SO == columnMajor ? n_ : m_;
+
+            if (size_t const used = inner % SS; used > 0)
+            {
+                Type * const last_panel = v_ + inner / SS * spacing_;
+
+                for (size_t k = 0; k < outer; ++k)
+                    std::fill_n(last_panel + k * SS + used, SS - used, Type {});
+            }
         }
 
 
+        /// @brief Copy constructor.
+        ///
+        /// Following @a std::pmr conventions, the copy uses the default memory resource.
+        ///
         DynamicPanelMatrix(DynamicPanelMatrix const& rhs)
+        :   DynamicPanelMatrix {rhs, std::pmr::get_default_resource()}
+        {
+        }
+
+
+        /// @brief Copy a matrix using a specified memory resource.
+        ///
+        /// @param rhs matrix to copy
+        /// @param mr memory resource used to allocate the matrix elements
+        ///
+        DynamicPanelMatrix(DynamicPanelMatrix const& rhs, std::pmr::memory_resource * mr)
+        :   m_ {rhs.m_}
+        ,   n_ {rhs.n_}
+        ,   spacing_ {rhs.spacing_}
+        ,   capacity_ {rhs.capacity_}
+        ,   mr_ {mr}
+        ,   v_ {allocate(capacity_, mr)}
         {
-            BLAZE_THROW_LOGIC_ERROR("Not implemented");
+            std::copy_n(rhs.v_, capacity_, v_);
         }
 
 
+        /// @brief Move constructor.
+        ///
+        /// Takes over the memory and the memory resource of @a rhs, leaving @a rhs empty.
+        ///
         DynamicPanelMatrix(DynamicPanelMatrix&& rhs) noexcept
+        :   m_ {std::exchange(rhs.m_, 0)}
+        ,   n_ {std::exchange(rhs.n_, 0)}
+        ,   spacing_ {std::exchange(rhs.spacing_, 0)}
+        ,   capacity_ {std::exchange(rhs.capacity_, 0)}
+        ,   mr_ {rhs.mr_}
+        ,   v_ {std::exchange(rhs.v_, nullptr)}
         {
-            BLAZE_THROW_LOGIC_ERROR("Not implemented");
         }
 
 
         ~DynamicPanelMatrix()
         {
-            delete[] v_;
+            deallocate();
         }
 
 
@@ -95,16 +188,49 @@ namespace blast
         }
 
 
-        DynamicPanelMatrix& operator=(DynamicPanelMatrix const& val)
+        /// @brief Copy assignment.
+        ///
+        /// The memory is reallocated from the memory resource of this matrix if the sizes do not match.
+        ///
+        DynamicPanelMatrix& operator=(DynamicPanelMatrix const& rhs)
         {
-            BLAZE_THROW_LOGIC_ERROR("Not implemented");
+            if (this != &rhs)
+            {
+                if (capacity_ != rhs.capacity_)
+                {
+                    Type * const v = allocate(rhs.capacity_, mr_);
+                    deallocate();
+                    v_ = v;
+                }
+
+                m_ = rhs.m_;
+                n_ = rhs.n_;
+                spacing_ = rhs.spacing_;
+                capacity_ = rhs.capacity_;
+                std::copy_n(rhs.v_, capacity_, v_);
+            }
+
             return *this;
         }
 
 
-        DynamicPanelMatrix& operator=(DynamicPanelMatrix&& val) noexcept
+        /// @brief Move assignment.
+        ///
+        /// Takes over the memory and the memory resource of @a rhs, leaving @a rhs empty.
+        ///
+        DynamicPanelMatrix& operator=(DynamicPanelMatrix&& rhs) noexcept
         {
-            BLAZE_THROW_LOGIC_ERROR("Not implemented");
+            if (this != &rhs)
+            {
+                deallocate();
+                m_ = std::exchange(rhs.m_, 0);
+                n_ = std::exchange(rhs.n_, 0);
+                spacing_ = std::exchange(rhs.spacing_, 0);
+                capacity_ = std::exchange(rhs.capacity_, 0);
+                mr_ = rhs.mr_;
+                v_ = std::exchange(rhs.v_, nullptr);
+            }
+
             return *this;
         }
 
@@ -160,12 +286,21 @@ namespace blast
         }
 
 
+        /**
+         * @brief Memory resource used to allocate the matrix elements
+         */
+        std::pmr::memory_resource * resource() const noexcept
+        {
+            return mr_;
+        }
+
+
         /**
          * @brief Set all matrix elements to 0
          */
         void reset() noexcept
         {
-            std::fill_n(v_, spacing_ * (SO == columnMajor ? n_ : m_), Type {});
+            std::fill_n(v_, capacity_, Type {});
         }
 
 
@@ -177,10 +312,26 @@ namespace blast
         size_t n_;
         size_t spacing_;
         size_t capacity_;
+        std::pmr::memory_resource * mr_;
 
         Type * BLAZE_RESTRICT v_;
 
 
+        static Type * allocate(size_t capacity, std::pmr::memory_resource * mr)
+        {
+            return static_cast<Type *>(mr->allocate(capacity * sizeof(Type), alignment_));
+        }
+
+
+        void deallocate() noexcept
+        {
+            if (v_)
+                mr_->deallocate(v_, capacity_ * sizeof(Type), alignment_);
+
+            v_ = nullptr;
+        }
+
+
         size_t elementIndex(size_t i, size_t j) const noexcept
         {
             return SO == columnMajor
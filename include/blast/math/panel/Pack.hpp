@@ -0,0 +1,170 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <blast/math/typetraits/MatrixPointer.hpp>
+#include <blast/math/typetraits/StorageOrder.hpp>
+#include <blast/math/simd/SimdSize.hpp>
+#include <blast/math/simd/SimdIndex.hpp>
+#include <blast/math/simd/SimdMask.hpp>
+#include <blast/math/simd/SimdVec.hpp>
+#include <blast/system/CacheLine.hpp>
+#include <blast/util/NextMultiple.hpp>
+#include <blast/util/Types.hpp>
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+
+
+namespace blast
+{
+    /**
+     * @brief Copy a matrix into a buffer with the memory layout of a column-major @a DynamicPanelMatrix.
+     *
+     * The destination consists of ceil(M / SS) panels of SS rows each, where SS is the SIMD size of @a T.
+     * The panel spacing is SS * N. Padding rows of the last panel are set to 0
+     * to prevent denormals from appearing in the padding.
+     *
+     * A column-major source is copied with SIMD loads, the last panel with masked loads.
+     *
+     * @tparam MP source matrix pointer type
+     * @tparam T destination element type
+     *
+     * @param M number of rows of the source matrix
+     * @param N number of columns of the source matrix
+     * @param src pointer to the source matrix
+     * @param dst destination buffer of at least nextMultiple(M, SS) * N elements,
+     * aligned on the SIMD register boundary
+     */
+    template <MatrixPointer MP, typename T>
+    inline void packPanel(size_t M, size_t N, MP src, T * dst)
+    {
+        size_t constexpr SS = SimdSize_v<T>;
+
+        if constexpr (StorageOrder_v<MP> == columnMajor)
+        {
+            // Each column of a panel is one SIMD register loaded from a column of the source.
+            for (size_t i = 0; i + SS <= M; i += SS)
+            {
+                T * const panel = dst + i * N;
+
+                for (size_t j = 0; j < N; ++j)
+                    src(i, j).load().store(panel + j * SS, true);
+            }
+
+            if (size_t const rem = M % SS)
+            {
+                // Masked loads do not read past the end of the source columns
+                // and set the padding rows to 0.
+                SimdMask<T> const mask = indexSequence<T>() < rem;
+                T * const panel = dst + (M - rem) * N;
+
+                for (size_t j = 0; j < N; ++j)
+                    src(M - rem, j).load(mask).store(panel + j * SS, true);
+            }
+        }
+        else
+        {
+            // The rows of the source are read contiguously.
+            for (size_t i = 0; i < M; i += SS)
+            {
+                size_t const mi = std::min(SS, M - i);
+                T * const panel = dst + i * N;
+
+                for (size_t ii = 0; ii < mi; ++ii)
+                    for (size_t j = 0; j < N; ++j)
+                        panel[j * SS + ii] = src[i + ii, j];
+
+                for (size_t ii = mi; ii < SS; ++ii)
+                    for (size_t j = 0; j < N; ++j)
+                        panel[j * SS + ii] = T {};
+            }
+        }
+    }
+
+
+    namespace detail
+    {
+        /**
+         * @brief Growable cache-aligned buffer used to hold packed matrix operands.
+         *
+         * @tparam T element type
+         */
+        template <typename T>
+        class PackBuffer
+        {
+            static_assert(std::is_trivial_v<T>, "PackBuffer element type must be trivial");
+
+        public:
+            PackBuffer() = default;
+            PackBuffer(PackBuffer const&) = delete;
+            PackBuffer& operator=(PackBuffer const&) = delete;
+
+
+            ~PackBuffer()
+            {
+                deallocate();
+            }
+
+
+            /**
+             * @brief Get a pointer to the buffer of at least @a capacity elements.
+             *
+             * The previous contents of the buffer are not preserved if it needs to grow.
+             *
+             * @param capacity minimum required number of elements
+             *
+             * @return pointer to the first element of the buffer
+             */
+            T * data(size_t capacity)
+            {
+                if (capacity > capacity_)
+                {
+                    deallocate();
+                    v_ = static_cast<T *>(::operator new(capacity * sizeof(T), std::align_val_t {alignment_}));
+                    capacity_ = capacity;
+                }
+
+                return v_;
+            }
+
+
+        private:
+            static size_t constexpr alignment_ = CACHE_LINE_SIZE;
+
+            T * v_ = nullptr;
+            size_t capacity_ = 0;
+
+
+            void deallocate() noexcept
+            {
+                if (v_)
+                    ::operator delete(v_, std::align_val_t {alignment_});
+
+                v_ = nullptr;
+                capacity_ = 0;
+            }
+        };
+
+
+        /**
+         * @brief Thread-local buffer for packed matrix operands.
+         *
+         * @tparam T element type
+         * @tparam I buffer index, allowing several independent buffers per thread
+         *
+         * @param capacity minimum required number of elements
+         *
+         * @return pointer to the first element of the buffer
+         */
+        template <typename T, size_t I>
+        inline T * packBuffer(size_t capacity)
+        {
+            thread_local PackBuffer<T> buffer;
+            return buffer.data(capacity);
+        }
+    }
+}
@@ -8,6 +8,7 @@
 #include <blast/math/views/submatrix/Panel.hpp>
 #include <blast/math/algorithm/Gemm.hpp>
 #include <blast/math/Simd.hpp>
+#include <blast/util/Profile.hpp>
 
 #include <blaze/util/Exception.h>
 #include <blaze/util/constraints/SameType.h>
@@ -60,6 +61,8 @@ namespace blast
     inline void potrf(
         PanelMatrix<MT1, columnMajor> const& A, PanelMatrix<MT2, columnMajor>& L)
     {
+        BLAST_PROFILE_SCOPE(potrf, rows(A), columns(A));
+
         using ET = ElementType_t<MT1>;
         size_t constexpr SS = SimdSize_v<ET>;
 
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <blast/math/Forward.hpp>
+#include <blast/math/Uninitialized.hpp>
 #include <blast/math/views/submatrix/BaseTemplate.hpp>
 #include <blast/math/expressions/PanelMatrix.hpp>
 #include <blast/math/panel/PanelSize.hpp>
@@ -65,6 +66,27 @@ namespace blast
         }
 
 
+        /// @brief Create a matrix without initializing its elements.
+        ///
+        /// Only the padding elements of the last panel are set to 0, see @a Uninitialized.
+        explicit StaticPanelMatrix(Uninitialized)
+        {
+            // Initialize padding elements to 0 to prevent denorms in calculations.
+            // Denorms can significantly impair performance, see https://github.com/giaf/blasfeo/issues/103
+            size_t constexpr inner = SO == columnMajor ? M : N;
+            size_t constexpr outer = SO == columnMajor ? N : M;
+            size_t constexpr used = inner % panelSize_;
+
+            if constexpr (used > 0)
+            {
+                Type * const last_panel = v_ + inner / panelSize_ * spacing_;
+
+                for (size_t k = 0; k < outer; ++k)
+                    std::fill_n(last_panel + k * panelSize_ + used, panelSize_ - used, Type {});
+            }
+        }
+
+
         constexpr StaticPanelMatrix(std::initializer_list<std::initializer_list<Type>> list)
         {
             std::fill_n(v_, capacity_, Type {});
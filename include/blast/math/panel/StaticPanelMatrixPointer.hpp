@@ -102,6 +102,15 @@ namespace blast
         }
 
 
+        /**
+         * @brief Hint the processor to bring the pointed element into the L1 cache.
+         */
+        void prefetch() const noexcept
+        {
+            blast::prefetch(ptr_);
+        }
+
+
         /**
          * @brief Offset pointer by specified number of rows and columns
          *
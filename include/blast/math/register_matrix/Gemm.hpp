@@ -15,23 +15,209 @@
 #pragma once
 
 #include <blast/math/register_matrix/RegisterMatrix.hpp>
+#include <blast/math/dense/StaticMatrixPointer.hpp>
+#include <blast/math/ScalarTag.hpp>
 #include <blast/math/TypeTraits.hpp>
+#include <blast/system/CacheLine.hpp>
+#include <blast/system/Inline.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
 
 
 namespace blast
 {
+    namespace detail
+    {
+        /// @brief Rank-1 update of a register matrix with column k of A and row k of B.
+        ///
+        /// Aligned loads are used for A and B when their storage allows it.
+        ///
+        template <typename T, size_t M, size_t N, StorageOrder SO, typename PA, typename PB>
+        BLAST_ALWAYS_INLINE void gemmGer(RegisterMatrix<T, M, N, SO>& ker, PA a, PB b, size_t k) noexcept
+        {
+            bool constexpr a_columns_aligned = IsAligned_v<PA> && IsPadded_v<PA> && PA::storageOrder == columnMajor;
+            bool constexpr b_rows_aligned = IsAligned_v<PB> && IsPadded_v<PB> && StorageOrder_v<PB> == rowMajor;
+
+            if constexpr (a_columns_aligned && b_rows_aligned)
+                ker.ger(column(a(0, k)), row(b(k, 0)));
+            else if constexpr (a_columns_aligned && !b_rows_aligned)
+                ker.ger(column(a(0, k)), row((~b)(k, 0)));
+            else if constexpr (!a_columns_aligned && b_rows_aligned)
+                ker.ger(column((~a)(0, k)), row(b(k, 0)));
+            else
+                ker.ger(column((~a)(0, k)), row((~b)(k, 0)));
+        }
+
+
+        /// @brief Scale the accumulated product and add the C term: R := alpha * R + beta * C.
+        ///
+        /// The multiplication is omitted if @a alpha is @a One, and C is not read if @a beta is @a Zero.
+        ///
+        template <typename T, size_t M, size_t N, StorageOrder SO, typename ST1, typename ST2, typename PC>
+        BLAST_ALWAYS_INLINE void gemmAlphaBeta(RegisterMatrix<T, M, N, SO>& ker, ST1 alpha, ST2 beta, PC c) noexcept
+        {
+            if constexpr (!std::is_same_v<ST1, One>)
+                ker *= T(alpha);
+
+            if constexpr (!std::is_same_v<ST2, Zero>)
+                ker.axpy(T(beta), c);
+        }
+
+
+        /// @brief Scale the accumulated product and add the C term for a sub-matrix:
+        /// R(0:md-1, 0:nd-1) := alpha * R(0:md-1, 0:nd-1) + beta * C.
+        ///
+        /// The multiplication is omitted if @a alpha is @a One, and C is not read if @a beta is @a Zero.
+        ///
+        template <typename T, size_t M, size_t N, StorageOrder SO, typename ST1, typename ST2, typename PC>
+        BLAST_ALWAYS_INLINE void gemmAlphaBeta(RegisterMatrix<T, M, N, SO>& ker,
+            ST1 alpha, ST2 beta, PC c, size_t md, size_t nd) noexcept
+        {
+            if constexpr (!std::is_same_v<ST1, One>)
+                ker *= T(alpha);
+
+            if constexpr (!std::is_same_v<ST2, Zero>)
+                ker.axpy(T(beta), c, md, nd);
+        }
+
+
+        /// @brief Prefetch column k of A and row k of B used by an M by N register-blocked gemm.
+        ///
+        /// If B is column-major, each element of a row of B resides in a different cache line,
+        /// and one cache line holds several consecutive rows. Therefore an element of a row of a column-major B
+        /// is prefetched only if it starts a cache line. The columns of B need not start on a cache line boundary,
+        /// so the check is done on the address of every element rather than on @a k.
+        ///
+        template <typename T, size_t M, size_t N, typename PA, typename PB>
+        BLAST_ALWAYS_INLINE void gemmPrefetch(PA a, PB b, size_t k) noexcept
+        {
+            // Number of matrix elements in a cache line
+            size_t constexpr LS = CACHE_LINE_SIZE / sizeof(T);
+
+            #pragma unroll
+            for (size_t i = 0; i < M; i += LS)
+                a(i, k).prefetch();
+
+            a(M - 1, k).prefetch();
+
+            if constexpr (StorageOrder_v<PB> == rowMajor)
+            {
+                #pragma unroll
+                for (size_t j = 0; j < N; j += LS)
+                    b(k, j).prefetch();
+
+                b(k, N - 1).prefetch();
+            }
+            else
+            {
+                #pragma unroll
+                for (size_t j = 0; j < N; ++j)
+                    if (reinterpret_cast<std::uintptr_t>(b(k, j).get()) % CACHE_LINE_SIZE == 0)
+                        b(k, j).prefetch();
+            }
+        }
+    }
+
+
+    namespace detail
+    {
+        /// @brief Accumulate rank-1 updates with columns k_begin...k_end-1 of A and rows k_begin...k_end-1 of B:
+        /// R += A(:, k_begin:k_end-1) * B(k_begin:k_end-1, :).
+        ///
+        /// If A is row-major, its columns are not contiguous in memory. In this case blocks of A
+        /// spanning one cache line of each row are transposed into a column-major buffer on the stack,
+        /// so that the rank-1 updates can use aligned vector loads.
+        ///
+        template <typename T, size_t M, size_t N, StorageOrder SO, typename PA, typename PB>
+        BLAST_ALWAYS_INLINE void gemmAccumulate(RegisterMatrix<T, M, N, SO>& ker, PA a, PB b, size_t k_begin, size_t k_end) noexcept
+        {
+            if constexpr (PA::storageOrder == columnMajor)
+            {
+                for (size_t k = k_begin; k < k_end; ++k)
+                    gemmGer(ker, a, b, k);
+            }
+            else
+            {
+                // Number of columns of A in a transposed block
+                size_t constexpr KB = CACHE_LINE_SIZE / sizeof(T);
+                alignas(CACHE_LINE_SIZE) T buf[M * KB];
+                StaticMatrixPointer<T, M, columnMajor, true, true> const a_block {buf, 0, 0};
+
+                for (size_t k0 = k_begin; k0 < k_end; k0 += KB)
+                {
+                    size_t const kb = std::min(KB, k_end - k0);
+
+                    for (size_t i = 0; i < M; ++i)
+                        for (size_t kk = 0; kk < kb; ++kk)
+                            buf[i + M * kk] = a[i, k0 + kk];
+
+                    for (size_t kk = 0; kk < kb; ++kk)
+                        ker.ger(column(a_block(0, kk)), row((~b)(k0 + kk, 0)));
+                }
+            }
+        }
+
+
+        /// @brief Accumulate rank-1 updates for a sub-matrix:
+        /// R(0:md-1, 0:nd-1) += A(0:md-1, k_begin:k_end-1) * B(k_begin:k_end-1, 0:nd-1).
+        ///
+        /// See the full-size version for the handling of row-major A.
+        ///
+        template <typename T, size_t M, size_t N, StorageOrder SO, typename PA, typename PB>
+        BLAST_ALWAYS_INLINE void gemmAccumulate(RegisterMatrix<T, M, N, SO>& ker, PA a, PB b,
+            size_t k_begin, size_t k_end, size_t md, size_t nd) noexcept
+        {
+            if constexpr (PA::storageOrder == columnMajor)
+            {
+                for (size_t k = k_begin; k < k_end; ++k)
+                    ker.ger(column(a(0, k)), row((~b)(k, 0)), md, nd);
+            }
+            else
+            {
+                // Number of columns of A in a transposed block
+                size_t constexpr KB = CACHE_LINE_SIZE / sizeof(T);
+
+                // Rows md...M-1 of the buffer are never read from A and stay 0
+                alignas(CACHE_LINE_SIZE) T buf[M * KB] {};
+                StaticMatrixPointer<T, M, columnMajor, true, true> const a_block {buf, 0, 0};
+
+                for (size_t k0 = k_begin; k0 < k_end; k0 += KB)
+                {
+                    size_t const kb = std::min(KB, k_end - k0);
+
+                    for (size_t i = 0; i < md; ++i)
+                        for (size_t kk = 0; kk < kb; ++kk)
+                            buf[i + M * kk] = a[i, k0 + kk];
+
+                    for (size_t kk = 0; kk < kb; ++kk)
+                        ker.ger(column(a_block(0, kk)), row((~b)(k0 + kk, 0)), md, nd);
+                }
+            }
+        }
+    }
+
+
     /// @brief General matrix-matrix multiplication performed in-place
     ///
     /// R += alpha * A * B,
     /// where R is M by N, A is M by K, and B is K by N.
     ///
-    template <typename T, size_t M, size_t N, StorageOrder SO, typename PA, typename PB>
+    template <typename T, size_t M, size_t N, StorageOrder SO, typename ST, typename PA, typename PB>
     requires MatrixPointer<PA, T> && (PA::storageOrder == columnMajor)
         && MatrixPointer<PB, T>
-    inline void gemm(RegisterMatrix<T, M, N, SO>& r, size_t K, T alpha, PA a, PB b) noexcept
+        && ScalarArgument<ST, T>
+    inline void gemm(RegisterMatrix<T, M, N, SO>& r, size_t K, ST alpha, PA a, PB b) noexcept
     {
         for (size_t k = 0; k < K; ++k)
-            r.ger(alpha, column(a(0, k)), row((~b)(k, 0)));
+        {
+            if constexpr (std::is_same_v<ST, One>)
+                r.ger(column(a(0, k)), row((~b)(k, 0)));
+            else
+                r.ger(T(alpha), column(a(0, k)), row((~b)(k, 0)));
+        }
     }
 
 
@@ -40,14 +226,20 @@ namespace blast
     /// R(0:md-1, 0:nd-1) += alpha * A * B,
     /// where R is M by N, A is md by K, and B is K by nd.
     ///
-    template <typename T, size_t M, size_t N, StorageOrder SO, typename PA, typename PB>
+    template <typename T, size_t M, size_t N, StorageOrder SO, typename ST, typename PA, typename PB>
     requires MatrixPointer<PA, T> && (PA::storageOrder == columnMajor)
         && MatrixPointer<PB, T>
+        && ScalarArgument<ST, T>
     inline void gemm(RegisterMatrix<T, M, N, SO>& r, size_t K,
-        T alpha, PA a, PB b, size_t md, size_t nd) noexcept
+        ST alpha, PA a, PB b, size_t md, size_t nd) noexcept
     {
         for (size_t k = 0; k < K; ++k)
-            r.ger(alpha, column(a(0, k)), row((~b)(k, 0)), md, nd);
+        {
+            if constexpr (std::is_same_v<ST, One>)
+                r.ger(column(a(0, k)), row((~b)(k, 0)), md, nd);
+            else
+                r.ger(T(alpha), column(a(0, k)), row((~b)(k, 0)), md, nd);
+        }
     }
 
 
@@ -63,31 +255,65 @@ namespace blast
     ///
     template <
         typename T, size_t M, size_t N, StorageOrder SO,
-        typename PA, typename PB, typename PC, typename PD
+        typename ST1, typename PA, typename PB, typename ST2, typename PC, typename PD
     >
-    requires MatrixPointer<PA, T> && (PA::storageOrder == columnMajor)
+    requires MatrixPointer<PA, T>
         && MatrixPointer<PB, T>
         && MatrixPointer<PC, T> && (PC::storageOrder == columnMajor)
+        && ScalarArgument<ST1, T> && ScalarArgument<ST2, T>
     inline void gemm(RegisterMatrix<T, M, N, SO>& ker,
-        size_t K, T alpha, PA a, PB b, T beta, PC c, PD d) noexcept
+        size_t K, ST1 alpha, PA a, PB b, ST2 beta, PC c, PD d) noexcept
     {
         ker.reset();
 
-        bool constexpr a_columns_aligned = IsAligned_v<PA> && IsPadded_v<PA> && StorageOrder_v<PA> == columnMajor;
-        bool constexpr b_rows_aligned = IsAligned_v<PB> && IsPadded_v<PB> && StorageOrder_v<PB> == rowMajor;
+        detail::gemmAccumulate(ker, a, b, 0, K);
 
-        for (size_t k = 0; k < K; ++k)
-            if constexpr (a_columns_aligned && b_rows_aligned)
-                ker.ger(column(a(0, k)), row(b(k, 0)));
-            else if constexpr (a_columns_aligned && !b_rows_aligned)
-                ker.ger(column(a(0, k)), row((~b)(k, 0)));
-            else if constexpr (!a_columns_aligned && b_rows_aligned)
-                ker.ger(column((~a)(0, k)), row(b(k, 0)));
-            else
-                ker.ger(column((~a)(0, k)), row((~b)(k, 0)));
+        detail::gemmAlphaBeta(ker, alpha, beta, c);
+        ker.store(d);
+    }
+
+
+    /// @brief General matrix-matrix multiplication with software prefetching
+    ///
+    /// D = alpha * A * B + beta * C,
+    /// where D and C are M by N, A is M by K, and B is K by N.
+    ///
+    /// Column k + PFD of A and row k + PFD of B are prefetched when the rank-1 update
+    /// with column k of A and row k of B is performed. This helps when the hardware prefetcher
+    /// does not keep up with the strided accesses to B, which is the case for large K
+    /// and plain (non-panel) matrices. PFD = 0 disables prefetching.
+    ///
+    /// The @a RegisterMatrix @a ker is used for intermediate calculations and has undefined value on return.
+    ///
+    /// @tparam PFD prefetch distance, in iterations of the K loop.
+    ///
+    template <
+        size_t PFD, typename T, size_t M, size_t N, StorageOrder SO,
+        typename ST1, typename PA, typename PB, typename ST2, typename PC, typename PD
+    >
+    requires MatrixPointer<PA, T>
+        && MatrixPointer<PB, T>
+        && MatrixPointer<PC, T> && (PC::storageOrder == columnMajor)
+        && ScalarArgument<ST1, T> && ScalarArgument<ST2, T>
+    inline void gemm(RegisterMatrix<T, M, N, SO>& ker,
+        size_t K, ST1 alpha, PA a, PB b, ST2 beta, PC c, PD d) noexcept
+    {
+        ker.reset();
+
+        size_t k = 0;
+
+        if constexpr (PFD > 0 && PA::storageOrder == columnMajor)
+        {
+            for (; k + PFD < K; ++k)
+            {
+                detail::gemmPrefetch<T, M, N>(a, b, k + PFD);
+                detail::gemmGer(ker, a, b, k);
+            }
+        }
+
+        detail::gemmAccumulate(ker, a, b, k, K);
 
-        ker *= alpha;
-        ker.axpy(beta, c);
+        detail::gemmAlphaBeta(ker, alpha, beta, c);
         ker.store(d);
     }
 
@@ -104,22 +330,130 @@ namespace blast
     ///
     template <
         typename T, size_t M, size_t N, StorageOrder SO,
-        typename PA, typename PB, typename PC, typename PD
+        typename ST1, typename PA, typename PB, typename ST2, typename PC, typename PD
     >
     requires
-        MatrixPointer<PA, T> && (PA::storageOrder == columnMajor) &&
+        MatrixPointer<PA, T> &&
         MatrixPointer<PB, T> &&
-        MatrixPointer<PC, T> && (PC::storageOrder == columnMajor)
+        MatrixPointer<PC, T> && (PC::storageOrder == columnMajor) &&
+        ScalarArgument<ST1, T> && ScalarArgument<ST2, T>
     inline void gemm(RegisterMatrix<T, M, N, SO>& ker,
-        size_t K, T alpha, PA a, PB b, T beta, PC c, PD d, size_t md, size_t nd) noexcept
+        size_t K, ST1 alpha, PA a, PB b, ST2 beta, PC c, PD d, size_t md, size_t nd) noexcept
     {
         ker.reset();
 
-        for (size_t k = 0; k < K; ++k)
-            ker.ger(column(a(0, k)), row((~b)(k, 0)), md, nd);
+        detail::gemmAccumulate(ker, a, b, 0, K, md, nd);
+
+        detail::gemmAlphaBeta(ker, alpha, beta, c, md, nd);
+        ker.store(d, md, nd);
+    }
+
+
+    /// @brief General matrix-matrix multiplication for a sub-matrix with software prefetching
+    ///
+    /// D = alpha * A * B + beta * C,
+    /// where D and C are md by nd, A is md by K, and B is K by nd.
+    ///
+    /// See the full-size version for the description of prefetching.
+    ///
+    /// The @a RegisterMatrix @a ker is used for intermediate calculations and has undefined value on return.
+    ///
+    /// @tparam PFD prefetch distance, in iterations of the K loop.
+    ///
+    template <
+        size_t PFD, typename T, size_t M, size_t N, StorageOrder SO,
+        typename ST1, typename PA, typename PB, typename ST2, typename PC, typename PD
+    >
+    requires
+        MatrixPointer<PA, T> &&
+        MatrixPointer<PB, T> &&
+        MatrixPointer<PC, T> && (PC::storageOrder == columnMajor) &&
+        ScalarArgument<ST1, T> && ScalarArgument<ST2, T>
+    inline void gemm(RegisterMatrix<T, M, N, SO>& ker,
+        size_t K, ST1 alpha, PA a, PB b, ST2 beta, PC c, PD d, size_t md, size_t nd) noexcept
+    {
+        ker.reset();
+
+        size_t k = 0;
+
+        if constexpr (PFD > 0 && PA::storageOrder == columnMajor)
+        {
+            for (; k + PFD < K; ++k)
+            {
+                detail::gemmPrefetch<T, M, N>(a, b, k + PFD);
+                ker.ger(column(a(0, k)), row((~b)(k, 0)), md, nd);
+            }
+        }
+
+        detail::gemmAccumulate(ker, a, b, k, K, md, nd);
+
+        detail::gemmAlphaBeta(ker, alpha, beta, c, md, nd);
+        ker.store(d, md, nd);
+    }
+
+
+    /// @brief General matrix-matrix multiplication with an epilogue
+    ///
+    /// D = f(alpha * A * B + beta * C),
+    /// where D and C are M by N, A is M by K, and B is K by N.
+    ///
+    /// The functor @a f is called as f(ker) after alpha * A * B + beta * C has been computed in @a ker
+    /// and before @a ker is stored to @a d. It can modify @a ker in place, which allows element-wise
+    /// post-processing of the result without an additional pass over D.
+    ///
+    /// The @a RegisterMatrix @a ker is used for intermediate calculations and has undefined value on return.
+    ///
+    template <
+        typename T, size_t M, size_t N, StorageOrder SO,
+        typename ST1, typename PA, typename PB, typename ST2, typename PC, typename PD, typename F
+    >
+    requires MatrixPointer<PA, T>
+        && MatrixPointer<PB, T>
+        && MatrixPointer<PC, T> && (PC::storageOrder == columnMajor)
+        && std::invocable<F&, RegisterMatrix<T, M, N, SO>&>
+        && ScalarArgument<ST1, T> && ScalarArgument<ST2, T>
+    inline void gemm(RegisterMatrix<T, M, N, SO>& ker,
+        size_t K, ST1 alpha, PA a, PB b, ST2 beta, PC c, PD d, F&& f)
+    {
+        ker.reset();
+
+        detail::gemmAccumulate(ker, a, b, 0, K);
+
+        detail::gemmAlphaBeta(ker, alpha, beta, c);
+        f(ker);
+        ker.store(d);
+    }
 
-        ker *= alpha;
-        ker.axpy(beta, c, md, nd);
+
+    /// @brief General matrix-matrix multiplication for a sub-matrix with an epilogue
+    ///
+    /// D = f(alpha * A * B + beta * C),
+    /// where D and C are md by nd, A is md by K, and B is K by nd.
+    ///
+    /// The functor @a f is called as f(ker) before @a ker is stored to @a d.
+    /// Only the top left md by nd elements of @a ker are stored.
+    ///
+    /// The @a RegisterMatrix @a ker is used for intermediate calculations and has undefined value on return.
+    ///
+    template <
+        typename T, size_t M, size_t N, StorageOrder SO,
+        typename ST1, typename PA, typename PB, typename ST2, typename PC, typename PD, typename F
+    >
+    requires
+        MatrixPointer<PA, T> &&
+        MatrixPointer<PB, T> &&
+        MatrixPointer<PC, T> && (PC::storageOrder == columnMajor) &&
+        std::invocable<F&, RegisterMatrix<T, M, N, SO>&> &&
+        ScalarArgument<ST1, T> && ScalarArgument<ST2, T>
+    inline void gemm(RegisterMatrix<T, M, N, SO>& ker,
+        size_t K, ST1 alpha, PA a, PB b, ST2 beta, PC c, PD d, size_t md, size_t nd, F&& f)
+    {
+        ker.reset();
+
+        detail::gemmAccumulate(ker, a, b, 0, K, md, nd);
+
+        detail::gemmAlphaBeta(ker, alpha, beta, c, md, nd);
+        f(ker);
         ker.store(d, md, nd);
     }
 
@@ -173,7 +507,7 @@ namespace blast
     inline void gemm(RegisterMatrix<T, M, N, SO>& ker,
         size_t K, PA a, PB b, PC c, PD d, size_t md, size_t nd) noexcept
     {
-        ker.load(c);
+        ker.load(T(1.), c, md, nd);
 
         for (size_t k = 0; k < K; ++k)
             ker.ger(column(a(0, k)), row((~b)(k, 0)), md, nd);
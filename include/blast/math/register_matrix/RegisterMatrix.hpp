@@ -12,8 +12,10 @@
 #include <blast/math/StorageOrder.hpp>
 #include <blast/util/Types.hpp>
 #include <blast/util/Exception.hpp>
+#include <blast/util/TileStats.hpp>
 #include <blast/system/Inline.hpp>
 
+#include <algorithm>
 #include <stdexcept>
 #include <type_traits>
 
@@ -109,11 +111,29 @@ namespace blast
         }
 
 
+        /// @brief Apply a functor to all SIMD registers of the matrix: v := f(v).
+        ///
+        /// The functor is called with a @a SimdVec argument and must return a @a SimdVec.
+        /// Padding elements of the registers are transformed too.
+        ///
+        template <typename F>
+        void transform(F&& f)
+        {
+            #pragma unroll
+            for (size_t i = 0; i < RM; ++i)
+                #pragma unroll
+                for (size_t j = 0; j < RN; ++j)
+                    v_[i][j] = f(v_[i][j]);
+        }
+
+
         /// @brief R += beta * A
         template <typename PA>
         requires MatrixPointer<PA, T> && (PA::storageOrder == columnMajor)
         void axpy(T beta, PA a) noexcept
         {
+            BLAST_TILE_STATS_RECORD(profile::detail::recordLoads(RM * N, 0));
+
             SimdVecType const beta_simd {beta};
 
             #pragma unroll
@@ -129,13 +149,18 @@ namespace blast
         requires MatrixPointer<PA, T> && (PA::storageOrder == columnMajor)
         void axpy(T beta, PA a, size_t m, size_t n) noexcept
         {
+            if constexpr (PA::aligned && PA::padded)
+                BLAST_TILE_STATS_RECORD(profile::detail::recordLoads(std::min(n, N) * std::min(RM, (m + SS - 1) / SS), 0));
+            else
+                BLAST_TILE_STATS_RECORD(profile::detail::recordLoads(std::min(n, N) * std::min(RM, m / SS), m % SS ? std::min(n, N) : 0));
+
             SimdVecType const beta_simd {beta};
 
             #pragma unroll
             for (size_t j = 0; j < N; ++j) if (j < n)
                 #pragma unroll
                 for (size_t i = 0; i < RM; ++i) if (SS * i < m)
-                    v_[i][j] = fmadd(beta_simd, a(SS * i, j).load(), v_[i][j]);
+                    v_[i][j] = fmadd(beta_simd, loadRows(a(SS * i, j), m - SS * i), v_[i][j]);
         }
 
 
@@ -385,6 +410,20 @@ namespace blast
         SimdVecType v_[RM][RN];
 
 
+        /// @brief Load a SIMD register from \a p reading at most \a rem elements.
+        ///
+        /// If the storage is both aligned and padded, or \a rem is not less than SS, an unmasked load is used.
+        /// Otherwise the load is masked, so that no elements past the end of an unpadded column are read.
+        template <typename P>
+        static SimdVecType loadRows(P p, size_t rem) noexcept
+        {
+            if constexpr (P::aligned && P::padded)
+                return p.load();
+            else
+                return rem >= SS ? p.load() : p.load(indexSequence<T, Arch>() < rem);
+        }
+
+
         /// @brief Reference to the matrix element at row \a i and column \a j
         T& at(size_t i, size_t j)
         {
@@ -431,6 +470,8 @@ namespace blast
     requires MatrixPointer<P, T> && (P::storageOrder == columnMajor)
     inline void RegisterMatrix<T, M, N, SO>::load(P p) noexcept
     {
+        BLAST_TILE_STATS_RECORD(profile::detail::recordLoads(RM * N, 0));
+
         #pragma unroll
         for (size_t j = 0; j < N; ++j)
             #pragma unroll
@@ -444,6 +485,8 @@ namespace blast
     requires MatrixPointer<P, T> && (P::storageOrder == columnMajor)
     inline void RegisterMatrix<T, M, N, SO>::load(T beta, P p) noexcept
     {
+        BLAST_TILE_STATS_RECORD(profile::detail::recordLoads(RM * N, 0));
+
         #pragma unroll
         for (size_t j = 0; j < N; ++j)
             #pragma unroll
@@ -457,6 +500,11 @@ namespace blast
     requires MatrixPointer<P, T> && (P::storageOrder == columnMajor)
     inline void RegisterMatrix<T, M, N, SO>::load(T beta, P p, size_t m, size_t n) noexcept
     {
+        if constexpr (P::aligned && P::padded)
+            BLAST_TILE_STATS_RECORD(profile::detail::recordLoads(std::min(n, N) * std::min(RM, (m + SS - 1) / SS), 0));
+        else
+            BLAST_TILE_STATS_RECORD(profile::detail::recordLoads(std::min(n, N) * std::min(RM, m / SS), m % SS ? std::min(n, N) : 0));
+
         #pragma unroll
         for (size_t j = 0; j < N; ++j) if (j < n)
         {
@@ -485,6 +533,8 @@ namespace blast
     requires MatrixPointer<P, T> && (P::storageOrder == columnMajor)
     inline void RegisterMatrix<T, M, N, SO>::store(P p) const noexcept
     {
+        BLAST_TILE_STATS_RECORD(profile::detail::recordStores(RM * N, 0));
+
         #pragma unroll
         for (size_t j = 0; j < N; ++j)
             #pragma unroll
@@ -498,6 +548,8 @@ namespace blast
     requires MatrixPointer<P, T> && (P::storageOrder == columnMajor)
     inline void RegisterMatrix<T, M, N, SO>::store(P p, size_t m, size_t n) const noexcept
     {
+        BLAST_TILE_STATS_RECORD(profile::detail::recordStores(std::min(n, N) * std::min(RM, m / SS), m % SS ? std::min(n, N) : 0));
+
         // The compile-time constant size of the j loop in combination with the if() expression
         // prevent Clang from emitting memcpy() call here and produce good enough code with the loop unrolled.
         for (size_t j = 0; j < N; ++j) if (j < n)
@@ -529,9 +581,12 @@ namespace blast
             {
                 MaskType const mask = indexSequence<T, Arch>() >= skip;
                 p(SS * ri, j).store(v_[ri][j], mask);
+                BLAST_TILE_STATS_RECORD(profile::detail::recordStores(0, 1));
                 ++ri;
             }
 
+            BLAST_TILE_STATS_RECORD(profile::detail::recordStores(ri < RM ? RM - ri : 0, 0));
+
             for(; ri < RM; ++ri)
                 p(SS * ri, j).store(v_[ri][j]);
         }
@@ -545,6 +600,8 @@ namespace blast
     {
         for (size_t j = 0; j < N; ++j) if (j < n)
         {
+            BLAST_TILE_STATS_RECORD(profile::detail::recordStores(0, j / SS < RM ? RM - j / SS : 0));
+
             for (size_t ri = j / SS; ri < RM; ++ri)
             {
                 IntType const skip = j - ri * SS;
@@ -610,6 +667,7 @@ namespace blast
     BLAST_ALWAYS_INLINE void RegisterMatrix<T, M, N, SO>::ger(T alpha, PA a, PB b) noexcept
     {
         BLAZE_STATIC_ASSERT_MSG((RM * RN + RM + 1 <= registerCapacity(Arch {})), "Not enough registers for ger()");
+        BLAST_TILE_STATS_RECORD(profile::detail::recordLoads(RM, 0));
 
         SimdVecType ax[RM];
 
@@ -637,6 +695,7 @@ namespace blast
     BLAST_ALWAYS_INLINE void RegisterMatrix<T, M, N, SO>::ger(PA a, PB b) noexcept
     {
         BLAZE_STATIC_ASSERT_MSG((RM * RN + RM + 1 <= registerCapacity(Arch {})), "Not enough registers for ger()");
+        BLAST_TILE_STATS_RECORD(profile::detail::recordLoads(RM, 0));
 
         SimdVecType ax[RM];
 
@@ -663,11 +722,17 @@ namespace blast
         VectorPointer<PB, T> && (PB::transposeFlag == rowVector)
     BLAST_ALWAYS_INLINE void RegisterMatrix<T, M, N, SO>::ger(T alpha, PA a, PB b, size_t m, size_t n) noexcept
     {
+        if constexpr (PA::aligned && PA::padded)
+            BLAST_TILE_STATS_RECORD(profile::detail::recordLoads(std::min(RM, (m + SS - 1) / SS), 0));
+        else
+            BLAST_TILE_STATS_RECORD(profile::detail::recordLoads(std::min(RM, m / SS), m % SS ? 1 : 0));
+
         SimdVecType ax[RM];
 
+        // Only the registers containing rows 0...m-1 are loaded and updated.
         #pragma unroll
-        for (size_t i = 0; i < RM; ++i)
-            ax[i] = alpha * a(i * SS).load();
+        for (size_t i = 0; i < RM; ++i) if (SS * i < m)
+            ax[i] = alpha * loadRows(a(i * SS), m - SS * i);
 
         #pragma unroll
         for (size_t j = 0; j < N; ++j) if (j < n)
@@ -675,7 +740,7 @@ namespace blast
             SimdVecType const bx = b[j];
 
             #pragma unroll
-            for (size_t i = 0; i < RM; ++i)
+            for (size_t i = 0; i < RM; ++i) if (SS * i < m)
                 v_[i][j] = fmadd(ax[i], bx, v_[i][j]);
         }
     }
@@ -688,11 +753,17 @@ namespace blast
         VectorPointer<PB, T> && (PB::transposeFlag == rowVector)
     BLAST_ALWAYS_INLINE void RegisterMatrix<T, M, N, SO>::ger(PA a, PB b, size_t m, size_t n) noexcept
     {
+        if constexpr (PA::aligned && PA::padded)
+            BLAST_TILE_STATS_RECORD(profile::detail::recordLoads(std::min(RM, (m + SS - 1) / SS), 0));
+        else
+            BLAST_TILE_STATS_RECORD(profile::detail::recordLoads(std::min(RM, m / SS), m % SS ? 1 : 0));
+
         SimdVecType ax[RM];
 
+        // Only the registers containing rows 0...m-1 are loaded and updated.
         #pragma unroll
-        for (size_t i = 0; i < RM; ++i)
-            ax[i] = a(i * SS).load();
+        for (size_t i = 0; i < RM; ++i) if (SS * i < m)
+            ax[i] = loadRows(a(i * SS), m - SS * i);
 
         #pragma unroll
         for (size_t j = 0; j < N; ++j) if (j < n)
@@ -700,7 +771,7 @@ namespace blast
             SimdVecType const bx = b[j];
 
             #pragma unroll
-            for (size_t i = 0; i < RM; ++i)
+            for (size_t i = 0; i < RM; ++i) if (SS * i < m)
                 v_[i][j] = fmadd(ax[i], bx, v_[i][j]);
         }
     }
@@ -843,9 +914,7 @@ namespace blast
     requires MatrixPointer<PB, T> && (PB::storageOrder == columnMajor) && MatrixPointer<PA, T>
     BLAST_ALWAYS_INLINE void RegisterMatrix<T, M, N, SO>::trmm(T alpha, PB b, PA a, UpLo uplo, bool diagonal_unit, size_t m, size_t n) noexcept
     {
-        // NOTE: this implementation uses unmasked loads from the matrix a,
-        // and therefore will access rows of a beyond m-1.
-        // This will result in undefined behavior on unpadded matrices.
+        // Only the registers containing rows 0...m-1 of b are loaded and updated.
         auto au = ~a;
 
         if constexpr (SO == columnMajor)
@@ -856,8 +925,8 @@ namespace blast
                 SimdVecType bx[RM];
 
                 #pragma unroll
-                for (size_t i = 0; i < RM; ++i)
-                    bx[i] = alpha * b(i * SS, 0).load();
+                for (size_t i = 0; i < RM; ++i) if (SS * i < m)
+                    bx[i] = alpha * loadRows(b(i * SS, 0), m - SS * i);
 
                 #pragma unroll
                 for (size_t j = 0; j <= k; ++j)
@@ -865,7 +934,7 @@ namespace blast
                     SimdVecType const ax = au[0, j];
 
                     #pragma unroll
-                    for (size_t i = 0; i < RM; ++i)
+                    for (size_t i = 0; i < RM; ++i) if (SS * i < m)
                         v_[i][j] = fmadd(bx[i], ax, v_[i][j]);
                 }
 
@@ -0,0 +1,58 @@
+// Copyright 2024 Mikhail Katliar
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <blast/math/simd/Simd.hpp>
+#include <blast/system/Inline.hpp>
+
+#include <cstdlib>
+#include <limits>
+#include <type_traits>
+
+
+namespace blast
+{
+    /**
+     * @brief Hint the processor to bring the cache line containing @a p into the L1 cache.
+     *
+     * Prefetching never faults, so @a p is allowed to point outside of an allocated region.
+     *
+     * @tparam T element type
+     * @tparam Arch instruction set architecture
+     *
+     * @param p memory location to prefetch
+     */
+    template <typename T, typename Arch = xsimd::default_arch>
+    BLAST_ALWAYS_INLINE void prefetch(T const * p) noexcept
+    {
+        detail::prefetch(Arch {}, p);
+    }
+
+
+    /**
+     * @brief Default prefetch distance of the register-blocked gemm kernels, in iterations of the K loop.
+     *
+     * The values are estimated from the cycles of one K iteration and the L2 and L3 latencies.
+     * They should be checked on a given CPU with the BM_gemm_dynamic_plain_prefetch benchmark.
+     *
+     * @tparam T matrix element type
+     * @tparam Arch instruction set architecture
+     */
+    template <typename T, typename Arch = xsimd::default_arch>
+    std::size_t constexpr PrefetchDistance_v = detail::prefetchDistance<std::remove_cv_t<T>>(Arch {});
+
+
+    /// @brief Value of the PFD template argument of gemm() which selects @a PrefetchDistance_v of the matrix element type.
+    std::size_t constexpr DEFAULT_PREFETCH_DISTANCE = std::numeric_limits<std::size_t>::max();
+}
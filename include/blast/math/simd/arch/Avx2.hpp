@@ -26,6 +26,21 @@ namespace blast
         {
             return 16;
         }
+
+
+        inline void prefetch(xsimd::avx2, void const * p) noexcept
+        {
+            _mm_prefetch(static_cast<char const *>(p), _MM_HINT_T0);
+        }
+
+
+        /// @brief One K iteration of a 12x4 double or 24x4 float kernel takes about 6 cycles,
+        /// 8 iterations cover the L2 latency and most of the L3 latency.
+        template <typename T>
+        std::size_t constexpr prefetchDistance(xsimd::avx2)
+        {
+            return 8;
+        }
     }
 
 
@@ -17,6 +17,21 @@ namespace blast
         {
             return 32;
         }
+
+
+        inline void prefetch(xsimd::neon64, void const * p) noexcept
+        {
+            __builtin_prefetch(p, 0, 3);
+        }
+
+
+        /// @brief With 32 registers the kernels are larger and one K iteration takes longer than with AVX2,
+        /// so fewer iterations are needed to cover the same latency.
+        template <typename T>
+        std::size_t constexpr prefetchDistance(xsimd::neon64)
+        {
+            return 4;
+        }
     }
 
 
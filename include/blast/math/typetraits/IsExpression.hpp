@@ -0,0 +1,39 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <type_traits>
+
+
+namespace blast
+{
+    /**
+     * @brief Tests if the given type is a lazily evaluated matrix expression.
+     *
+     * Expressions are stored by value inside other expressions and can be assigned to dense matrices.
+     *
+     * @tparam T data type
+     */
+    template <typename T>
+    struct IsExpression : std::integral_constant<bool, false> {};
+
+
+    /**
+     * @brief Specialization for const types
+     *
+     * @tparam T data type
+     */
+    template <typename T>
+    struct IsExpression<T const> : IsExpression<T> {};
+
+
+    /**
+     * @brief Shortcut for @a IsExpression<T>::value
+     *
+     * @tparam T data type
+     */
+    template <typename T>
+    bool constexpr IsExpression_v = IsExpression<T>::value;
+}
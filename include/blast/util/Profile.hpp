@@ -0,0 +1,391 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
+#include <ostream>
+
+#if defined(__x86_64__) || defined(__i386__)
+#   include <x86intrin.h>
+#endif
+
+
+/**
+ * @file
+ * @brief Scoped profiling of BLAST routines.
+ *
+ * If BLAST_PROFILE is defined, the entry of every public algorithm (gemm, syrkLower, potrf, getrf, trsm, trmm, ger
+ * and iamax) records the number of calls, a histogram of the problem sizes and the elapsed time stamp counter cycles
+ * of the calling thread. Nested calls, e.g. the gemm() calls inside getrf(), are attributed to the outermost routine.
+ * @a profile::snapshot() collects the records of all threads and @a profile::dump() prints them.
+ *
+ * If BLAST_PROFILE is not defined, BLAST_PROFILE_SCOPE() expands to nothing and its arguments are not evaluated.
+ *
+ * BLAST_PROFILE must be defined in all translation units of a program or in none of them,
+ * e.g. by linking the @a blast target configured with BLAST_WITH_PROFILE=ON.
+ */
+
+
+namespace blast :: profile
+{
+    /// @brief Profiled routines
+    enum class Routine : std::size_t
+    {
+        gemm,
+        syrk,
+        potrf,
+        getrf,
+        trsm,
+        trmm,
+        ger,
+        iamax
+    };
+
+
+    /// @brief Number of values of @a Routine
+    inline constexpr std::size_t routineCount = 8;
+
+
+    /// @brief Number of size histogram bins
+    inline constexpr std::size_t sizeBins = 12;
+
+
+    /// @brief Name of a routine
+    inline char const * name(Routine r) noexcept
+    {
+        static char const * const names[routineCount] = {
+            "gemm", "syrk", "potrf", "getrf", "trsm", "trmm", "ger", "iamax"
+        };
+
+        return names[static_cast<std::size_t>(r)];
+    }
+
+
+    /**
+     * @brief Size histogram bin of a call.
+     *
+     * Bin 0 contains sizes up to 1, bin b > 0 contains sizes in (2^(b-1), 2^b],
+     * and the last bin contains all sizes above 2^(sizeBins - 2).
+     *
+     * @param size the largest matrix or vector dimension of a call
+     */
+    inline constexpr std::size_t sizeBin(std::size_t size) noexcept
+    {
+        return std::min<std::size_t>(std::bit_width(size > 0 ? size - 1 : 0), sizeBins - 1);
+    }
+
+
+    /**
+     * @brief Current value of the time stamp counter.
+     *
+     * This is rdtsc on x86 and the virtual counter on ARM64, which both tick at a constant rate on current CPUs.
+     * On other architectures, nanoseconds of the steady clock are returned.
+     */
+    inline std::uint64_t ticks() noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        std::uint64_t t;
+        asm volatile("mrs %0, cntvct_el0" : "=r" (t));
+        return t;
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+
+    /// @brief Statistics of one routine
+    struct RoutineStats
+    {
+        std::uint64_t calls = 0;
+        std::uint64_t cycles = 0;
+
+        /// @brief Number of calls in every size bin, see @a sizeBin()
+        std::array<std::uint64_t, sizeBins> binCalls {};
+
+        /// @brief Cycles spent in calls in every size bin
+        std::array<std::uint64_t, sizeBins> binCycles {};
+
+
+        RoutineStats& operator+=(RoutineStats const& rhs) noexcept
+        {
+            calls += rhs.calls;
+            cycles += rhs.cycles;
+
+            for (std::size_t b = 0; b < sizeBins; ++b)
+            {
+                binCalls[b] += rhs.binCalls[b];
+                binCycles[b] += rhs.binCycles[b];
+            }
+
+            return *this;
+        }
+
+
+        RoutineStats& operator-=(RoutineStats const& rhs) noexcept
+        {
+            calls -= rhs.calls;
+            cycles -= rhs.cycles;
+
+            for (std::size_t b = 0; b < sizeBins; ++b)
+            {
+                binCalls[b] -= rhs.binCalls[b];
+                binCycles[b] -= rhs.binCycles[b];
+            }
+
+            return *this;
+        }
+    };
+
+
+    /**
+     * @brief Statistics of all routines summed over all threads.
+     *
+     * The counters only grow, so the statistics of a region of code are the difference
+     * of the snapshots taken after and before it.
+     */
+    struct Snapshot
+    {
+        std::array<RoutineStats, routineCount> routines {};
+
+
+        RoutineStats const& operator[](Routine r) const noexcept
+        {
+            return routines[static_cast<std::size_t>(r)];
+        }
+
+
+        RoutineStats& operator[](Routine r) noexcept
+        {
+            return routines[static_cast<std::size_t>(r)];
+        }
+
+
+        Snapshot& operator-=(Snapshot const& rhs) noexcept
+        {
+            for (std::size_t r = 0; r < routineCount; ++r)
+                routines[r] -= rhs.routines[r];
+
+            return *this;
+        }
+
+
+        friend Snapshot operator-(Snapshot lhs, Snapshot const& rhs) noexcept
+        {
+            return lhs -= rhs;
+        }
+    };
+
+
+    namespace detail
+    {
+        /// @brief Counter written by one thread and read by any thread, without locked instructions.
+        class Counter
+        {
+        public:
+            void add(std::uint64_t d) noexcept
+            {
+                value_.store(value_.load(std::memory_order_relaxed) + d, std::memory_order_relaxed);
+            }
+
+
+            std::uint64_t load() const noexcept
+            {
+                return value_.load(std::memory_order_relaxed);
+            }
+
+
+        private:
+            std::atomic<std::uint64_t> value_ {0};
+        };
+
+
+        /// @brief Statistics of one thread
+        struct ThreadBuffer
+        {
+            std::array<Counter, routineCount> calls;
+            std::array<Counter, routineCount> cycles;
+            std::array<std::array<Counter, sizeBins>, routineCount> binCalls;
+            std::array<std::array<Counter, sizeBins>, routineCount> binCycles;
+
+            /// @brief Number of active scopes of the thread
+            std::size_t depth = 0;
+
+            ThreadBuffer * next = nullptr;
+        };
+
+
+        /// @brief Head of the list of the buffers of all threads
+        ///
+        /// The list is shared by all modules of a program, including shared libraries
+        /// built with hidden visibility such as libblast_blas, so that snapshot() sees the calls made in any of them.
+        /// Every module has its own buffer of a thread in the list.
+        [[gnu::visibility("default")]] inline std::atomic<ThreadBuffer *> threadBuffers {nullptr};
+
+
+        /**
+         * @brief Buffer of the calling thread, created on the first use.
+         *
+         * The buffers are never freed, so that snapshots include the threads that have finished.
+         */
+        inline ThreadBuffer& threadBuffer()
+        {
+            thread_local ThreadBuffer * const buffer = []
+            {
+                ThreadBuffer * const b = new ThreadBuffer;
+                b->next = threadBuffers.load(std::memory_order_relaxed);
+
+                while (!threadBuffers.compare_exchange_weak(b->next, b, std::memory_order_release, std::memory_order_relaxed));
+
+                return b;
+            }();
+
+            return *buffer;
+        }
+    }
+
+
+    /// @brief Statistics of all threads at the moment of the call.
+    inline Snapshot snapshot()
+    {
+        Snapshot s;
+
+        for (detail::ThreadBuffer const * b = detail::threadBuffers.load(std::memory_order_acquire); b; b = b->next)
+        {
+            for (std::size_t r = 0; r < routineCount; ++r)
+            {
+                RoutineStats& stats = s.routines[r];
+                stats.calls += b->calls[r].load();
+                stats.cycles += b->cycles[r].load();
+
+                for (std::size_t k = 0; k < sizeBins; ++k)
+                {
+                    stats.binCalls[k] += b->binCalls[r][k].load();
+                    stats.binCycles[k] += b->binCycles[r][k].load();
+                }
+            }
+        }
+
+        return s;
+    }
+
+
+    /**
+     * @brief Prints a table with the number of calls and cycles of every routine and size bin.
+     *
+     * Routines and bins without calls are omitted.
+     */
+    inline void dump(std::ostream& os, Snapshot const& s)
+    {
+        os << std::left << std::setw(8) << "routine" << std::right
+            << std::setw(8) << "size" << std::setw(14) << "calls"
+            << std::setw(18) << "cycles" << std::setw(14) << "cycles/call" << '\n';
+
+        auto const row = [&os] (char const * routine, char const * size, std::uint64_t calls, std::uint64_t cycles)
+        {
+            os << std::left << std::setw(8) << routine << std::right
+                << std::setw(8) << size << std::setw(14) << calls << std::setw(18) << cycles
+                << std::setw(14) << std::fixed << std::setprecision(1) << static_cast<double>(cycles) / calls << '\n';
+        };
+
+        for (std::size_t r = 0; r < routineCount; ++r)
+        {
+            RoutineStats const& stats = s.routines[r];
+
+            if (stats.calls == 0)
+                continue;
+
+            for (std::size_t b = 0; b < sizeBins; ++b)
+            {
+                if (stats.binCalls[b] == 0)
+                    continue;
+
+                char size[16];
+                if (b + 1 < sizeBins)
+                    std::snprintf(size, sizeof(size), "<=%zu", std::size_t(1) << b);
+                else
+                    std::snprintf(size, sizeof(size), ">%zu", std::size_t(1) << (b - 1));
+
+                row(name(static_cast<Routine>(r)), size, stats.binCalls[b], stats.binCycles[b]);
+            }
+
+            row(name(static_cast<Routine>(r)), "all", stats.calls, stats.cycles);
+        }
+    }
+
+
+    /**
+     * @brief Records a call of a routine in the buffer of the calling thread when it goes out of scope.
+     *
+     * Use BLAST_PROFILE_SCOPE() instead of creating it directly.
+     */
+    class Scope
+    {
+    public:
+        /**
+         * @param routine the routine
+         * @param m, n, k dimensions of the call; the size histogram uses the largest of them
+         */
+        Scope(Routine routine, std::size_t m, std::size_t n = 0, std::size_t k = 0) noexcept
+        :   buffer_ {detail::threadBuffer()}
+        ,   routine_ {static_cast<std::size_t>(routine)}
+        ,   bin_ {sizeBin(std::max({m, n, k}))}
+        ,   outer_ {buffer_.depth++ == 0}
+        ,   start_ {outer_ ? ticks() : 0}
+        {
+        }
+
+
+        Scope(Scope const&) = delete;
+        Scope& operator=(Scope const&) = delete;
+
+
+        ~Scope()
+        {
+            --buffer_.depth;
+
+            if (outer_)
+            {
+                std::uint64_t const cycles = ticks() - start_;
+                buffer_.calls[routine_].add(1);
+                buffer_.cycles[routine_].add(cycles);
+                buffer_.binCalls[routine_][bin_].add(1);
+                buffer_.binCycles[routine_][bin_].add(cycles);
+            }
+        }
+
+
+    private:
+        detail::ThreadBuffer& buffer_;
+        std::size_t const routine_;
+        std::size_t const bin_;
+        bool const outer_;
+        std::uint64_t const start_;
+    };
+}
+
+
+/**
+ * @brief Profiles the enclosing scope as a call of a routine, if BLAST_PROFILE is defined.
+ *
+ * @param routine the name of a @a blast::profile::Routine value, e.g. gemm
+ * @param ... one to three dimensions of the call
+ */
+#if defined(BLAST_PROFILE)
+#   define BLAST_PROFILE_SCOPE(routine, ...) \
+        ::blast::profile::Scope const blastProfileScope {::blast::profile::Routine::routine, __VA_ARGS__}
+#else
+#   define BLAST_PROFILE_SCOPE(routine, ...) static_cast<void>(0)
+#endif
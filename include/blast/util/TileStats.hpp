@@ -0,0 +1,263 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <blast/util/Profile.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <string>
+
+
+/**
+ * @file
+ * @brief Statistics of the register tiles and of the SIMD loads and stores of register matrices.
+ *
+ * If BLAST_TILE_STATS is defined, @a tile() counts the full and the partial tiles for every register matrix shape,
+ * and the @a RegisterMatrix load and store functions count the masked and the unmasked SIMD loads and stores.
+ * The counters are kept per thread like the ones in blast/util/Profile.hpp;
+ * @a profile::tileStats() collects them from all threads and @a profile::dump() prints them.
+ *
+ * Counting makes the kernels slower, so the timings of a program built with BLAST_TILE_STATS are not representative.
+ * If BLAST_TILE_STATS is not defined, BLAST_TILE_STATS_RECORD() expands to nothing.
+ */
+
+
+namespace blast :: profile
+{
+    /// @brief Maximum number of rows of a register matrix counted by the tile statistics
+    inline constexpr std::size_t tileMaxRows = 64;
+
+
+    /// @brief Maximum number of columns of a register matrix counted by the tile statistics
+    inline constexpr std::size_t tileMaxColumns = 16;
+
+
+    /**
+     * @brief Tile statistics summed over all threads.
+     *
+     * Like @a Snapshot, the statistics of a region of code are the difference
+     * of the statistics taken after and before it.
+     */
+    struct TileStats
+    {
+        using ShapeCounts = std::array<std::array<std::uint64_t, tileMaxColumns + 1>, tileMaxRows + 1>;
+
+        /// @brief Number of full tiles by register matrix rows and columns
+        ShapeCounts fullTiles {};
+
+        /// @brief Number of partial tiles by register matrix rows and columns
+        ShapeCounts partialTiles {};
+
+        /// @brief Number of SIMD register loads without a mask
+        std::uint64_t loads = 0;
+
+        /// @brief Number of SIMD register loads with a mask
+        std::uint64_t maskedLoads = 0;
+
+        /// @brief Number of SIMD register stores without a mask
+        std::uint64_t stores = 0;
+
+        /// @brief Number of SIMD register stores with a mask
+        std::uint64_t maskedStores = 0;
+
+
+        TileStats& operator-=(TileStats const& rhs) noexcept
+        {
+            for (std::size_t i = 0; i <= tileMaxRows; ++i)
+                for (std::size_t j = 0; j <= tileMaxColumns; ++j)
+                {
+                    fullTiles[i][j] -= rhs.fullTiles[i][j];
+                    partialTiles[i][j] -= rhs.partialTiles[i][j];
+                }
+
+            loads -= rhs.loads;
+            maskedLoads -= rhs.maskedLoads;
+            stores -= rhs.stores;
+            maskedStores -= rhs.maskedStores;
+
+            return *this;
+        }
+
+
+        friend TileStats operator-(TileStats lhs, TileStats const& rhs) noexcept
+        {
+            return lhs -= rhs;
+        }
+
+
+        /// @brief Total number of full tiles
+        std::uint64_t totalFullTiles() const noexcept
+        {
+            return total(fullTiles);
+        }
+
+
+        /// @brief Total number of partial tiles
+        std::uint64_t totalPartialTiles() const noexcept
+        {
+            return total(partialTiles);
+        }
+
+
+        /// @brief Whether nothing has been counted
+        bool empty() const noexcept
+        {
+            return totalFullTiles() == 0 && totalPartialTiles() == 0
+                && loads == 0 && maskedLoads == 0 && stores == 0 && maskedStores == 0;
+        }
+
+
+    private:
+        static std::uint64_t total(ShapeCounts const& counts) noexcept
+        {
+            std::uint64_t sum = 0;
+
+            for (auto const& row : counts)
+                for (std::uint64_t c : row)
+                    sum += c;
+
+            return sum;
+        }
+    };
+
+
+    namespace detail
+    {
+        /// @brief Tile statistics of one thread
+        struct TileThreadBuffer
+        {
+            std::array<std::array<Counter, tileMaxColumns + 1>, tileMaxRows + 1> fullTiles;
+            std::array<std::array<Counter, tileMaxColumns + 1>, tileMaxRows + 1> partialTiles;
+            Counter loads;
+            Counter maskedLoads;
+            Counter stores;
+            Counter maskedStores;
+
+            TileThreadBuffer * next = nullptr;
+        };
+
+
+        /// @brief Head of the list of the tile statistics buffers of all threads
+        inline std::atomic<TileThreadBuffer *> tileThreadBuffers {nullptr};
+
+
+        /// @brief Tile statistics buffer of the calling thread, created on the first use and never freed.
+        inline TileThreadBuffer& tileThreadBuffer()
+        {
+            thread_local TileThreadBuffer * const buffer = []
+            {
+                TileThreadBuffer * const b = new TileThreadBuffer;
+                b->next = tileThreadBuffers.load(std::memory_order_relaxed);
+
+                while (!tileThreadBuffers.compare_exchange_weak(b->next, b, std::memory_order_release, std::memory_order_relaxed));
+
+                return b;
+            }();
+
+            return *buffer;
+        }
+
+
+        /// @brief Count a tile of a register matrix of size KM by KN
+        template <std::size_t KM, std::size_t KN>
+        inline void recordTile(bool full) noexcept
+        {
+            static_assert(KM <= tileMaxRows && KN <= tileMaxColumns, "Register matrix shape out of the tile statistics range");
+
+            TileThreadBuffer& b = tileThreadBuffer();
+            (full ? b.fullTiles : b.partialTiles)[KM][KN].add(1);
+        }
+
+
+        /// @brief Count unmasked and masked SIMD loads
+        inline void recordLoads(std::size_t unmasked, std::size_t masked) noexcept
+        {
+            TileThreadBuffer& b = tileThreadBuffer();
+            b.loads.add(unmasked);
+            b.maskedLoads.add(masked);
+        }
+
+
+        /// @brief Count unmasked and masked SIMD stores
+        inline void recordStores(std::size_t unmasked, std::size_t masked) noexcept
+        {
+            TileThreadBuffer& b = tileThreadBuffer();
+            b.stores.add(unmasked);
+            b.maskedStores.add(masked);
+        }
+    }
+
+
+    /// @brief Tile statistics of all threads at the moment of the call.
+    inline TileStats tileStats()
+    {
+        TileStats s;
+
+        for (detail::TileThreadBuffer const * b = detail::tileThreadBuffers.load(std::memory_order_acquire); b; b = b->next)
+        {
+            for (std::size_t i = 0; i <= tileMaxRows; ++i)
+                for (std::size_t j = 0; j <= tileMaxColumns; ++j)
+                {
+                    s.fullTiles[i][j] += b->fullTiles[i][j].load();
+                    s.partialTiles[i][j] += b->partialTiles[i][j].load();
+                }
+
+            s.loads += b->loads.load();
+            s.maskedLoads += b->maskedLoads.load();
+            s.stores += b->stores.load();
+            s.maskedStores += b->maskedStores.load();
+        }
+
+        return s;
+    }
+
+
+    /**
+     * @brief Prints the number of full and partial tiles of every register matrix shape,
+     * and the number of masked and unmasked loads and stores.
+     *
+     * Shapes without tiles are omitted.
+     */
+    inline void dump(std::ostream& os, TileStats const& s)
+    {
+        os << std::left << std::setw(8) << "kernel" << std::right
+            << std::setw(14) << "full" << std::setw(14) << "partial" << std::setw(10) << "partial%" << '\n';
+
+        auto const row = [&os] (std::string const& kernel, std::uint64_t full, std::uint64_t partial)
+        {
+            os << std::left << std::setw(8) << kernel << std::right
+                << std::setw(14) << full << std::setw(14) << partial
+                << std::setw(10) << std::fixed << std::setprecision(1)
+                << (full + partial > 0 ? 100. * partial / (full + partial) : 0.) << '\n';
+        };
+
+        for (std::size_t i = 0; i <= tileMaxRows; ++i)
+            for (std::size_t j = 0; j <= tileMaxColumns; ++j)
+                if (s.fullTiles[i][j] || s.partialTiles[i][j])
+                    row(std::to_string(i) + "x" + std::to_string(j), s.fullTiles[i][j], s.partialTiles[i][j]);
+
+        row("all", s.totalFullTiles(), s.totalPartialTiles());
+
+        os << '\n' << std::left << std::setw(8) << "" << std::right
+            << std::setw(14) << "unmasked" << std::setw(14) << "masked" << std::setw(10) << "masked%" << '\n';
+        row("loads", s.loads, s.maskedLoads);
+        row("stores", s.stores, s.maskedStores);
+    }
+}
+
+
+/**
+ * @brief Executes the arguments as a statement to record tile statistics, if BLAST_TILE_STATS is defined.
+ */
+#if defined(BLAST_TILE_STATS)
+#   define BLAST_TILE_STATS_RECORD(...) __VA_ARGS__
+#else
+#   define BLAST_TILE_STATS_RECORD(...) static_cast<void>(0)
+#endif
@@ -0,0 +1,73 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+/// @brief Fortran BLAS entry points
+#include "Blas.hpp"
+#include "Dispatch.hpp"
+#include "Fallback.hpp"
+
+
+using blast::blas::Int;
+using blast::blas::fallback;
+
+
+extern "C"
+{
+    void dgemm_(char const * transa, char const * transb, Int const * m, Int const * n, Int const * k,
+        double const * alpha, double const * a, Int const * lda, double const * b, Int const * ldb,
+        double const * beta, double * c, Int const * ldc,
+        std::size_t, std::size_t)
+    {
+        if (!blast::blas::tryGemm(*transa, *transb, *m, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc))
+        {
+            static auto * const f = fallback<decltype(dgemm_)>("dgemm_");
+            f(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, 1, 1);
+        }
+    }
+
+
+    void sgemm_(char const * transa, char const * transb, Int const * m, Int const * n, Int const * k,
+        float const * alpha, float const * a, Int const * lda, float const * b, Int const * ldb,
+        float const * beta, float * c, Int const * ldc,
+        std::size_t, std::size_t)
+    {
+        if (!blast::blas::tryGemm(*transa, *transb, *m, *n, *k, *alpha, a, *lda, b, *ldb, *beta, c, *ldc))
+        {
+            static auto * const f = fallback<decltype(sgemm_)>("sgemm_");
+            f(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, 1, 1);
+        }
+    }
+
+
+    void dsyrk_(char const * uplo, char const * trans, Int const * n, Int const * k,
+        double const * alpha, double const * a, Int const * lda,
+        double const * beta, double * c, Int const * ldc,
+        std::size_t, std::size_t)
+    {
+        if (!blast::blas::trySyrk(*uplo, *trans, *n, *k, *alpha, a, *lda, *beta, c, *ldc))
+        {
+            static auto * const f = fallback<decltype(dsyrk_)>("dsyrk_");
+            f(uplo, trans, n, k, alpha, a, lda, beta, c, ldc, 1, 1);
+        }
+    }
+
+
+    void dtrmm_(char const * side, char const * uplo, char const * transa, char const * diag,
+        Int const * m, Int const * n,
+        double const * alpha, double const * a, Int const * lda, double * b, Int const * ldb,
+        std::size_t, std::size_t, std::size_t, std::size_t)
+    {
+        if (!blast::blas::tryTrmm(*side, *uplo, *transa, *diag, *m, *n, *alpha, a, *lda, b, *ldb))
+        {
+            static auto * const f = fallback<decltype(dtrmm_)>("dtrmm_");
+            f(side, uplo, transa, diag, m, n, alpha, a, lda, b, ldb, 1, 1, 1, 1);
+        }
+    }
+
+
+    Int idamax_(Int const * n, double const * x, Int const * incx)
+    {
+        return blast::blas::iamax(*n, x, *incx);
+    }
+}
@@ -0,0 +1,58 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+/// @brief Fortran BLAS/LAPACK interface exported by libblast_blas
+///
+/// The declarations follow the gfortran calling convention, in which the length of every
+/// character argument is passed as a hidden trailing argument.
+///
+#pragma once
+
+#include <cstddef>
+
+
+#define BLAST_BLAS_EXPORT __attribute__((visibility("default")))
+
+
+namespace blast :: blas
+{
+    /// @brief Integer type of the BLAS/LAPACK interface (LP64)
+    using Int = int;
+}
+
+
+extern "C"
+{
+    BLAST_BLAS_EXPORT void dgemm_(char const * transa, char const * transb,
+        blast::blas::Int const * m, blast::blas::Int const * n, blast::blas::Int const * k,
+        double const * alpha, double const * a, blast::blas::Int const * lda, double const * b, blast::blas::Int const * ldb,
+        double const * beta, double * c, blast::blas::Int const * ldc,
+        std::size_t transa_len, std::size_t transb_len);
+
+    BLAST_BLAS_EXPORT void sgemm_(char const * transa, char const * transb,
+        blast::blas::Int const * m, blast::blas::Int const * n, blast::blas::Int const * k,
+        float const * alpha, float const * a, blast::blas::Int const * lda, float const * b, blast::blas::Int const * ldb,
+        float const * beta, float * c, blast::blas::Int const * ldc,
+        std::size_t transa_len, std::size_t transb_len);
+
+    BLAST_BLAS_EXPORT void dsyrk_(char const * uplo, char const * trans,
+        blast::blas::Int const * n, blast::blas::Int const * k,
+        double const * alpha, double const * a, blast::blas::Int const * lda,
+        double const * beta, double * c, blast::blas::Int const * ldc,
+        std::size_t uplo_len, std::size_t trans_len);
+
+    BLAST_BLAS_EXPORT void dtrmm_(char const * side, char const * uplo, char const * transa, char const * diag,
+        blast::blas::Int const * m, blast::blas::Int const * n,
+        double const * alpha, double const * a, blast::blas::Int const * lda, double * b, blast::blas::Int const * ldb,
+        std::size_t side_len, std::size_t uplo_len, std::size_t transa_len, std::size_t diag_len);
+
+    BLAST_BLAS_EXPORT blast::blas::Int idamax_(blast::blas::Int const * n, double const * x, blast::blas::Int const * incx);
+
+    BLAST_BLAS_EXPORT void dpotrf_(char const * uplo, blast::blas::Int const * n,
+        double * a, blast::blas::Int const * lda, blast::blas::Int * info,
+        std::size_t uplo_len);
+
+    BLAST_BLAS_EXPORT void dgetrf_(blast::blas::Int const * m, blast::blas::Int const * n,
+        double * a, blast::blas::Int const * lda, blast::blas::Int * ipiv, blast::blas::Int * info);
+}
@@ -0,0 +1,128 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+/// @brief CBLAS entry points
+///
+/// The functions are implemented on top of the Fortran entry points. A row-major matrix is
+/// the transpose of a column-major matrix on the same memory, therefore row-major calls are mapped
+/// to column-major calls on the transposed problem.
+///
+#include "Blas.hpp"
+
+#include <cstddef>
+
+
+using blast::blas::Int;
+
+
+extern "C"
+{
+    enum CBLAS_ORDER {CblasRowMajor = 101, CblasColMajor = 102};
+    enum CBLAS_TRANSPOSE {CblasNoTrans = 111, CblasTrans = 112, CblasConjTrans = 113};
+    enum CBLAS_UPLO {CblasUpper = 121, CblasLower = 122};
+    enum CBLAS_DIAG {CblasNonUnit = 131, CblasUnit = 132};
+    enum CBLAS_SIDE {CblasLeft = 141, CblasRight = 142};
+}
+
+
+namespace
+{
+    char trans(CBLAS_TRANSPOSE t) noexcept
+    {
+        return t == CblasNoTrans ? 'N' : 'T';
+    }
+
+
+    char flipTrans(CBLAS_TRANSPOSE t) noexcept
+    {
+        return t == CblasNoTrans ? 'T' : 'N';
+    }
+
+
+    char uplo(CBLAS_UPLO u, bool flip) noexcept
+    {
+        return (u == CblasLower) != flip ? 'L' : 'U';
+    }
+
+
+    char side(CBLAS_SIDE s, bool flip) noexcept
+    {
+        return (s == CblasLeft) != flip ? 'L' : 'R';
+    }
+
+
+    char diag(CBLAS_DIAG d) noexcept
+    {
+        return d == CblasUnit ? 'U' : 'N';
+    }
+
+
+    /// @brief C = alpha*op(A)*op(B) + beta*C; in row-major order C^T = alpha*op(B)^T*op(A)^T + beta*C^T
+    template <typename T, typename F>
+    void gemm(F f, CBLAS_ORDER order, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb, Int m, Int n, Int k,
+        T alpha, T const * a, Int lda, T const * b, Int ldb, T beta, T * c, Int ldc) noexcept
+    {
+        char const ta = trans(transa), tb = trans(transb);
+
+        if (order == CblasColMajor)
+            f(&ta, &tb, &m, &n, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc, 1, 1);
+        else
+            f(&tb, &ta, &n, &m, &k, &alpha, b, &ldb, a, &lda, &beta, c, &ldc, 1, 1);
+    }
+}
+
+
+extern "C"
+{
+    BLAST_BLAS_EXPORT void cblas_dgemm(CBLAS_ORDER order, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb,
+        Int m, Int n, Int k, double alpha, double const * a, Int lda, double const * b, Int ldb,
+        double beta, double * c, Int ldc)
+    {
+        gemm(dgemm_, order, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+
+    BLAST_BLAS_EXPORT void cblas_sgemm(CBLAS_ORDER order, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb,
+        Int m, Int n, Int k, float alpha, float const * a, Int lda, float const * b, Int ldb,
+        float beta, float * c, Int ldc)
+    {
+        gemm(sgemm_, order, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
+
+    BLAST_BLAS_EXPORT void cblas_dsyrk(CBLAS_ORDER order, CBLAS_UPLO uplo_, CBLAS_TRANSPOSE trans_,
+        Int n, Int k, double alpha, double const * a, Int lda, double beta, double * c, Int ldc)
+    {
+        // The lower triangle of a row-major C is the upper triangle of the column-major C^T = C,
+        // and op(A)*op(A)^T in row-major order is op(A)^T*op(A) in column-major order.
+        bool const row = order == CblasRowMajor;
+        char const u = uplo(uplo_, row);
+        char const t = row ? flipTrans(trans_) : trans(trans_);
+
+        dsyrk_(&u, &t, &n, &k, &alpha, a, &lda, &beta, c, &ldc, 1, 1);
+    }
+
+
+    BLAST_BLAS_EXPORT void cblas_dtrmm(CBLAS_ORDER order, CBLAS_SIDE side_, CBLAS_UPLO uplo_,
+        CBLAS_TRANSPOSE transa, CBLAS_DIAG diag_, Int m, Int n,
+        double alpha, double const * a, Int lda, double * b, Int ldb)
+    {
+        // B = alpha*op(A)*B in row-major order is B^T = alpha*B^T*op(A)^T in column-major order
+        bool const row = order == CblasRowMajor;
+        char const s = side(side_, row), u = uplo(uplo_, row), t = trans(transa), d = diag(diag_);
+
+        if (row)
+            dtrmm_(&s, &u, &t, &d, &n, &m, &alpha, a, &lda, b, &ldb, 1, 1, 1, 1);
+        else
+            dtrmm_(&s, &u, &t, &d, &m, &n, &alpha, a, &lda, b, &ldb, 1, 1, 1, 1);
+    }
+
+
+    /// @brief Returns the 0-based index, as opposed to idamax_()
+    BLAST_BLAS_EXPORT std::size_t cblas_idamax(Int n, double const * x, Int incx)
+    {
+        Int const i = idamax_(&n, x, &incx);
+        return i > 0 ? i - 1 : 0;
+    }
+}
@@ -0,0 +1,314 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include "Dispatch.hpp"
+
+#include <blast/math/algorithm/Gemm.hpp>
+#include <blast/math/algorithm/Trmm.hpp>
+#include <blast/math/dense/CustomMatrix.hpp>
+#include <blast/math/dense/DynamicVectorPointer.hpp>
+#include <blast/math/dense/Getrf.hpp>
+#include <blast/math/dense/Iamax.hpp>
+#include <blast/math/dense/Potrf.hpp>
+#include <blast/math/dense/Syrk.hpp>
+#include <blast/math/UpLo.hpp>
+
+#include <blaze/math/DynamicMatrix.h>
+
+#include <algorithm>
+#include <cctype>
+#include <vector>
+
+
+#if !defined(BLAST_BLAS_MAX_SIZE)
+#   define BLAST_BLAS_MAX_SIZE 256
+#endif
+
+namespace blast :: blas
+{
+    namespace
+    {
+        /// @brief True if all sizes are positive and do not exceed @a BLAST_BLAS_MAX_SIZE
+        template <typename... Sizes>
+        bool withinSizeRange(Sizes... sizes) noexcept
+        {
+            return ((sizes > 0 && sizes <= BLAST_BLAS_MAX_SIZE) && ...);
+        }
+
+
+        char upper(char c) noexcept
+        {
+            return std::toupper(static_cast<unsigned char>(c));
+        }
+
+
+        /// @brief Decode a BLAS transpose argument; returns false if it is invalid
+        bool decodeTrans(char c, bool& trans) noexcept
+        {
+            c = upper(c);
+            trans = c == 'T' || c == 'C';
+            return trans || c == 'N';
+        }
+
+
+        /// @brief Decode a BLAS triangle argument; returns false if it is invalid
+        bool decodeUpLo(char c, bool& lower) noexcept
+        {
+            c = upper(c);
+            lower = c == 'L';
+            return lower || c == 'U';
+        }
+
+
+        /// @brief Staging buffer with the alignment and padding required by the BLAST dense kernels
+        using Staging = blaze::DynamicMatrix<double, blaze::columnMajor>;
+
+
+        /// @brief Per-thread staging buffer number @a I, resized to m-by-n
+        template <size_t I>
+        Staging& staging(size_t m, size_t n)
+        {
+            thread_local Staging s;
+            s.resize(m, n, false);
+            return s;
+        }
+
+
+        template <typename T>
+        bool tryGemmImpl(char transa, char transb, Int m, Int n, Int k,
+            T alpha, T const * a, Int lda, T const * b, Int ldb, T beta, T * c, Int ldc)
+        {
+            bool ta, tb;
+
+            if (!decodeTrans(transa, ta) || !decodeTrans(transb, tb) || !withinSizeRange(m, n, k) || alpha == T {})
+                return false;
+
+            if (lda < (ta ? k : m) || ldb < (tb ? n : k) || ldc < m)
+                return false;
+
+            // C is not read if beta is 0
+            if (beta == T {})
+                for (Int j = 0; j < n; ++j)
+                    std::fill_n(c + j * ldc, m, T {});
+
+            // The operands are used in place without padding: the register kernels mask the loads and stores
+            // past the last row of a tile, and read only rows 0...m-1 of a row-major A.
+            // A transposed column-major matrix is a row-major matrix on the same memory.
+            CustomMatrix<T, columnMajor> C(c, m, n, ldc);
+
+            auto const gemm_a = [&] (auto const& B)
+            {
+                if (ta)
+                    blast::gemm(alpha, CustomMatrix<T const, rowMajor>(a, m, k, lda), B, beta, C, C);
+                else
+                    blast::gemm(alpha, CustomMatrix<T const, columnMajor>(a, m, k, lda), B, beta, C, C);
+            };
+
+            if (tb)
+                gemm_a(CustomMatrix<T const, rowMajor>(b, k, n, ldb));
+            else
+                gemm_a(CustomMatrix<T const, columnMajor>(b, k, n, ldb));
+
+            return true;
+        }
+    }
+
+
+    bool tryGemm(char transa, char transb, Int m, Int n, Int k,
+        double alpha, double const * a, Int lda, double const * b, Int ldb, double beta, double * c, Int ldc) noexcept
+    {
+        try
+        {
+            return tryGemmImpl(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
+
+    bool tryGemm(char transa, char transb, Int m, Int n, Int k,
+        float alpha, float const * a, Int lda, float const * b, Int ldb, float beta, float * c, Int ldc) noexcept
+    {
+        try
+        {
+            return tryGemmImpl(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
+
+    bool trySyrk(char uplo, char trans, Int n, Int k,
+        double alpha, double const * a, Int lda, double beta, double * c, Int ldc) noexcept
+    {
+        try
+        {
+            bool lower, tr;
+
+            if (!decodeUpLo(uplo, lower) || !decodeTrans(trans, tr) || !withinSizeRange(n, k) || alpha == 0.)
+                return false;
+
+            if (lda < (tr ? k : n) || ldc < n)
+                return false;
+
+            // syrkLower() computes the lower triangle from a non-transposed A, therefore op(A) and the referenced
+            // triangle of C are copied to the staging buffers. The upper triangle of C is the transpose of the lower one.
+            Staging& A = staging<0>(n, k);
+            Staging& D = staging<1>(n, n);
+            auto const cij = [&] (Int i, Int j) -> double& { return lower ? c[i + j * ldc] : c[j + i * ldc]; };
+
+            for (Int j = 0; j < k; ++j)
+                for (Int i = 0; i < n; ++i)
+                    A(i, j) = tr ? a[j + i * lda] : a[i + j * lda];
+
+            for (Int j = 0; j < n; ++j)
+                for (Int i = j; i < n; ++i)
+                    D(i, j) = beta == 0. ? 0. : cij(i, j);
+
+            syrkLower(alpha, A, beta, D, D);
+
+            for (Int j = 0; j < n; ++j)
+                for (Int i = j; i < n; ++i)
+                    cij(i, j) = D(i, j);
+
+            return true;
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
+
+    bool tryTrmm(char side, char uplo, char transa, char diag, Int m, Int n,
+        double alpha, double const * a, Int lda, double * b, Int ldb) noexcept
+    {
+        try
+        {
+            bool lower, ta;
+
+            if (!decodeUpLo(uplo, lower) || !decodeTrans(transa, ta) || !withinSizeRange(m, n) || alpha == 0.)
+                return false;
+
+            // BLAST implements left products with upper-triangular and right products with lower-triangular
+            // non-unit matrices, without transposition.
+            bool const left = upper(side) == 'L';
+
+            if ((!left && upper(side) != 'R') || ta || upper(diag) != 'N' || lower == left)
+                return false;
+
+            if (lda < (left ? m : n) || ldb < m)
+                return false;
+
+            CustomMatrix<double const, columnMajor> const A(a, left ? m : n, left ? m : n, lda);
+            CustomMatrix<double const, columnMajor> const B(b, m, n, ldb);
+            Staging& C = staging<0>(m, n);
+
+            if (left)
+                blast::trmm(alpha, A, UpLo::Upper, false, B, C);
+            else
+                blast::trmm(alpha, B, A, UpLo::Lower, false, C);
+
+            for (Int j = 0; j < n; ++j)
+                for (Int i = 0; i < m; ++i)
+                    b[i + j * ldb] = C(i, j);
+
+            return true;
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
+
+    bool tryPotrf(char uplo, Int n, double * a, Int lda) noexcept
+    {
+        try
+        {
+            bool lower;
+
+            if (!decodeUpLo(uplo, lower) || !withinSizeRange(n) || lda < n)
+                return false;
+
+            // potrf() needs padded operands, therefore the referenced triangle of A is copied to the staging buffer.
+            // The upper factor U is the transpose of the lower factor L.
+            Staging& L = staging<0>(n, n);
+            auto const aij = [&] (Int i, Int j) -> double& { return lower ? a[i + j * lda] : a[j + i * lda]; };
+
+            L = 0.;
+            for (Int j = 0; j < n; ++j)
+                for (Int i = j; i < n; ++i)
+                    L(i, j) = aij(i, j);
+
+            blast::potrf(L, L);
+
+            // A is not positive definite (or contains NaNs) if any of the diagonal elements of L is not positive.
+            for (Int j = 0; j < n; ++j)
+                if (!(L(j, j) > 0.))
+                    return false;
+
+            for (Int j = 0; j < n; ++j)
+                for (Int i = j; i < n; ++i)
+                    aij(i, j) = L(i, j);
+
+            return true;
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
+
+    bool tryGetrf(Int m, Int n, double * a, Int lda, Int * ipiv) noexcept
+    {
+        try
+        {
+            if (!withinSizeRange(m, n) || lda < m)
+                return false;
+
+            Staging& LU = staging<0>(m, n);
+            thread_local std::vector<size_t> p;
+            p.resize(std::min(m, n));
+
+            for (Int j = 0; j < n; ++j)
+                for (Int i = 0; i < m; ++i)
+                    LU(i, j) = a[i + j * lda];
+
+            blast::getrf(LU, p.data());
+
+            // Singular matrices are left to LAPACK, which defines the result in this case.
+            for (Int i = 0; i < std::min(m, n); ++i)
+                if (LU(i, i) == 0.)
+                    return false;
+
+            for (Int j = 0; j < n; ++j)
+                for (Int i = 0; i < m; ++i)
+                    a[i + j * lda] = LU(i, j);
+
+            for (Int i = 0; i < std::min(m, n); ++i)
+                ipiv[i] = static_cast<Int>(p[i]) + 1;
+
+            return true;
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
+
+    Int iamax(Int n, double const * x, Int incx) noexcept
+    {
+        if (n < 1 || incx < 1)
+            return 0;
+
+        return static_cast<Int>(blast::iamax(n, DynamicVectorPointer<double const, columnVector, false, false>(x, incx))) + 1;
+    }
+}
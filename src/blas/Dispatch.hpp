@@ -0,0 +1,42 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+/// @brief BLAST implementations behind the BLAS/LAPACK interface
+///
+/// Each function computes the result with BLAST and returns true if the arguments are valid,
+/// the sizes are within the supported range (see @a BLAST_BLAS_MAX_SIZE) and the case is
+/// implemented by BLAST. Otherwise it returns false without touching the output,
+/// and the caller falls through to the secondary BLAS/LAPACK library, which also reports
+/// invalid arguments in the standard way.
+///
+/// Matrices are column-major, with the same argument meaning as in the reference BLAS/LAPACK.
+///
+#pragma once
+
+#include "Blas.hpp"
+
+
+namespace blast :: blas
+{
+    bool tryGemm(char transa, char transb, Int m, Int n, Int k,
+        double alpha, double const * a, Int lda, double const * b, Int ldb, double beta, double * c, Int ldc) noexcept;
+
+    bool tryGemm(char transa, char transb, Int m, Int n, Int k,
+        float alpha, float const * a, Int lda, float const * b, Int ldb, float beta, float * c, Int ldc) noexcept;
+
+    bool trySyrk(char uplo, char trans, Int n, Int k,
+        double alpha, double const * a, Int lda, double beta, double * c, Int ldc) noexcept;
+
+    bool tryTrmm(char side, char uplo, char transa, char diag, Int m, Int n,
+        double alpha, double const * a, Int lda, double * b, Int ldb) noexcept;
+
+    /// @brief Returns false also if A is not positive definite, leaving the factorization and @a info to the fallback.
+    bool tryPotrf(char uplo, Int n, double * a, Int lda) noexcept;
+
+    /// @brief Returns false also if A is singular, leaving the factorization and @a info to the fallback.
+    bool tryGetrf(Int m, Int n, double * a, Int lda, Int * ipiv) noexcept;
+
+    /// @brief Never falls through; returns the 1-based Fortran index.
+    Int iamax(Int n, double const * x, Int incx) noexcept;
+}
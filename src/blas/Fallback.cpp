@@ -0,0 +1,46 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include "Fallback.hpp"
+
+#include <dlfcn.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+
+namespace blast :: blas
+{
+    namespace
+    {
+        void * fallbackLibrary() noexcept
+        {
+            char const * const path = std::getenv("BLAST_BLAS_FALLBACK");
+            return path ? dlopen(path, RTLD_NOW | RTLD_LOCAL) : nullptr;
+        }
+    }
+
+
+    void * fallbackSymbol(char const * name) noexcept
+    {
+        void * symbol = dlsym(RTLD_NEXT, name);
+
+        if (!symbol)
+        {
+            static void * const library = fallbackLibrary();
+
+            if (library)
+                symbol = dlsym(library, name);
+        }
+
+        if (!symbol)
+        {
+            std::fprintf(stderr, "libblast_blas: no secondary implementation of %s found, "
+                "set BLAST_BLAS_FALLBACK to the path of a BLAS/LAPACK library\n", name);
+            std::abort();
+        }
+
+        return symbol;
+    }
+}
@@ -0,0 +1,30 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#pragma once
+
+
+namespace blast :: blas
+{
+    /// @brief Address of a function in the secondary BLAS/LAPACK library.
+    ///
+    /// The function is searched for in the libraries loaded after libblast_blas (which is the case
+    /// when libblast_blas is preloaded or linked before the system BLAS), and then in the library
+    /// named by the @a BLAST_BLAS_FALLBACK environment variable.
+    /// The process is aborted if the function is not found.
+    ///
+    /// @param name symbol name, e.g. "dgemm_"
+    ///
+    void * fallbackSymbol(char const * name) noexcept;
+
+
+    /// @brief Typed wrapper of @a fallbackSymbol()
+    ///
+    /// @tparam F function type
+    template <typename F>
+    inline F * fallback(char const * name) noexcept
+    {
+        return reinterpret_cast<F *>(fallbackSymbol(name));
+    }
+}
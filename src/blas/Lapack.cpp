@@ -0,0 +1,39 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+/// @brief Fortran LAPACK entry points
+#include "Blas.hpp"
+#include "Dispatch.hpp"
+#include "Fallback.hpp"
+
+
+using blast::blas::Int;
+using blast::blas::fallback;
+
+
+extern "C"
+{
+    void dpotrf_(char const * uplo, Int const * n, double * a, Int const * lda, Int * info, std::size_t)
+    {
+        if (blast::blas::tryPotrf(*uplo, *n, a, *lda))
+            *info = 0;
+        else
+        {
+            static auto * const f = fallback<decltype(dpotrf_)>("dpotrf_");
+            f(uplo, n, a, lda, info, 1);
+        }
+    }
+
+
+    void dgetrf_(Int const * m, Int const * n, double * a, Int const * lda, Int * ipiv, Int * info)
+    {
+        if (blast::blas::tryGetrf(*m, *n, a, *lda, ipiv))
+            *info = 0;
+        else
+        {
+            static auto * const f = fallback<decltype(dgetrf_)>("dgetrf_");
+            f(m, n, a, lda, ipiv, info);
+        }
+    }
+}
@@ -0,0 +1,215 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <Blas.hpp>
+
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blast/blaze/Math.hpp>
+
+#include <test/Testing.hpp>
+#include <blast/math/algorithm/Randomize.hpp>
+#include <test/Tolerance.hpp>
+
+#include <utility>
+#include <vector>
+
+
+extern "C" void cblas_dgemm(int order, int transa, int transb, int m, int n, int k,
+    double alpha, double const * a, int lda, double const * b, int ldb, double beta, double * c, int ldc);
+
+
+namespace blast :: testing
+{
+    using Int = blas::Int;
+    using ColumnMajorMatrix = blaze::DynamicMatrix<double, blaze::columnMajor>;
+
+
+    class BlasTest
+    :   public Test
+    {
+    protected:
+        /// @brief Call dgemm_() and compare the result to Blaze
+        static void testDgemm(char transa, char transb, Int m, Int n, Int k, double beta)
+        {
+            bool const ta = transa == 'T', tb = transb == 'T';
+            ColumnMajorMatrix A(ta ? k : m, ta ? m : k), B(tb ? n : k, tb ? k : n), C(m, n);
+            randomize(A);
+            randomize(B);
+            randomize(C);
+
+            ColumnMajorMatrix const opA = ta ? ColumnMajorMatrix(trans(A)) : A;
+            ColumnMajorMatrix const opB = tb ? ColumnMajorMatrix(trans(B)) : B;
+            double const alpha = 0.5;
+            ColumnMajorMatrix const expected = alpha * opA * opB + beta * C;
+
+            Int const lda = A.spacing(), ldb = B.spacing(), ldc = C.spacing();
+            dgemm_(&transa, &transb, &m, &n, &k, &alpha, A.data(), &lda, B.data(), &ldb, &beta, C.data(), &ldc, 1, 1);
+
+            BLAST_EXPECT_APPROX_EQ(C, expected, absTol<double>(), relTol<double>())
+                << "transa=" << transa << ", transb=" << transb;
+        }
+
+
+        /// @brief Random symmetric positive definite matrix
+        static ColumnMajorMatrix spd(size_t n)
+        {
+            ColumnMajorMatrix B(n, n);
+            randomize(B);
+
+            ColumnMajorMatrix A = B * trans(B);
+            for (size_t i = 0; i < n; ++i)
+                A(i, i) += n;
+
+            return A;
+        }
+    };
+
+
+    TEST_F(BlasTest, testDgemm)
+    {
+        for (char transa : {'N', 'T'})
+            for (char transb : {'N', 'T'})
+                for (double beta : {0., 1.5})
+                    testDgemm(transa, transb, 7, 5, 3, beta);
+    }
+
+
+    TEST_F(BlasTest, testDgemmUnpadded)
+    {
+        using UnpaddedMatrix = blaze::CustomMatrix<double, blaze::unaligned, blaze::unpadded, blaze::columnMajor>;
+        Int const m = 7, n = 5, k = 3;
+
+        for (char transa : {'N', 'T'})
+            for (char transb : {'N', 'T'})
+            {
+                // Leading dimensions equal to the number of rows, without padding
+                bool const ta = transa == 'T', tb = transb == 'T';
+                std::vector<double> a(m * k), b(k * n), c(m * n);
+                UnpaddedMatrix A(a.data(), ta ? k : m, ta ? m : k), B(b.data(), tb ? n : k, tb ? k : n), C(c.data(), m, n);
+                randomize(A);
+                randomize(B);
+                randomize(C);
+
+                ColumnMajorMatrix const opA = ta ? ColumnMajorMatrix(trans(A)) : ColumnMajorMatrix(A);
+                ColumnMajorMatrix const opB = tb ? ColumnMajorMatrix(trans(B)) : ColumnMajorMatrix(B);
+                double const alpha = 0.5, beta = 1.5;
+                ColumnMajorMatrix const expected = alpha * opA * opB + beta * C;
+
+                Int const lda = rows(A), ldb = rows(B), ldc = m;
+                dgemm_(&transa, &transb, &m, &n, &k, &alpha, a.data(), &lda, b.data(), &ldb, &beta, c.data(), &ldc, 1, 1);
+
+                BLAST_EXPECT_APPROX_EQ(C, expected, absTol<double>(), relTol<double>())
+                    << "transa=" << transa << ", transb=" << transb;
+            }
+    }
+
+
+    TEST_F(BlasTest, testDgemmFallback)
+    {
+        // Problems larger than BLAST_BLAS_MAX_SIZE are computed by the secondary BLAS
+        testDgemm('N', 'N', BLAST_BLAS_MAX_SIZE + 1, 2, 3, 1.);
+    }
+
+
+    TEST_F(BlasTest, testCblasDgemmRowMajor)
+    {
+        Int const m = 4, n = 6, k = 5;
+        blaze::DynamicMatrix<double, blaze::rowMajor> A(m, k), B(k, n), C(m, n);
+        randomize(A);
+        randomize(B);
+        randomize(C);
+
+        blaze::DynamicMatrix<double, blaze::rowMajor> const expected = 2. * A * B - C;
+
+        cblas_dgemm(101, 111, 111, m, n, k, 2., A.data(), A.spacing(), B.data(), B.spacing(), -1., C.data(), C.spacing());
+
+        BLAST_EXPECT_APPROX_EQ(C, expected, absTol<double>(), relTol<double>());
+    }
+
+
+    TEST_F(BlasTest, testDpotrf)
+    {
+        for (char uplo : {'L', 'U'})
+        {
+            Int const n = 6;
+            ColumnMajorMatrix const A = spd(n);
+            ColumnMajorMatrix F = A;
+            Int const lda = F.spacing();
+            Int info = -1;
+
+            dpotrf_(&uplo, &n, F.data(), &lda, &info, 1);
+            ASSERT_EQ(info, 0);
+
+            ColumnMajorMatrix L(n, n, 0.);
+            for (Int j = 0; j < n; ++j)
+                for (Int i = j; i < n; ++i)
+                    L(i, j) = uplo == 'L' ? F(i, j) : F(j, i);
+
+            BLAST_EXPECT_APPROX_EQ(ColumnMajorMatrix(L * trans(L)), A, absTol<double>(), relTol<double>()) << "uplo=" << uplo;
+        }
+    }
+
+
+    TEST_F(BlasTest, testDpotrfNotPositiveDefinite)
+    {
+        // Falls through to LAPACK, which reports the order of the failing leading minor
+        Int const n = 3;
+        ColumnMajorMatrix A {{1., 0., 0.}, {0., -1., 0.}, {0., 0., 1.}};
+        Int const lda = A.spacing();
+        Int info = 0;
+        char const uplo = 'L';
+
+        dpotrf_(&uplo, &n, A.data(), &lda, &info, 1);
+        EXPECT_EQ(info, 2);
+    }
+
+
+    TEST_F(BlasTest, testDgetrf)
+    {
+        Int const m = 7, n = 5;
+        ColumnMajorMatrix A(m, n);
+        randomize(A);
+
+        ColumnMajorMatrix LU = A;
+        Int const lda = LU.spacing();
+        std::vector<Int> ipiv(n);
+        Int info = -1;
+
+        dgetrf_(&m, &n, LU.data(), &lda, ipiv.data(), &info);
+        ASSERT_EQ(info, 0);
+
+        ColumnMajorMatrix L(m, n, 0.), U(n, n, 0.);
+        for (Int i = 0; i < m; ++i)
+            for (Int j = 0; j < n; ++j)
+                if (i > j)
+                    L(i, j) = LU(i, j);
+                else
+                {
+                    if (i == j)
+                        L(i, j) = 1.;
+
+                    U(i, j) = LU(i, j);
+                }
+
+        // P*A
+        ColumnMajorMatrix PA = A;
+        for (Int i = 0; i < n; ++i)
+            for (Int j = 0; j < n; ++j)
+                std::swap(PA(i, j), PA(ipiv[i] - 1, j));
+
+        BLAST_EXPECT_APPROX_EQ(ColumnMajorMatrix(L * U), PA, absTol<double>(), relTol<double>());
+    }
+
+
+    TEST_F(BlasTest, testIdamax)
+    {
+        blaze::DynamicVector<double> x {1., -2., 0.5, -7., 3., 7.};
+        Int const n = 3, incx = 2;
+
+        // Strided elements are 1., 0.5, 3.
+        EXPECT_EQ(idamax_(&n, x.data(), &incx), 3);
+    }
+}
@@ -0,0 +1,93 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <blaze/Math.h>
+
+#include <test/Testing.hpp>
+#include <blast/math/algorithm/Randomize.hpp>
+#include <blast/util/Profile.hpp>
+#include <test/Tolerance.hpp>
+
+#include <type_traits>
+
+
+namespace blast :: testing
+{
+    template <typename T>
+    class BlazeBackendTest
+    :   public Test
+    {
+    protected:
+        /// @brief Number of calls of a BLAST routine since the start of the test.
+        std::uint64_t calls(profile::Routine r) const
+        {
+            return (profile::snapshot() - start_)[r].calls;
+        }
+
+
+    private:
+        profile::Snapshot const start_ = profile::snapshot();
+    };
+
+
+    using BlazeBackendTestTypes = Types<double, float>;
+    TYPED_TEST_SUITE(BlazeBackendTest, BlazeBackendTestTypes);
+
+
+    TYPED_TEST(BlazeBackendTest, testProduct)
+    {
+        using Real = TypeParam;
+        size_t const m = 7, n = 5, k = 3;
+
+        blaze::DynamicMatrix<Real, blaze::columnMajor> A(k, m), B(k, n), C(m, n), D(m, n);
+        randomize(A);
+        randomize(B);
+        randomize(C);
+
+        D = trans(A) * B + C;
+        EXPECT_EQ(this->calls(profile::Routine::gemm), 1u);
+
+        blaze::DynamicMatrix<Real, blaze::columnMajor> expected = C;
+        for (size_t j = 0; j < n; ++j)
+            for (size_t i = 0; i < m; ++i)
+                for (size_t l = 0; l < k; ++l)
+                    expected(i, j) += A(l, i) * B(l, j);
+
+        BLAST_EXPECT_APPROX_EQ(D, expected, absTol<Real>(), relTol<Real>());
+    }
+
+
+    TYPED_TEST(BlazeBackendTest, testLlh)
+    {
+        using Real = TypeParam;
+        size_t const n = 6;
+
+        blaze::DynamicMatrix<Real, blaze::columnMajor> A(n, n), L(n, n);
+        makePositiveDefinite(A);
+
+        llh(A, L);
+
+        // There is no spotrf_ in libblast_blas, the float factorization is computed by LAPACK
+        EXPECT_EQ(this->calls(profile::Routine::potrf), std::is_same_v<Real, double> ? 1u : 0u);
+
+        BLAST_EXPECT_APPROX_EQ(evaluate(L * trans(L)), A, absTol<Real>(), relTol<Real>());
+    }
+
+
+    TYPED_TEST(BlazeBackendTest, testLu)
+    {
+        using Real = TypeParam;
+        size_t const n = 6;
+
+        blaze::DynamicMatrix<Real, blaze::columnMajor> A(n, n), L(n, n), U(n, n), P(n, n);
+        randomize(A);
+
+        lu(A, L, U, P);
+
+        // There is no sgetrf_ in libblast_blas, the float factorization is computed by LAPACK
+        EXPECT_EQ(this->calls(profile::Routine::getrf), std::is_same_v<Real, double> ? 1u : 0u);
+
+        BLAST_EXPECT_APPROX_EQ(evaluate(P * L * U), A, absTol<Real>(), relTol<Real>());
+    }
+}
@@ -0,0 +1,98 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <blasfeo/Blasfeo.hpp>
+#include <blasfeo/BlastInterop.hpp>
+
+#include <blast/math/DynamicPanelMatrix.hpp>
+#include <blast/math/algorithm/Gemm.hpp>
+#include <blast/math/algorithm/MakePositiveDefinite.hpp>
+
+#include <test/Testing.hpp>
+
+
+namespace blasfeo :: testing
+{
+    TEST(BlastInteropTest, testPanelMatrix)
+    {
+        size_t const m = 7, n = 5;
+
+        blaze::DynamicMatrix<double, blaze::columnMajor> blaze_A(m, n);
+        randomize(blaze_A);
+        blasfeo::DynamicMatrix<double> blasfeo_A(blaze_A);
+
+        auto A = panelMatrix(blasfeo_A);
+        ASSERT_EQ(rows(A), m);
+        ASSERT_EQ(columns(A), n);
+        EXPECT_EQ(A.data(), blasfeo_A.pA);
+
+        for (size_t i = 0; i < m; ++i)
+            for (size_t j = 0; j < n; ++j)
+                EXPECT_EQ(A(i, j), blaze_A(i, j)) << "element mismatch at (" << i << ", " << j << ")";
+
+        // Writes through the view are visible in the BLASFEO matrix
+        A(5, 3) = 42.;
+        EXPECT_EQ(element(blasfeo_A, 5, 3), 42.);
+
+        // Pointers address the same elements
+        EXPECT_EQ(*ptr<false>(blasfeo_A, 5, 3).get(), 42.);
+        EXPECT_EQ(*ptr<true>(blasfeo_A, 4, 2).get(), blaze_A(4, 2));
+    }
+
+
+    TEST(BlastInteropTest, testGemmInPlace)
+    {
+        size_t const m = 9, n = 6, k = 5;
+
+        blaze::DynamicMatrix<double, blaze::columnMajor> blaze_A(m, k), blaze_B(n, k), blaze_C(m, n), blaze_D(m, n);
+        randomize(blaze_A);
+        randomize(blaze_B);
+        randomize(blaze_C);
+        blaze_D = blaze_C + blaze_A * trans(blaze_B);
+
+        blasfeo::DynamicMatrix<double> blasfeo_A(blaze_A), blasfeo_B(blaze_B), blasfeo_C(blaze_C), blasfeo_D(m, n);
+
+        // Run the BLAST kernel directly on the BLASFEO memory
+        auto A = panelMatrix(blasfeo_A);
+        auto B = panelMatrix(blasfeo_B);
+        auto C = panelMatrix(blasfeo_C);
+        auto D = panelMatrix(blasfeo_D);
+        blast::gemm(A, trans(B), C, D);
+
+        blaze::DynamicMatrix<double, blaze::columnMajor> blaze_blasfeo_D;
+        blasfeo_D.unpack(blaze_blasfeo_D);
+
+        BLAST_EXPECT_APPROX_EQ(blaze_blasfeo_D, blaze_D, 1e-10, 1e-10);
+    }
+
+
+    TEST(BlastInteropTest, testPanelMatrixView)
+    {
+        size_t const m = 11;
+
+        blast::DynamicPanelMatrix<double> C(m, m), D(m, m);
+        blast::makePositiveDefinite(C);
+
+        // Run the BLASFEO routine directly on the BLAST memory
+        PanelMatrixView<double> blasfeo_C(C), blasfeo_D(D);
+        EXPECT_EQ(blasfeo_C.pA, C.data());
+        EXPECT_EQ(blasfeo_C.cn * PanelSize_v<double>, C.spacing());
+
+        for (size_t i = 0; i < m; ++i)
+            for (size_t j = 0; j < m; ++j)
+                EXPECT_EQ(element(blasfeo_C, i, j), C(i, j)) << "element mismatch at (" << i << ", " << j << ")";
+
+        potrf(m, blasfeo_C, 0, 0, blasfeo_D, 0, 0);
+
+        blaze::DynamicMatrix<double, blaze::columnMajor> blaze_C(m, m), blaze_D(m, m);
+        for (size_t i = 0; i < m; ++i)
+            for (size_t j = 0; j < m; ++j)
+            {
+                blaze_C(i, j) = C(i, j);
+                blaze_D(i, j) = i >= j ? D(i, j) : 0.;
+            }
+
+        BLAST_EXPECT_APPROX_EQ(blaze_D * trans(blaze_D), blaze_C, 1e-10, 1e-10);
+    }
+}
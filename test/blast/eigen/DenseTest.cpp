@@ -0,0 +1,129 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <blast/eigen/Dense.hpp>
+#include <blast/math/dense/Potrf.hpp>
+#include <blast/math/dense/Syrk.hpp>
+#include <blast/math/algorithm/Gemm.hpp>
+
+#include <test/Testing.hpp>
+#include <test/Tolerance.hpp>
+
+#include <Eigen/Dense>
+
+#include <stdexcept>
+#include <type_traits>
+
+
+namespace blast :: testing
+{
+    TEST(EigenDenseTest, testDynamic)
+    {
+        Eigen::MatrixXd x = Eigen::MatrixXd::Random(5, 7);
+        auto A = asMatrix(x);
+
+        static_assert(std::is_same_v<decltype(A), CustomMatrix<double, columnMajor, false, false>>);
+        ASSERT_EQ(rows(A), 5);
+        ASSERT_EQ(columns(A), 7);
+        EXPECT_EQ(spacing(A), 5);
+
+        A(3, 4) = 42.;
+        EXPECT_EQ(x(3, 4), 42.);
+        EXPECT_EQ(ptr<false>(x, 3, 4).get(), &x(3, 4));
+
+        // Read-only objects give read-only views
+        Eigen::MatrixXd const& cx = x;
+        static_assert(std::is_same_v<ElementType_t<decltype(asMatrix(cx))>, double const>);
+    }
+
+
+    TEST(EigenDenseTest, testStatic)
+    {
+        Eigen::Matrix<double, 8, 6, Eigen::RowMajor> x = Eigen::Matrix<double, 8, 6, Eigen::RowMajor>::Random();
+        auto A = asMatrix(x);
+
+        static_assert(IsStatic_v<decltype(A)>);
+        static_assert(StorageOrder_v<decltype(A)> == rowMajor);
+        static_assert(Spacing_v<decltype(A)> == 6);
+        EXPECT_EQ(A(7, 2), x(7, 2));
+
+        // Blocks of fixed-size matrices keep the static outer stride
+        auto B = asMatrix(x.block<2, 3>(1, 2));
+        static_assert(IsStatic_v<decltype(B)>);
+        static_assert(Spacing_v<decltype(B)> == 6);
+        EXPECT_EQ(B(1, 1), x(2, 3));
+
+        auto p = ptr<false>(x, 7, 2);
+        static_assert(std::is_same_v<decltype(p), StaticMatrixPointer<double, 6, rowMajor, false, false>>);
+        EXPECT_EQ(p.get(), &x(7, 2));
+    }
+
+
+    TEST(EigenDenseTest, testInvalidArguments)
+    {
+        Eigen::MatrixXd x(5, 3);
+
+        EXPECT_THROW(asMatrix<false, true>(x), std::invalid_argument);
+        EXPECT_THROW(asMatrix<true, false>(Eigen::Map<Eigen::MatrixXd>(x.data() + 1, 4, 2)), std::invalid_argument);
+    }
+
+
+    TEST(EigenDenseTest, testGemm)
+    {
+        for (Eigen::Index m = 1; m <= 20; m += 1)
+            for (Eigen::Index n = 1; n <= 20; n += 1)
+                for (Eigen::Index k = 1; k <= 20; k += 3)
+                {
+                    Eigen::MatrixXd const a = Eigen::MatrixXd::Random(m, k);
+                    Eigen::MatrixXd const b = Eigen::MatrixXd::Random(n, k);
+                    Eigen::MatrixXd const c = Eigen::MatrixXd::Random(m, n);
+                    Eigen::MatrixXd d(m, n);
+
+                    // Default views are unpadded, and m is not always a multiple of the SIMD size
+                    auto D = asMatrix(d);
+                    gemm(0.5, asMatrix(a), trans(asMatrix(b)), 2., asMatrix(c), D);
+
+                    Eigen::MatrixXd const d_ref = 0.5 * a * b.transpose() + 2. * c;
+                    EXPECT_TRUE(d.isApprox(d_ref, relTol<double>()))
+                        << "gemm error at size m,n,k=" << m << "," << n << "," << k;
+                }
+    }
+
+
+    TEST(EigenDenseTest, testSyrkLower)
+    {
+        for (Eigen::Index m = 1; m <= 20; m += 1)
+            for (Eigen::Index k = 1; k <= 20; k += 3)
+            {
+                Eigen::MatrixXd const a = Eigen::MatrixXd::Random(m, k);
+                Eigen::MatrixXd const c = Eigen::MatrixXd::Random(m, m);
+                Eigen::MatrixXd d = Eigen::MatrixXd::Zero(m, m);
+
+                auto D = asMatrix(d);
+                syrkLower(0.5, asMatrix(a), 2., asMatrix(c), D);
+
+                Eigen::MatrixXd const d_ref = 0.5 * a * a.transpose() + 2. * c;
+                EXPECT_TRUE(d.triangularView<Eigen::Lower>().toDenseMatrix().isApprox(
+                    d_ref.triangularView<Eigen::Lower>().toDenseMatrix(), relTol<double>()))
+                    << "syrkLower error at size m,k=" << m << "," << k;
+            }
+    }
+
+
+    TEST(EigenDenseTest, testPotrfStatic)
+    {
+        using Matrix = Eigen::Matrix<double, 8, 8>;
+
+        Matrix a = Matrix::Random();
+        a = a * a.transpose() + 8. * Matrix::Identity();
+        Matrix l = Matrix::Zero();
+
+        // A column-major 8x8 matrix is padded for any SIMD size up to 8
+        auto L = asMatrix<false, true>(l);
+        potrf(asMatrix<false, true>(a), L);
+
+        Matrix const l_ref = a.llt().matrixL();
+        EXPECT_TRUE(l.triangularView<Eigen::Lower>().toDenseMatrix().isApprox(l_ref, relTol<double>()));
+    }
+}
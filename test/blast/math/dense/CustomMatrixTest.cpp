@@ -0,0 +1,375 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#define BLAST_USER_ASSERTION 1
+
+#include <blast/math/dense/CustomMatrix.hpp>
+#include <blast/math/dense/DynamicMatrix.hpp>
+#include <blast/math/dense/Potrf.hpp>
+#include <blast/math/dense/Syrk.hpp>
+#include <blast/math/algorithm/Gemm.hpp>
+#include <blast/math/algorithm/Trmm.hpp>
+#include <blast/math/algorithm/MakePositiveDefinite.hpp>
+#include <blast/math/algorithm/Randomize.hpp>
+#include <blast/math/reference/Gemm.hpp>
+#include <blast/math/reference/Trmm.hpp>
+#include <blast/system/CacheLine.hpp>
+
+#include <test/Testing.hpp>
+#include <test/Tolerance.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#   include <sys/mman.h>
+#   include <unistd.h>
+#endif
+
+
+namespace blast :: testing
+{
+    template <typename T>
+    class CustomMatrixTest
+    :   public Test
+    {
+    protected:
+        using Real = T;
+
+
+#if defined(__unix__) || defined(__APPLE__)
+        ~CustomMatrixTest()
+        {
+            for (auto const& [p, size] : mappings_)
+                munmap(p, size);
+        }
+
+
+        /// @brief Allocate @a n elements which end exactly at the start of an inaccessible page
+        Real * allocateGuarded(size_t n)
+        {
+            size_t const page = sysconf(_SC_PAGESIZE);
+            size_t const bytes = (n * sizeof(Real) + page - 1) / page * page;
+
+            void * const p = mmap(nullptr, bytes + page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED)
+                throw std::bad_alloc {};
+
+            mappings_.emplace_back(p, bytes + page);
+            if (mprotect(static_cast<char *>(p) + bytes, page, PROT_NONE) != 0)
+                throw std::runtime_error {"mprotect() failed"};
+
+            return reinterpret_cast<Real *>(static_cast<char *>(p) + bytes) - n;
+        }
+#endif
+
+
+        /// @brief Allocate zero-initialized elements from the arena
+        Real * allocate(size_t n)
+        {
+            Real * const p = static_cast<Real *>(arena_.allocate(n * sizeof(Real), CACHE_LINE_SIZE));
+            std::fill_n(p, n, Real {});
+            return p;
+        }
+
+
+        template <bool AF, bool PF>
+        void testGemmImpl()
+        {
+            for (size_t m = 1; m <= 20; m += 1)
+                for (size_t n = 1; n <= 20; n += 1)
+                    for (size_t k = 1; k <= 20; k += 3)
+                    {
+                        arena_.release();
+
+                        // Unaligned and unpadded matrices get an odd spacing
+                        size_t const sa = AF || PF ? nextMultiple(m, SimdSize_v<Real>) : m + 1;
+                        size_t const sb = AF || PF ? nextMultiple(k, SimdSize_v<Real>) : k + 1;
+
+                        CustomMatrix<Real, columnMajor, AF, PF> A(allocate(sa * k), m, k, sa);
+                        CustomMatrix<Real, columnMajor, AF, PF> B(allocate(sb * n), k, n, sb);
+                        CustomMatrix<Real, columnMajor, AF, PF> C(allocate(sa * n), m, n, sa);
+                        CustomMatrix<Real, columnMajor, AF, PF> D(allocate(sa * n), m, n, sa);
+                        randomize(A);
+                        randomize(B);
+                        randomize(C);
+
+                        Real alpha {}, beta {};
+                        randomize(alpha);
+                        randomize(beta);
+
+                        gemm(alpha, A, B, beta, C, D);
+
+                        DynamicMatrix<Real, columnMajor> D_ref(m, n);
+                        reference::gemm(alpha, A, B, beta, C, D_ref);
+
+                        BLAST_ASSERT_APPROX_EQ(D, D_ref, absTol<Real>(), relTol<Real>())
+                            << "gemm error at size m,n,k=" << m << "," << n << "," << k;
+                    }
+        }
+
+
+        template <bool AF, bool PF>
+        void testSyrkLowerImpl()
+        {
+            for (size_t m = 1; m <= 20; m += 1)
+                for (size_t k = 1; k <= 20; k += 3)
+                {
+                    arena_.release();
+
+                    // Unaligned and unpadded matrices get an odd spacing
+                    size_t const s = AF || PF ? nextMultiple(m, SimdSize_v<Real>) : m + 1;
+
+                    CustomMatrix<Real, columnMajor, AF, PF> A(allocate(s * k), m, k, s);
+                    CustomMatrix<Real, columnMajor, AF, PF> C(allocate(s * m), m, m, s);
+                    CustomMatrix<Real, columnMajor, AF, PF> D(allocate(s * m), m, m, s);
+                    randomize(A);
+                    randomize(C);
+
+                    syrkLower(Real(1), A, Real(1), C, D);
+
+                    DynamicMatrix<Real, columnMajor> D_ref(m, m);
+                    reference::gemm(Real(1), A, trans(A), Real(1), C, D_ref);
+
+                    for (size_t j = 0; j < m; ++j)
+                        for (size_t i = j; i < m; ++i)
+                            ASSERT_NEAR(D(i, j), D_ref(i, j), absTol<Real>() + relTol<Real>() * std::abs(D_ref(i, j)))
+                                << "syrkLower error at size m,k=" << m << "," << k;
+                }
+        }
+
+
+        template <bool AF, bool PF>
+        void testPotrfImpl()
+        {
+            for (size_t m = 1; m <= 30; ++m)
+            {
+                arena_.release();
+                size_t const s = nextMultiple(m, SimdSize_v<Real>);
+
+                CustomMatrix<Real, columnMajor, AF, PF> A(allocate(s * m), m, m, s), L(allocate(s * m), m, m, s);
+                makePositiveDefinite(A);
+
+                potrf(A, L);
+
+                // Check A == L * trans(L)
+                DynamicMatrix<Real, columnMajor> A1(m, m);
+                for (size_t i = 0; i < m; ++i)
+                    for (size_t j = i + 1; j < m; ++j)
+                        L(i, j) = Real {};
+
+                reference::gemm(Real(1), L, trans(L), Real(0), A1, A1);
+
+                BLAST_EXPECT_APPROX_EQ(A1, A, absTol<Real>(), relTol<Real>()) << "potrf error for size " << m;
+            }
+        }
+
+
+    private:
+        std::pmr::monotonic_buffer_resource arena_;
+
+#if defined(__unix__) || defined(__APPLE__)
+        std::vector<std::pair<void *, size_t>> mappings_;
+#endif
+    };
+
+
+    TYPED_TEST_SUITE_P(CustomMatrixTest);
+
+
+    TYPED_TEST_P(CustomMatrixTest, testElementAccess)
+    {
+        using Real = TypeParam;
+        Real v[3 * 5] {};
+
+        CustomMatrix<Real, rowMajor> A(v, 3, 4, 5);
+        EXPECT_EQ(rows(A), 3);
+        EXPECT_EQ(columns(A), 4);
+        EXPECT_EQ(spacing(A), 5);
+        EXPECT_EQ(data(A), v);
+
+        A(2, 1) = Real(1);
+        EXPECT_EQ(v[2 * 5 + 1], Real(1));
+
+        // A copy refers to the same elements
+        CustomMatrix<Real, rowMajor> B = A;
+        B(0, 3) = Real(2);
+        EXPECT_EQ(A(0, 3), Real(2));
+    }
+
+
+    TYPED_TEST_P(CustomMatrixTest, testCopyAssignment)
+    {
+        using Real = TypeParam;
+        Real u[2 * 3] {}, v[2 * 3] {}, w[3 * 3] {};
+
+        CustomMatrix<Real, columnMajor> A(u, 2, 3, 2);
+        CustomMatrix<Real, columnMajor> B(v, 2, 3, 2);
+        randomize(A);
+
+        // Assignment copies the elements and keeps referring to the same memory
+        B = A;
+        EXPECT_EQ(data(B), v);
+        EXPECT_EQ(B, A);
+
+        B(1, 2) = Real(3);
+        EXPECT_NE(A(1, 2), Real(3));
+
+        CustomMatrix<Real, columnMajor> C(w, 3, 3, 3);
+        EXPECT_THROW(C = A, std::invalid_argument);
+    }
+
+
+    TYPED_TEST_P(CustomMatrixTest, testInvalidArguments)
+    {
+        using Real = TypeParam;
+        size_t constexpr SS = SimdSize_v<Real>;
+        alignas(CACHE_LINE_SIZE) Real v[4 * SS * 4] {};
+
+        EXPECT_THROW((CustomMatrix<Real, columnMajor>(v, 5, 2, 4)), std::invalid_argument);
+        EXPECT_THROW((CustomMatrix<Real, columnMajor, true, true>(v + 1, SS, 2, SS)), std::invalid_argument);
+        EXPECT_THROW((CustomMatrix<Real, columnMajor, true, true>(v, SS, 2, SS + 1)), std::invalid_argument);
+        EXPECT_NO_THROW((CustomMatrix<Real, columnMajor, false, false>(v + 1, SS, 2, SS + 1)));
+    }
+
+
+    TYPED_TEST_P(CustomMatrixTest, testGemmAlignedPadded)
+    {
+        this->template testGemmImpl<true, true>();
+    }
+
+
+    TYPED_TEST_P(CustomMatrixTest, testGemmUnalignedUnpadded)
+    {
+        this->template testGemmImpl<false, false>();
+    }
+
+
+#if defined(__unix__) || defined(__APPLE__)
+    /// @brief gemm() on unpadded matrices must not access memory past their last element
+    TYPED_TEST_P(CustomMatrixTest, testGemmUnpaddedGuardPage)
+    {
+        using Real = TypeParam;
+        size_t constexpr SS = SimdSize_v<Real>;
+        size_t const n = 5, k = 3;
+
+        for (size_t m = 1; m <= 4 * SS + 1; ++m)
+        {
+            if (m % SS == 0)
+                continue;
+
+            CustomMatrix<Real, columnMajor> A(this->allocateGuarded(m * k), m, k, m);
+            CustomMatrix<Real, columnMajor> B(this->allocateGuarded(k * n), k, n, k);
+            CustomMatrix<Real, columnMajor> C(this->allocateGuarded(m * n), m, n, m);
+            CustomMatrix<Real, columnMajor> D(this->allocateGuarded(m * n), m, n, m);
+            randomize(A);
+            randomize(B);
+            randomize(C);
+
+            gemm(Real(1), A, B, Real(1), C, D);
+
+            DynamicMatrix<Real, columnMajor> D_ref(m, n);
+            reference::gemm(Real(1), A, B, Real(1), C, D_ref);
+
+            BLAST_EXPECT_APPROX_EQ(D, D_ref, absTol<Real>(), relTol<Real>()) << "gemm error at m=" << m;
+        }
+    }
+
+
+    /// @brief trmm() on unpadded matrices must not access memory past their last element
+    TYPED_TEST_P(CustomMatrixTest, testTrmmUnpaddedGuardPage)
+    {
+        using Real = TypeParam;
+        size_t constexpr SS = SimdSize_v<Real>;
+        size_t const n = 5;
+
+        for (size_t m = 1; m <= 4 * SS + 1; ++m)
+        {
+            if (m % SS == 0)
+                continue;
+
+            // C = A * B; A upper-triangular
+            {
+                CustomMatrix<Real, columnMajor> A(this->allocateGuarded(m * m), m, m, m);
+                CustomMatrix<Real, columnMajor> B(this->allocateGuarded(m * n), m, n, m);
+                CustomMatrix<Real, columnMajor> C(this->allocateGuarded(m * n), m, n, m);
+                randomize(A);
+                randomize(B);
+
+                trmm(Real(1), A, UpLo::Upper, false, B, C);
+
+                DynamicMatrix<Real, columnMajor> C_ref(m, n);
+                reference::trmm(Real(1), A, UpLo::Upper, false, B, C_ref);
+
+                BLAST_EXPECT_APPROX_EQ(C, C_ref, absTol<Real>(), relTol<Real>()) << "left trmm error at m=" << m;
+            }
+
+            // C = B * A; A lower-triangular
+            {
+                CustomMatrix<Real, columnMajor> A(this->allocateGuarded(n * n), n, n, n);
+                CustomMatrix<Real, columnMajor> B(this->allocateGuarded(m * n), m, n, m);
+                CustomMatrix<Real, columnMajor> C(this->allocateGuarded(m * n), m, n, m);
+                randomize(A);
+                randomize(B);
+
+                trmm(Real(1), B, A, UpLo::Lower, false, C);
+
+                DynamicMatrix<Real, columnMajor> C_ref(m, n);
+                reference::trmm(Real(1), B, A, UpLo::Lower, false, C_ref);
+
+                BLAST_EXPECT_APPROX_EQ(C, C_ref, absTol<Real>(), relTol<Real>()) << "right trmm error at m=" << m;
+            }
+        }
+    }
+#endif
+
+
+    TYPED_TEST_P(CustomMatrixTest, testSyrkLowerAlignedPadded)
+    {
+        this->template testSyrkLowerImpl<true, true>();
+    }
+
+
+    TYPED_TEST_P(CustomMatrixTest, testSyrkLowerUnalignedUnpadded)
+    {
+        this->template testSyrkLowerImpl<false, false>();
+    }
+
+
+    TYPED_TEST_P(CustomMatrixTest, testPotrfAlignedPadded)
+    {
+        this->template testPotrfImpl<true, true>();
+    }
+
+
+    TYPED_TEST_P(CustomMatrixTest, testPotrfUnalignedPadded)
+    {
+        this->template testPotrfImpl<false, true>();
+    }
+
+
+    REGISTER_TYPED_TEST_SUITE_P(CustomMatrixTest
+        , testElementAccess
+        , testCopyAssignment
+        , testInvalidArguments
+        , testGemmAlignedPadded
+        , testGemmUnalignedUnpadded
+#if defined(__unix__) || defined(__APPLE__)
+        , testGemmUnpaddedGuardPage
+        , testTrmmUnpaddedGuardPage
+#endif
+        , testSyrkLowerAlignedPadded
+        , testSyrkLowerUnalignedUnpadded
+        , testPotrfAlignedPadded
+        , testPotrfUnalignedPadded
+    );
+
+
+    INSTANTIATE_TYPED_TEST_SUITE_P(double, CustomMatrixTest, double);
+}
@@ -0,0 +1,166 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <blast/math/dense/DynamicMatrix.hpp>
+#include <blast/math/algorithm/Randomize.hpp>
+#include <blast/math/simd/IsSimdAligned.hpp>
+
+#include <test/Testing.hpp>
+
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace blast :: testing
+{
+    TEST(DynamicMatrixTest, testNothrowMove)
+    {
+        EXPECT_TRUE(std::is_nothrow_move_constructible_v<DynamicMatrix<double>>);
+        EXPECT_TRUE(std::is_nothrow_move_assignable_v<DynamicMatrix<double>>);
+    }
+
+
+    TEST(DynamicMatrixTest, testCopy)
+    {
+        size_t constexpr M = 5;
+        size_t constexpr N = 7;
+
+        DynamicMatrix<double> A(M, N);
+        randomize(A);
+
+        DynamicMatrix<double> B(A);
+        ASSERT_EQ(rows(B), M);
+        ASSERT_EQ(columns(B), N);
+        EXPECT_NE(data(B), data(A));
+
+        DynamicMatrix<double> C(2, 3);
+        C = A;
+        ASSERT_EQ(rows(C), M);
+        ASSERT_EQ(columns(C), N);
+
+        for (size_t i = 0; i < M; ++i)
+            for (size_t j = 0; j < N; ++j)
+            {
+                EXPECT_EQ(B(i, j), A(i, j)) << "element mismatch at (" << i << ", " << j << ")";
+                EXPECT_EQ(C(i, j), A(i, j)) << "element mismatch at (" << i << ", " << j << ")";
+            }
+    }
+
+
+    TEST(DynamicMatrixTest, testMove)
+    {
+        size_t constexpr M = 5;
+        size_t constexpr N = 7;
+
+        DynamicMatrix<double, rowMajor> A(M, N);
+        randomize(A);
+        DynamicMatrix<double, rowMajor> const A_ref(A);
+        double const * const p = data(A);
+
+        DynamicMatrix<double, rowMajor> B(std::move(A));
+        EXPECT_EQ(data(B), p);
+        EXPECT_EQ(rows(A), 0);
+        EXPECT_EQ(columns(A), 0);
+
+        DynamicMatrix<double, rowMajor> C(2, 3);
+        C = std::move(B);
+        EXPECT_EQ(data(C), p);
+        ASSERT_EQ(rows(C), M);
+        ASSERT_EQ(columns(C), N);
+
+        for (size_t i = 0; i < M; ++i)
+            for (size_t j = 0; j < N; ++j)
+                EXPECT_EQ(C(i, j), A_ref(i, j)) << "element mismatch at (" << i << ", " << j << ")";
+    }
+
+
+    TEST(DynamicMatrixTest, testVector)
+    {
+        std::vector<DynamicMatrix<double>> v;
+        for (size_t k = 1; k <= 10; ++k)
+        {
+            v.emplace_back(k, k + 1);
+            v.back() = double(k);
+        }
+
+        for (size_t k = 1; k <= 10; ++k)
+        {
+            ASSERT_EQ(rows(v[k - 1]), k);
+            EXPECT_EQ(v[k - 1](k - 1, k), double(k));
+        }
+    }
+
+
+    TEST(DynamicMatrixTest, testMemoryResource)
+    {
+        alignas(CACHE_LINE_SIZE) std::byte buffer[4096];
+        std::pmr::monotonic_buffer_resource arena {buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+
+        DynamicMatrix<double> A(5, 7, &arena);
+        EXPECT_EQ(A.resource(), &arena);
+        EXPECT_GE(static_cast<void *>(data(A)), static_cast<void *>(buffer));
+        EXPECT_LT(static_cast<void *>(data(A)), static_cast<void *>(buffer + sizeof(buffer)));
+        EXPECT_TRUE(isSimdAligned(data(A)));
+
+        // Padding is initialized to 0
+        for (size_t i = 0; i < spacing(A) * columns(A); ++i)
+            EXPECT_EQ(data(A)[i], 0.);
+
+        // Copy uses the default resource unless specified otherwise
+        DynamicMatrix<double> B(A);
+        EXPECT_EQ(B.resource(), std::pmr::get_default_resource());
+
+        DynamicMatrix<double> C(A, &arena);
+        EXPECT_EQ(C.resource(), &arena);
+
+        // Move propagates the resource
+        DynamicMatrix<double> D(std::move(C));
+        EXPECT_EQ(D.resource(), &arena);
+    }
+
+
+    TEST(DynamicMatrixTest, testUninitialized)
+    {
+        for (size_t m = 1; m <= 10; ++m)
+            for (size_t n = 1; n <= 10; ++n)
+            {
+                // Fill the memory that is likely to be reused by the next allocation with non-zeros
+                DynamicMatrix<double>(m, n) = 1.;
+
+                DynamicMatrix<double> A(uninitialized, m, n);
+                ASSERT_EQ(rows(A), m);
+                ASSERT_EQ(columns(A), n);
+
+                for (size_t j = 0; j < n; ++j)
+                    for (size_t i = m; i < spacing(A); ++i)
+                        EXPECT_EQ(data(A)[i + spacing(A) * j], 0.) << "nonzero padding at (" << i << ", " << j << ")";
+            }
+    }
+
+
+    TEST(DynamicMatrixTest, testSpacingPolicy)
+    {
+        EXPECT_EQ(spacing(DynamicMatrix<double>(5, 3, SpacingPolicy::none)), nextMultiple(5, SimdSize_v<double>));
+        EXPECT_EQ(spacing(DynamicMatrix<double>(512, 3, SpacingPolicy::none)), 512);
+        EXPECT_EQ(spacing(DynamicMatrix<double, rowMajor>(3, 1024, SpacingPolicy::none)), 1024);
+
+        // The default policy does not change the spacing
+        EXPECT_EQ(spacing(DynamicMatrix<double>(512, 3)), 512);
+
+        // Spacings which are not multiples of the aliasing stride are not changed
+        EXPECT_EQ(spacing(DynamicMatrix<double>(5, 3, SpacingPolicy::avoidAliasing)), nextMultiple(5, SimdSize_v<double>));
+        EXPECT_EQ(spacing(DynamicMatrix<double>(200, 3, SpacingPolicy::avoidAliasing)), 200);
+        EXPECT_EQ(spacing(DynamicMatrix<double>(384, 3, SpacingPolicy::avoidAliasing)), 384);
+
+        for (size_t m : {256, 512, 1024, 2048})
+        {
+            DynamicMatrix<double> A(uninitialized, m, 3, SpacingPolicy::avoidAliasing);
+            EXPECT_GT(spacing(A), m);
+            EXPECT_NE(spacing(A) * sizeof(double) % ALIASING_STRIDE, 0);
+            EXPECT_TRUE(isSimdAligned(data(A) + spacing(A)));
+        }
+    }
+}
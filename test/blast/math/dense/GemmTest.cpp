@@ -13,6 +13,10 @@
 #include <test/Testing.hpp>
 #include <test/Tolerance.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 
 namespace blast :: testing
 {
@@ -24,15 +28,23 @@ namespace blast :: testing
         using Real = T;
 
 
-        template <bool SOA, bool SOB>
-        void testAlignedImpl()
+        /**
+         * @brief Compare a gemm variant with the reference implementation for all sizes
+         * m, n = 1...20 and k = 1, 1 + k_step, ... <= k_max.
+         *
+         * For every size, A, B, C, alpha and beta are randomized, and @a f is called as
+         * f(alpha, A, B, beta, C, D, D_ref). It must compute D with the tested gemm and D_ref with the reference.
+         */
+        template <bool SOA, bool SOB, typename F>
+        void testGemmImpl(size_t k_max, size_t k_step, F&& f)
         {
             for (size_t m = 1; m <= 20; m += 1)
                 for (size_t n = 1; n <= 20; n += 1)
-                    for (size_t k = 1; k <= 20; ++k)
+                    for (size_t k = 1; k <= k_max; k += k_step)
                     {
                         DynamicMatrix<Real, SOA> A(m, k), C(m, n), D(m, n);
                         DynamicMatrix<Real, SOB> B(k, n);
+                        DynamicMatrix<Real, columnMajor> D_ref(m, n);
                         randomize(A);
                         randomize(B);
                         randomize(C);
@@ -41,11 +53,10 @@ namespace blast :: testing
                         randomize(alpha);
                         randomize(beta);
 
-                        // Do gemm
-                        gemm(alpha, A, B, beta, C, D);
+                        f(alpha, A, B, beta, C, D, D_ref);
 
-                        DynamicMatrix<Real, columnMajor> D_ref(m, n);
-                        reference::gemm(alpha, A, B, beta, C, D_ref);
+                        if (HasFatalFailure())
+                            return;
 
                         BLAST_ASSERT_APPROX_EQ(D, D_ref, absTol<Real>(), relTol<Real>())
                             << "gemm error at size m,n,k=" << m << "," << n << "," << k;
@@ -53,6 +64,102 @@ namespace blast :: testing
         }
 
 
+        template <bool SOA, bool SOB>
+        void testAlignedImpl()
+        {
+            testGemmImpl<SOA, SOB>(20, 1, [] (Real alpha, auto const& A, auto const& B, Real beta, auto const& C, auto& D, auto& D_ref)
+            {
+                gemm(alpha, A, B, beta, C, D);
+                reference::gemm(alpha, A, B, beta, C, D_ref);
+            });
+        }
+
+
+        template <size_t PFD, bool SOA, bool SOB>
+        void testPrefetchImpl()
+        {
+            testGemmImpl<SOA, SOB>(40, 3, [] (Real alpha, auto const& A, auto const& B, Real beta, auto const& C, auto& D, auto& D_ref)
+            {
+                gemm<PFD>(alpha, A, B, beta, C, D);
+                reference::gemm(alpha, A, B, beta, C, D_ref);
+            });
+        }
+
+
+        template <Packing P, bool SOA, bool SOB>
+        void testPackingImpl()
+        {
+            testGemmImpl<SOA, SOB>(20, 1, [] (Real alpha, auto const& A, auto const& B, Real beta, auto const& C, auto& D, auto& D_ref)
+            {
+                gemm<P>(alpha, A, B, beta, C, D);
+                reference::gemm(alpha, A, B, beta, C, D_ref);
+            });
+        }
+
+
+        template <bool SOA, bool SOB>
+        void testEpilogueImpl()
+        {
+            testGemmImpl<SOA, SOB>(20, 3, [] (Real alpha, auto const& A, auto const& B, Real beta, auto const& C, auto& D, auto& D_ref)
+            {
+                size_t const m = rows(D), n = columns(D);
+
+                // Number of times each element of D is visited by the epilogue
+                std::vector<size_t> visits(m * n, 0);
+
+                // Do gemm with D := max(alpha * A * B + beta * C, 0)
+                gemm(alpha, A, B, beta, C, D,
+                    [&] (auto& ker, size_t i, size_t j, size_t km, size_t kn)
+                    {
+                        ker.transform([] (auto const& v) { return blast::max(v, std::decay_t<decltype(v)> {Real {}}); });
+
+                        for (size_t ii = 0; ii < km; ++ii)
+                            for (size_t jj = 0; jj < kn; ++jj)
+                                ++visits[(i + ii) + (j + jj) * m];
+                    }
+                );
+
+                reference::gemm(alpha, A, B, beta, C, D_ref);
+
+                for (size_t i = 0; i < m; ++i)
+                    for (size_t j = 0; j < n; ++j)
+                    {
+                        D_ref(i, j) = std::max(D_ref(i, j), Real {});
+                        ASSERT_EQ(visits[i + j * m], 1) << "element (" << i << ", " << j << ") visited "
+                            << visits[i + j * m] << " times at size m,n=" << m << "," << n;
+                    }
+            });
+        }
+
+
+        template <bool SOA, bool SOB>
+        void testOneZeroImpl()
+        {
+            testGemmImpl<SOA, SOB>(20, 3, [] (Real, auto const& A, auto const& B, Real, auto& C, auto& D, auto& D_ref)
+            {
+                // C must not be read if beta is zero
+                for (size_t i = 0; i < rows(C); ++i)
+                    for (size_t j = 0; j < columns(C); ++j)
+                        C(i, j) = std::numeric_limits<Real>::quiet_NaN();
+
+                gemm(one, A, B, zero, C, D);
+                reference::gemm(Real(1.), A, B, Real(0.), D_ref, D_ref);
+            });
+        }
+
+
+        template <bool SOA, bool SOB>
+        void testConvertibleScalarsImpl()
+        {
+            testGemmImpl<SOA, SOB>(20, 3, [] (Real, auto const& A, auto const& B, Real, auto const& C, auto& D, auto& D_ref)
+            {
+                // Scalars of a different type than the matrix elements
+                gemm(0.5, A, B, 2, C, D);
+                reference::gemm(Real(0.5), A, B, Real(2.), C, D_ref);
+            });
+        }
+
+
         template <bool SOA, bool SOB>
         void testUnalignedImpl()
         {
@@ -104,6 +211,102 @@ namespace blast :: testing
     }
 
 
+    TYPED_TEST_P(DenseGemmTest, testAlignedRc)
+    {
+        this->template testAlignedImpl<rowMajor, columnMajor>();
+    }
+
+
+    TYPED_TEST_P(DenseGemmTest, testAlignedRr)
+    {
+        this->template testAlignedImpl<rowMajor, rowMajor>();
+    }
+
+
+    TYPED_TEST_P(DenseGemmTest, testPrefetchCr)
+    {
+        this->template testPrefetchImpl<4, columnMajor, rowMajor>();
+    }
+
+
+    TYPED_TEST_P(DenseGemmTest, testPrefetchCc)
+    {
+        this->template testPrefetchImpl<4, columnMajor, columnMajor>();
+    }
+
+
+    TYPED_TEST_P(DenseGemmTest, testPrefetchDefaultCc)
+    {
+        this->template testPrefetchImpl<DEFAULT_PREFETCH_DISTANCE, columnMajor, columnMajor>();
+    }
+
+
+    TYPED_TEST_P(DenseGemmTest, testPackBCr)
+    {
+        this->template testPackingImpl<Packing::b, columnMajor, rowMajor>();
+    }
+
+
+    TYPED_TEST_P(DenseGemmTest, testPackBCc)
+    {
+        this->template testPackingImpl<Packing::b, columnMajor, columnMajor>();
+    }
+
+
+    TYPED_TEST_P(DenseGemmTest, testPackAbCc)
+    {
+        this->template testPackingImpl<Packing::ab, columnMajor, columnMajor>();
+    }
+
+
+    TYPED_TEST_P(DenseGemmTest, testPackARc)
+    {
+        this->template testPackingImpl<Packing::a, rowMajor, columnMajor>();
+    }
+
+
+    TYPED_TEST_P(DenseGemmTest, testPackNoneRc)
+    {
+        this->template testPackingImpl<Packing::none, rowMajor, columnMajor>();
+    }
+
+
+    TYPED_TEST_P(DenseGemmTest, testPackNoneRr)
+    {
+        this->template testPackingImpl<Packing::none, rowMajor, rowMajor>();
+    }
+
+
+    TYPED_TEST_P(DenseGemmTest, testEpilogueCr)
+    {
+        this->template testEpilogueImpl<columnMajor, rowMajor>();
+    }
+
+
+    TYPED_TEST_P(DenseGemmTest, testEpilogueCc)
+    {
+        this->template testEpilogueImpl<columnMajor, columnMajor>();
+    }
+
+
+    TYPED_TEST_P(DenseGemmTest, testOneZeroCr)
+    {
+        this->template testOneZeroImpl<columnMajor, rowMajor>();
+    }
+
+
+    TYPED_TEST_P(DenseGemmTest, testOneZeroCc)
+    {
+        this->template testOneZeroImpl<columnMajor, columnMajor>();
+    }
+
+
+    TYPED_TEST_P(DenseGemmTest, testConvertibleScalarsCc)
+    {
+        this->template testConvertibleScalarsImpl<columnMajor, columnMajor>();
+    }
+
+
     TYPED_TEST_P(DenseGemmTest, testUnalignedCr)
     {
         this->template testUnalignedImpl<columnMajor, rowMajor>();
@@ -119,6 +322,22 @@ namespace blast :: testing
     REGISTER_TYPED_TEST_SUITE_P(DenseGemmTest
         , testAlignedCr
         , testAlignedCc
+        , testAlignedRc
+        , testAlignedRr
+        , testPrefetchCr
+        , testPrefetchCc
+        , testPrefetchDefaultCc
+        , testPackBCr
+        , testPackBCc
+        , testPackAbCc
+        , testPackARc
+        , testPackNoneRc
+        , testPackNoneRr
+        , testEpilogueCr
+        , testEpilogueCc
+        , testOneZeroCr
+        , testOneZeroCc
+        , testConvertibleScalarsCc
         , testUnalignedCr
         , testUnalignedCc
     );
@@ -0,0 +1,193 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <version>
+
+#if defined(__cpp_lib_mdspan)
+
+#include <blast/math/dense/Mdspan.hpp>
+#include <blast/math/dense/DynamicMatrix.hpp>
+#include <blast/math/dense/Potrf.hpp>
+#include <blast/math/algorithm/Gemm.hpp>
+#include <blast/math/algorithm/MakePositiveDefinite.hpp>
+#include <blast/math/algorithm/Randomize.hpp>
+#include <blast/math/reference/Gemm.hpp>
+#include <blast/system/CacheLine.hpp>
+
+#include <test/Testing.hpp>
+#include <test/Tolerance.hpp>
+
+#include <mdspan>
+#include <stdexcept>
+#include <vector>
+
+
+namespace blast :: testing
+{
+    TEST(MdspanTest, testLayoutLeft)
+    {
+        std::vector<double> v(5 * 7);
+        std::mdspan m(v.data(), 5, 7);
+
+        auto A = asMatrix(m);
+        static_assert(StorageOrder_v<decltype(A)> == columnMajor);
+        static_assert(!IsAligned_v<decltype(A)> && !IsPadded_v<decltype(A)>);
+        ASSERT_EQ(rows(A), 5);
+        ASSERT_EQ(columns(A), 7);
+        EXPECT_EQ(spacing(A), 5);
+
+        A(3, 4) = 1.;
+        EXPECT_EQ((m[3, 4]), 1.);
+        EXPECT_EQ(ptr<false>(m, 3, 4).get(), &m[3, 4]);
+    }
+
+
+    TEST(MdspanTest, testLayoutRight)
+    {
+        std::vector<double> v(5 * 7);
+        std::mdspan<double, std::dextents<size_t, 2>, std::layout_right> m(v.data(), 5, 7);
+
+        auto A = asMatrix(m);
+        static_assert(StorageOrder_v<decltype(A)> == rowMajor);
+        EXPECT_EQ(spacing(A), 7);
+
+        A(3, 4) = 1.;
+        EXPECT_EQ((m[3, 4]), 1.);
+        EXPECT_EQ(ptr<false>(m, 3, 4).get(), &m[3, 4]);
+    }
+
+
+    TEST(MdspanTest, testLayoutStride)
+    {
+        using Extents = std::dextents<size_t, 2>;
+        std::vector<double> v(10 * 7);
+
+        // Column-major 5x7 submatrix of a 10x7 matrix
+        std::mdspan<double, Extents, std::layout_stride> m(v.data(), {Extents(5, 7), std::array {1, 10}});
+
+        auto A = asMatrix<columnMajor>(m);
+        EXPECT_EQ(spacing(A), 10);
+
+        A(3, 4) = 1.;
+        EXPECT_EQ((m[3, 4]), 1.);
+
+        EXPECT_THROW(asMatrix<rowMajor>(m), std::invalid_argument);
+    }
+
+
+    TEST(MdspanTest, testInvalidAccessor)
+    {
+        size_t constexpr SS = SimdSize_v<double>;
+        alignas(CACHE_LINE_SIZE) double v[4 * SS * 2] {};
+        using Extents = std::dextents<size_t, 2>;
+
+        EXPECT_THROW(asMatrix(std::mdspan(v + 1, std::layout_left::mapping(Extents(SS, 2)), SimdAccessor<double, true, true> {})),
+            std::invalid_argument);
+        EXPECT_THROW(asMatrix(std::mdspan(v, std::layout_left::mapping(Extents(SS + 1, 2)), SimdAccessor<double, false, true> {})),
+            std::invalid_argument);
+        EXPECT_NO_THROW(asMatrix(std::mdspan(v, std::layout_left::mapping(Extents(2 * SS, 2)), SimdAccessor<double, true, true> {})));
+    }
+
+
+    TEST(MdspanTest, testGemm)
+    {
+        using Real = double;
+        using Extents = std::dextents<size_t, 2>;
+        using Accessor = SimdAccessor<Real, true, true>;
+        using ConstAccessor = SimdAccessor<Real const, true, true>;
+        size_t constexpr SS = SimdSize_v<Real>;
+
+        for (size_t m = 1; m <= 20; m += 1)
+            for (size_t n = 1; n <= 20; n += 1)
+                for (size_t k = 1; k <= 20; k += 3)
+                {
+                    DynamicMatrix<Real> A(m, k), B(k, n), C(m, n), D(m, n);
+                    randomize(A);
+                    randomize(B);
+                    randomize(C);
+
+                    // Padded column-major views of the matrix storage; inputs are read-only
+                    auto const mapping = [] (auto const& M)
+                    {
+                        return std::layout_stride::mapping(Extents(rows(M), columns(M)), std::array {size_t(1), spacing(M)});
+                    };
+
+                    std::mdspan<Real const, Extents, std::layout_stride, ConstAccessor> const mA(data(A), mapping(A), ConstAccessor {});
+                    std::mdspan<Real const, Extents, std::layout_stride, ConstAccessor> const mB(data(B), mapping(B), ConstAccessor {});
+                    std::mdspan<Real const, Extents, std::layout_stride, ConstAccessor> const mC(data(C), mapping(C), ConstAccessor {});
+                    std::mdspan<Real, Extents, std::layout_stride, Accessor> const mD(data(D), mapping(D), Accessor {});
+                    ASSERT_EQ(spacing(D) % SS, 0);
+
+                    auto D1 = asMatrix<columnMajor>(mD);
+                    gemm(1., asMatrix<columnMajor>(mA), asMatrix<columnMajor>(mB), 1., asMatrix<columnMajor>(mC), D1);
+
+                    DynamicMatrix<Real> D_ref(m, n);
+                    reference::gemm(1., A, B, 1., C, D_ref);
+
+                    BLAST_ASSERT_APPROX_EQ(D, D_ref, absTol<Real>(), relTol<Real>())
+                        << "gemm error at size m,n,k=" << m << "," << n << "," << k;
+                }
+    }
+
+
+    TEST(MdspanTest, testGemmUnpadded)
+    {
+        using Real = double;
+
+        // Default accessor views of exactly sized storage are unaligned and unpadded
+        for (size_t m = 1; m <= 20; m += 1)
+            for (size_t n = 1; n <= 20; n += 3)
+                for (size_t k = 1; k <= 20; k += 3)
+                {
+                    std::vector<Real> a(m * k), b(k * n), c(m * n), d(m * n);
+                    auto A = asMatrix(std::mdspan(a.data(), m, k));
+                    auto B = asMatrix(std::mdspan(b.data(), k, n));
+                    auto C = asMatrix(std::mdspan(c.data(), m, n));
+                    auto D = asMatrix(std::mdspan(d.data(), m, n));
+                    static_assert(!IsPadded_v<decltype(D)>);
+                    randomize(A);
+                    randomize(B);
+                    randomize(C);
+
+                    gemm(1., A, B, 1., C, D);
+
+                    DynamicMatrix<Real> D_ref(m, n);
+                    reference::gemm(1., A, B, 1., C, D_ref);
+
+                    BLAST_ASSERT_APPROX_EQ(D, D_ref, absTol<Real>(), relTol<Real>())
+                        << "gemm error at size m,n,k=" << m << "," << n << "," << k;
+                }
+    }
+
+
+    TEST(MdspanTest, testPotrf)
+    {
+        using Real = double;
+        using Extents = std::dextents<size_t, 2>;
+        using Accessor = SimdAccessor<Real, true, true>;
+
+        for (size_t m = 1; m <= 30; ++m)
+        {
+            DynamicMatrix<Real> A(m, m), L(m, m);
+            makePositiveDefinite(A);
+
+            auto const mapping = std::layout_stride::mapping(Extents(m, m), std::array {size_t(1), spacing(A)});
+            auto mA = asMatrix<columnMajor>(std::mdspan(data(A), mapping, Accessor {}));
+            auto mL = asMatrix<columnMajor>(std::mdspan(data(L), mapping, Accessor {}));
+
+            potrf(mA, mL);
+
+            for (size_t i = 0; i < m; ++i)
+                for (size_t j = i + 1; j < m; ++j)
+                    L(i, j) = Real {};
+
+            DynamicMatrix<Real> A1(m, m);
+            reference::gemm(Real(1), L, trans(L), Real(0), A1, A1);
+
+            BLAST_EXPECT_APPROX_EQ(A1, A, absTol<Real>(), relTol<Real>()) << "potrf error for size " << m;
+        }
+    }
+}
+
+#endif
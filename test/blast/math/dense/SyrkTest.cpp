@@ -11,6 +11,8 @@
 
 #include <blast/blaze/Math.hpp>
 
+#include <limits>
+
 
 namespace blast :: testing
 {
@@ -66,8 +68,39 @@ namespace blast :: testing
             }
     }
 
+    TYPED_TEST_P(DenseSyrkTest, testDynamicLnOneZero)
+    {
+        using Real = double;
+
+        for (size_t m = 1; m <= 20; m += 1)
+            for (size_t k = 1; k <= 20; ++k)
+            {
+                blaze::DynamicMatrix<Real, columnMajor> A(m, k);
+                blaze::DynamicMatrix<Real, columnMajor> C(m, m), D(m, m);
+                randomize(A);
+
+                // C must not be read if beta is zero
+                C = std::numeric_limits<Real>::quiet_NaN();
+
+                // D = A * A^T; D lower triangular
+                D = 0.;
+                syrkLower(one, A, zero, C, D);
+
+                // Calculate the reference value
+                auto D_ref = evaluate(A * trans(A));
+                for (size_t i = 0; i < m; ++i)
+                    for (size_t j = i + 1; j < m; ++j)
+                        D_ref(i, j) = 0.;
+
+                BLAST_ASSERT_APPROX_EQ(D, D_ref, 1e-10, 1e-10)
+                    << "syrk error at size m,k=" << m << "," << k;
+            }
+    }
+
+
     REGISTER_TYPED_TEST_SUITE_P(DenseSyrkTest
         ,   testDynamicLn
+        ,   testDynamicLnOneZero
     );
 
 
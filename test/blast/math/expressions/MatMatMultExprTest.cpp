@@ -0,0 +1,178 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#define BLAST_USER_ASSERTION 1
+
+#include <blast/math/expressions/MatMatMultExpr.hpp>
+#include <blast/math/expressions/MatMatMultAddExpr.hpp>
+#include <blast/math/expressions/MatSolveExpr.hpp>
+#include <blast/math/dense/DynamicMatrix.hpp>
+#include <blast/math/dense/StaticMatrix.hpp>
+#include <blast/math/algorithm/MakePositiveDefinite.hpp>
+#include <blast/math/algorithm/Randomize.hpp>
+#include <blast/math/reference/Gemm.hpp>
+
+#include <test/Testing.hpp>
+#include <test/Tolerance.hpp>
+
+#include <stdexcept>
+
+
+namespace blast :: testing
+{
+    template <typename T>
+    class MatMatMultExprTest
+    :   public Test
+    {
+    protected:
+        using Real = T;
+    };
+
+
+    using MatMatMultExprTestTypes = Types<double, float>;
+    TYPED_TEST_SUITE(MatMatMultExprTest, MatMatMultExprTestTypes);
+
+
+    TYPED_TEST(MatMatMultExprTest, testProduct)
+    {
+        using Real = TypeParam;
+
+        for (size_t m = 1; m <= 12; m += 3)
+            for (size_t n = 1; n <= 12; n += 2)
+                for (size_t k = 1; k <= 12; k += 5)
+                {
+                    DynamicMatrix<Real> A(m, k), B(k, n), D(m, n), D_ref(m, n);
+                    randomize(A);
+                    randomize(B);
+
+                    D = A * B;
+
+                    reference::gemm(Real(1), A, B, Real(0), D_ref, D_ref);
+                    BLAST_ASSERT_APPROX_EQ(D, D_ref, absTol<Real>(), relTol<Real>());
+                }
+    }
+
+
+    TYPED_TEST(MatMatMultExprTest, testScaledProductPlusScaledMatrix)
+    {
+        using Real = TypeParam;
+
+        for (size_t m = 1; m <= 12; m += 3)
+            for (size_t n = 1; n <= 12; n += 2)
+                for (size_t k = 1; k <= 12; k += 5)
+                {
+                    DynamicMatrix<Real> A(m, k), B(n, k), C(m, n), D(m, n), D_ref(m, n);
+                    randomize(A);
+                    randomize(B);
+                    randomize(C);
+
+                    Real alpha, beta;
+                    randomize(alpha);
+                    randomize(beta);
+
+                    D = alpha * A * trans(B) + beta * C;
+
+                    reference::gemm(alpha, A, trans(B), beta, C, D_ref);
+                    BLAST_ASSERT_APPROX_EQ(D, D_ref, absTol<Real>(), relTol<Real>());
+                }
+    }
+
+
+    TYPED_TEST(MatMatMultExprTest, testInPlaceUpdate)
+    {
+        using Real = TypeParam;
+        size_t constexpr M = 5, N = 7, K = 3;
+
+        StaticMatrix<Real, M, K> A;
+        StaticMatrix<Real, K, N> B;
+        StaticMatrix<Real, M, N> D, D_ref;
+        randomize(A);
+        randomize(B);
+        randomize(D);
+
+        reference::gemm(Real(1), A, B, Real(-1), D, D_ref);
+
+        // D can be the same matrix as C
+        D = A * B - D;
+        BLAST_EXPECT_APPROX_EQ(D, D_ref, absTol<Real>(), relTol<Real>());
+    }
+
+
+    TYPED_TEST(MatMatMultExprTest, testLowerRankUpdate)
+    {
+        using Real = TypeParam;
+
+        for (size_t m = 1; m <= 20; m += 3)
+            for (size_t k = 1; k <= 12; k += 5)
+            {
+                DynamicMatrix<Real> A(m, k), C(m, m), D(m, m), D_ref(m, m);
+                randomize(A);
+                randomize(C);
+
+                assignLower(D, A * trans(A) + C);
+
+                reference::gemm(Real(1), A, trans(A), Real(1), C, D_ref);
+                for (size_t j = 0; j < m; ++j)
+                    for (size_t i = j; i < m; ++i)
+                        ASSERT_NEAR(D(i, j), D_ref(i, j), absTol<Real>() + relTol<Real>() * std::abs(D_ref(i, j)));
+            }
+    }
+
+
+    TYPED_TEST(MatMatMultExprTest, testLowerRankUpdateNotSymmetric)
+    {
+        using Real = TypeParam;
+        DynamicMatrix<Real> A(4, 3), B(4, 3), C(4, 4), D(4, 4);
+
+        EXPECT_THROW(assignLower(D, A * trans(B) + C), std::invalid_argument);
+    }
+
+
+    TYPED_TEST(MatMatMultExprTest, testAliasedOperand)
+    {
+        using Real = TypeParam;
+        DynamicMatrix<Real> A(4, 4), C(4, 4), D(4, 4);
+
+        EXPECT_THROW(D = A * D, std::invalid_argument);
+        EXPECT_THROW(D = D * A, std::invalid_argument);
+        EXPECT_THROW(D = A * trans(D) + C, std::invalid_argument);
+        EXPECT_THROW(assignLower(A, A * trans(A)), std::invalid_argument);
+        EXPECT_THROW(assignLower(A, A * trans(A) + C), std::invalid_argument);
+    }
+
+
+    TYPED_TEST(MatMatMultExprTest, testSizeMismatch)
+    {
+        using Real = TypeParam;
+        DynamicMatrix<Real> A(4, 3), B(4, 3);
+
+        EXPECT_THROW(A * B, std::invalid_argument);
+    }
+
+
+    TYPED_TEST(MatMatMultExprTest, testSolve)
+    {
+        using Real = TypeParam;
+        size_t const m = 6, n = 4;
+
+        DynamicMatrix<Real> L(m, m), B(m, n), X(m, n), B_ref(m, n);
+        makePositiveDefinite(L);
+        randomize(B);
+
+        for (size_t j = 0; j < m; ++j)
+            for (size_t i = 0; i < j; ++i)
+                L(i, j) = Real(0);
+
+        // Solve L^T*X = B and check the residual
+        X = solve<UpLo::Upper>(trans(L), B);
+        reference::gemm(Real(1), trans(L), X, Real(0), B_ref, B_ref);
+        BLAST_EXPECT_APPROX_EQ(B_ref, B, absTol<Real>(), relTol<Real>());
+
+        // In-place solution L*X = B
+        X = B;
+        X = solve<UpLo::Lower>(L, X);
+        reference::gemm(Real(1), L, X, Real(0), B_ref, B_ref);
+        BLAST_EXPECT_APPROX_EQ(B_ref, B, absTol<Real>(), relTol<Real>());
+    }
+}
@@ -0,0 +1,147 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <blast/math/panel/CustomPanelMatrix.hpp>
+#include <blast/math/DynamicPanelMatrix.hpp>
+#include <blast/math/dense/DynamicMatrix.hpp>
+#include <blast/math/panel/Potrf.hpp>
+#include <blast/math/algorithm/Gemm.hpp>
+#include <blast/math/algorithm/MakePositiveDefinite.hpp>
+#include <blast/math/algorithm/Randomize.hpp>
+#include <blast/math/reference/Gemm.hpp>
+#include <blast/system/CacheLine.hpp>
+
+#include <test/Testing.hpp>
+#include <test/Tolerance.hpp>
+
+#include <memory_resource>
+#include <stdexcept>
+
+
+namespace blast :: testing
+{
+    class CustomPanelMatrixTest
+    :   public Test
+    {
+    protected:
+        using Real = double;
+        static size_t constexpr SS = SimdSize_v<Real>;
+
+
+        /// @brief Allocate a zero-initialized panel matrix from the arena
+        CustomPanelMatrix<Real> allocate(size_t m, size_t n)
+        {
+            size_t const capacity = nextMultiple(m, SS) * n;
+            Real * const p = static_cast<Real *>(arena_.allocate(capacity * sizeof(Real), CACHE_LINE_SIZE));
+            std::fill_n(p, capacity, Real {});
+            return CustomPanelMatrix<Real>(p, m, n);
+        }
+
+
+        std::pmr::monotonic_buffer_resource arena_;
+    };
+
+
+    TEST_F(CustomPanelMatrixTest, testTraits)
+    {
+        EXPECT_TRUE(IsPanelMatrix_v<CustomPanelMatrix<Real>>);
+        EXPECT_FALSE(IsStatic_v<CustomPanelMatrix<Real>>);
+        EXPECT_TRUE(IsAligned_v<CustomPanelMatrix<Real>>);
+        EXPECT_TRUE(IsPadded_v<CustomPanelMatrix<Real>>);
+    }
+
+
+    TEST_F(CustomPanelMatrixTest, testElementAccess)
+    {
+        size_t constexpr M = 5;
+        size_t constexpr N = 7;
+
+        // A custom panel matrix has the same layout as a DynamicPanelMatrix with the same spacing
+        DynamicPanelMatrix<Real> A_ref(M, N);
+        randomize(A_ref);
+
+        CustomPanelMatrix<Real> A(A_ref.data(), M, N, A_ref.spacing());
+
+        for (size_t i = 0; i < M; ++i)
+            for (size_t j = 0; j < N; ++j)
+                EXPECT_EQ(A(i, j), A_ref(i, j)) << "element mismatch at (" << i << ", " << j << ")";
+    }
+
+
+    TEST_F(CustomPanelMatrixTest, testCopyAssignment)
+    {
+        auto A = allocate(5, 3);
+        auto B = allocate(5, 3);
+        randomize(A);
+
+        // Assignment copies the elements and keeps referring to the same memory
+        Real * const data_B = B.data();
+        B = A;
+        EXPECT_EQ(B.data(), data_B);
+
+        for (size_t i = 0; i < 5; ++i)
+            for (size_t j = 0; j < 3; ++j)
+                EXPECT_EQ(B(i, j), A(i, j)) << "element mismatch at (" << i << ", " << j << ")";
+
+        auto C = allocate(5, 4);
+        EXPECT_THROW(C = A, std::invalid_argument);
+    }
+
+
+    TEST_F(CustomPanelMatrixTest, testInvalidArguments)
+    {
+        alignas(CACHE_LINE_SIZE) Real v[4 * SS * SS] {};
+
+        EXPECT_THROW(CustomPanelMatrix<Real>(v + 1, SS, 2), std::invalid_argument);
+        EXPECT_THROW(CustomPanelMatrix<Real>(v, SS, 2, SS), std::invalid_argument);
+        EXPECT_THROW(CustomPanelMatrix<Real>(v, SS, 2, 2 * SS + 1), std::invalid_argument);
+    }
+
+
+    TEST_F(CustomPanelMatrixTest, testGemm)
+    {
+        for (size_t m = 1; m <= 20; ++m)
+            for (size_t n = 1; n <= 20; ++n)
+                for (size_t k = 1; k <= 20; k += 3)
+                {
+                    arena_.release();
+
+                    auto A = allocate(m, k);
+                    auto B = allocate(n, k);
+                    auto C = allocate(m, n);
+                    auto D = allocate(m, n);
+                    randomize(A);
+                    randomize(B);
+                    randomize(C);
+
+                    gemm(A, trans(B), C, D);
+
+                    DynamicMatrix<Real> D_ref(m, n);
+                    reference::gemm(1., A, trans(B), 1., C, D_ref);
+
+                    BLAST_ASSERT_APPROX_EQ(D, D_ref, absTol<Real>(), relTol<Real>())
+                        << "gemm error at size m,n,k=" << m << "," << n << "," << k;
+                }
+    }
+
+
+    TEST_F(CustomPanelMatrixTest, testPotrf)
+    {
+        for (size_t m = 1; m <= 30; ++m)
+        {
+            arena_.release();
+
+            auto A = allocate(m, m);
+            auto L = allocate(m, m);
+            makePositiveDefinite(A);
+
+            potrf(A, L);
+
+            DynamicMatrix<Real> A1(m, m);
+            reference::gemm(1., L, trans(L), 0., A1, A1);
+
+            BLAST_EXPECT_APPROX_EQ(A1, A, absTol<Real>(), relTol<Real>()) << "potrf error for size " << m;
+        }
+    }
+}
@@ -9,6 +9,10 @@
 #include <test/Testing.hpp>
 #include <blast/math/algorithm/Randomize.hpp>
 
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
 
 namespace blast :: testing
 {
@@ -112,4 +116,130 @@ namespace blast :: testing
             for (size_t j = 0; j < N; ++j)
                 EXPECT_EQ(A(i, j), A1(i, j)) << "element mismatch at (" << i << ", " << j << ")";
     }
+
+
+    TEST(DynamicPanelMatrixTest, testCopy)
+    {
+        size_t constexpr M = 5;
+        size_t constexpr N = 7;
+
+        DynamicPanelMatrix<double> A(M, N);
+        for (size_t i = 0; i < M; ++i)
+            for (size_t j = 0; j < N; ++j)
+                blaze::randomize(A(i, j));
+
+        DynamicPanelMatrix<double> B(A);
+        EXPECT_NE(B.data(), A.data());
+
+        DynamicPanelMatrix<double> C(2, 3);
+        C = A;
+        ASSERT_EQ(C.rows(), M);
+        ASSERT_EQ(C.columns(), N);
+        EXPECT_EQ(C.spacing(), A.spacing());
+
+        for (size_t i = 0; i < M; ++i)
+            for (size_t j = 0; j < N; ++j)
+            {
+                EXPECT_EQ(B(i, j), A(i, j)) << "element mismatch at (" << i << ", " << j << ")";
+                EXPECT_EQ(C(i, j), A(i, j)) << "element mismatch at (" << i << ", " << j << ")";
+            }
+    }
+
+
+    TEST(DynamicPanelMatrixTest, testMove)
+    {
+        EXPECT_TRUE(std::is_nothrow_move_constructible_v<DynamicPanelMatrix<double>>);
+        EXPECT_TRUE(std::is_nothrow_move_assignable_v<DynamicPanelMatrix<double>>);
+
+        DynamicPanelMatrix<double> A(5, 7);
+        A = 1.;
+        double const * const p = A.data();
+
+        DynamicPanelMatrix<double> B(std::move(A));
+        EXPECT_EQ(B.data(), p);
+        EXPECT_EQ(A.rows(), 0);
+        EXPECT_EQ(A.columns(), 0);
+
+        DynamicPanelMatrix<double> C(2, 3);
+        C = std::move(B);
+        EXPECT_EQ(C.data(), p);
+        EXPECT_EQ(C(4, 6), 1.);
+    }
+
+
+    TEST(DynamicPanelMatrixTest, testMemoryResource)
+    {
+        alignas(CACHE_LINE_SIZE) std::byte buffer[4096];
+        std::pmr::monotonic_buffer_resource arena {buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+
+        DynamicPanelMatrix<double> A(5, 7, &arena);
+        EXPECT_EQ(A.resource(), &arena);
+        EXPECT_GE(static_cast<void *>(A.data()), static_cast<void *>(buffer));
+        EXPECT_LT(static_cast<void *>(A.data()), static_cast<void *>(buffer + sizeof(buffer)));
+
+        DynamicPanelMatrix<double> B(A, &arena);
+        EXPECT_EQ(B.resource(), &arena);
+        EXPECT_EQ(B(4, 6), A(4, 6));
+    }
+
+
+    TEST(DynamicPanelMatrixTest, testCapacity)
+    {
+        size_t constexpr SS = SimdSize_v<double>;
+        size_t constexpr M = 5;
+        size_t constexpr N = 7;
+
+        // The arena holds exactly the panels of an M by N matrix
+        alignas(CACHE_LINE_SIZE) std::byte buffer[nextMultiple(M, SS) * N * sizeof(double)];
+        std::pmr::monotonic_buffer_resource arena {buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+
+        DynamicPanelMatrix<double> A(M, N, &arena);
+        A(M - 1, N - 1) = 1.;
+        EXPECT_EQ(A(M - 1, N - 1), 1.);
+    }
+
+
+    TEST(DynamicPanelMatrixTest, testUninitialized)
+    {
+        size_t constexpr SS = SimdSize_v<double>;
+
+        for (size_t m = 1; m <= 10; ++m)
+            for (size_t n = 1; n <= 10; ++n)
+            {
+                DynamicPanelMatrix<double> A(uninitialized, m, n);
+                ASSERT_EQ(A.rows(), m);
+                ASSERT_EQ(A.columns(), n);
+
+                for (size_t j = 0; j < n; ++j)
+                    for (size_t i = m; i < nextMultiple(m, SS); ++i)
+                        EXPECT_EQ(A.data()[i / SS * A.spacing() + i % SS + j * SS], 0.)
+                            << "nonzero padding at (" << i << ", " << j << ")";
+            }
+    }
+
+
+    TEST(DynamicPanelMatrixTest, testSpacingPolicy)
+    {
+        size_t constexpr SS = SimdSize_v<double>;
+
+        // A 2 KiB panel spacing is aliased, too
+        EXPECT_GT(DynamicPanelMatrix<double>(5, 256 / SS, SpacingPolicy::avoidAliasing).spacing(), 256);
+
+        EXPECT_EQ(DynamicPanelMatrix<double>(5, 512, SpacingPolicy::none).spacing(), SS * 512);
+        EXPECT_EQ(DynamicPanelMatrix<double>(5, 512).spacing(), SS * 512);
+
+        DynamicPanelMatrix<double> A(5, 512, SpacingPolicy::avoidAliasing);
+        EXPECT_GT(A.spacing(), SS * 512);
+        EXPECT_EQ(A.spacing() % SS, 0);
+        EXPECT_NE(A.spacing() * sizeof(double) % ALIASING_STRIDE, 0);
+
+        // Element access is consistent with the panel spacing
+        for (size_t i = 0; i < A.rows(); ++i)
+            for (size_t j = 0; j < A.columns(); ++j)
+                A(i, j) = 1000. * i + j;
+
+        for (size_t i = 0; i < A.rows(); ++i)
+            for (size_t j = 0; j < A.columns(); ++j)
+                EXPECT_EQ(A.data()[i / SS * A.spacing() + i % SS + j * SS], 1000. * i + j);
+    }
 }
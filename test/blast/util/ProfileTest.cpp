@@ -0,0 +1,121 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <blast/util/Profile.hpp>
+#include <blast/math/algorithm/Gemm.hpp>
+#include <blast/math/algorithm/Randomize.hpp>
+#include <blast/math/dense/Getrf.hpp>
+#include <blast/math/dense/Iamax.hpp>
+#include <blast/blaze/Math.hpp>
+
+#include <test/Testing.hpp>
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#if !defined(BLAST_PROFILE)
+#   error "BLAST_PROFILE must be defined for the profiling tests"
+#endif
+
+
+namespace blast :: testing
+{
+    using profile::Routine;
+
+
+    TEST(ProfileTest, testSizeBin)
+    {
+        EXPECT_EQ(profile::sizeBin(0), 0);
+        EXPECT_EQ(profile::sizeBin(1), 0);
+        EXPECT_EQ(profile::sizeBin(2), 1);
+        EXPECT_EQ(profile::sizeBin(3), 2);
+        EXPECT_EQ(profile::sizeBin(4), 2);
+        EXPECT_EQ(profile::sizeBin(5), 3);
+        EXPECT_EQ(profile::sizeBin(1024), profile::sizeBins - 2);
+        EXPECT_EQ(profile::sizeBin(1025), profile::sizeBins - 1);
+        EXPECT_EQ(profile::sizeBin(100000), profile::sizeBins - 1);
+    }
+
+
+    TEST(ProfileTest, testGemm)
+    {
+        blaze::DynamicMatrix<double, columnMajor> A(5, 3), B(3, 7), C(5, 7), D(5, 7);
+        randomize(A);
+        randomize(B);
+        randomize(C);
+
+        profile::Snapshot const before = profile::snapshot();
+        gemm(1., A, B, 1., C, D);
+        gemm(1., A, B, 1., C, D);
+        profile::Snapshot const delta = profile::snapshot() - before;
+
+        EXPECT_EQ(delta[Routine::gemm].calls, 2);
+        EXPECT_EQ(delta[Routine::gemm].binCalls[profile::sizeBin(7)], 2);
+        EXPECT_GT(delta[Routine::gemm].cycles, 0);
+        EXPECT_EQ(delta[Routine::gemm].binCycles[profile::sizeBin(7)], delta[Routine::gemm].cycles);
+    }
+
+
+    TEST(ProfileTest, testNestedCallsAttributedToOutermost)
+    {
+        size_t const N = 40;
+        blaze::DynamicMatrix<double, columnMajor> A(N, N);
+        randomize(A);
+        std::vector<size_t> ipiv(N);
+
+        profile::Snapshot const before = profile::snapshot();
+        getrf(A, ipiv.data());
+        profile::Snapshot const delta = profile::snapshot() - before;
+
+        EXPECT_EQ(delta[Routine::getrf].calls, 1);
+        EXPECT_EQ(delta[Routine::getrf].binCalls[profile::sizeBin(N)], 1);
+        EXPECT_EQ(delta[Routine::gemm].calls, 0);
+        EXPECT_EQ(delta[Routine::iamax].calls, 0);
+        EXPECT_EQ(delta[Routine::ger].calls, 0);
+    }
+
+
+    TEST(ProfileTest, testThreads)
+    {
+        size_t const numThreads = 4;
+        size_t const callsPerThread = 10;
+
+        profile::Snapshot const before = profile::snapshot();
+
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < numThreads; ++t)
+            threads.emplace_back([] {
+                blaze::DynamicVector<float> x(17);
+                randomize(x);
+
+                for (size_t i = 0; i < callsPerThread; ++i)
+                    iamax(x);
+            });
+
+        for (auto& t : threads)
+            t.join();
+
+        profile::Snapshot const delta = profile::snapshot() - before;
+        EXPECT_EQ(delta[Routine::iamax].calls, numThreads * callsPerThread);
+        EXPECT_EQ(delta[Routine::iamax].binCalls[profile::sizeBin(17)], numThreads * callsPerThread);
+    }
+
+
+    TEST(ProfileTest, testDump)
+    {
+        blaze::DynamicVector<double> x(3);
+        randomize(x);
+
+        profile::Snapshot const before = profile::snapshot();
+        iamax(x);
+
+        std::ostringstream os;
+        profile::dump(os, profile::snapshot() - before);
+
+        EXPECT_THAT(os.str(), HasSubstr("iamax"));
+        EXPECT_THAT(os.str(), HasSubstr("<=4"));
+        EXPECT_THAT(os.str(), Not(HasSubstr("gemm")));
+    }
+}
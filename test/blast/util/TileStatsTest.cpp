@@ -0,0 +1,86 @@
+// Copyright 2024 Mikhail Katliar. All rights reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include <blast/util/TileStats.hpp>
+#include <blast/math/algorithm/Gemm.hpp>
+#include <blast/math/algorithm/Randomize.hpp>
+#include <blast/math/simd/SimdSize.hpp>
+#include <blast/blaze/Math.hpp>
+
+#include <test/Testing.hpp>
+
+#include <sstream>
+
+#if !defined(BLAST_TILE_STATS)
+#   error "BLAST_TILE_STATS must be defined for the tile statistics tests"
+#endif
+
+
+namespace blast :: testing
+{
+    TEST(TileStatsTest, testFullTile)
+    {
+        // One SS x 4 register tile covers the result
+        size_t constexpr SS = SimdSize_v<double>;
+        blaze::DynamicMatrix<double, columnMajor> A(SS, 5), B(5, 4), C(SS, 4), D(SS, 4);
+        randomize(A);
+        randomize(B);
+        randomize(C);
+
+        profile::TileStats const before = profile::tileStats();
+        gemm(1., A, B, 1., C, D);
+        profile::TileStats const delta = profile::tileStats() - before;
+
+        EXPECT_EQ(delta.fullTiles[SS][4], 1);
+        EXPECT_EQ(delta.totalFullTiles(), 1);
+        EXPECT_EQ(delta.totalPartialTiles(), 0);
+        EXPECT_EQ(delta.stores, 4);
+        EXPECT_EQ(delta.maskedStores, 0);
+
+        // 4 columns of C and 5 columns of A
+        EXPECT_EQ(delta.loads, 4 + 5);
+        EXPECT_EQ(delta.maskedLoads, 0);
+    }
+
+
+    TEST(TileStatsTest, testPartialTile)
+    {
+        // The last row does not fit into SIMD registers, so it is stored with a mask
+        size_t constexpr SS = SimdSize_v<double>;
+        blaze::DynamicMatrix<double, columnMajor> A(SS + 1, 5), B(5, 4), C(SS + 1, 4), D(SS + 1, 4);
+        randomize(A);
+        randomize(B);
+        randomize(C);
+
+        profile::TileStats const before = profile::tileStats();
+        gemm(1., A, B, 1., C, D);
+        profile::TileStats const delta = profile::tileStats() - before;
+
+        EXPECT_GE(delta.totalPartialTiles(), 1);
+        EXPECT_EQ(delta.maskedStores, 4);
+
+        // Padded matrices are loaded without masks
+        EXPECT_GT(delta.loads, 0);
+        EXPECT_EQ(delta.maskedLoads, 0);
+    }
+
+
+    TEST(TileStatsTest, testDump)
+    {
+        size_t constexpr SS = SimdSize_v<float>;
+        blaze::DynamicMatrix<float, columnMajor> A(SS, 3), B(3, 4), C(SS, 4), D(SS, 4);
+        randomize(A);
+        randomize(B);
+        randomize(C);
+
+        profile::TileStats const before = profile::tileStats();
+        gemm(1.f, A, B, 1.f, C, D);
+
+        std::ostringstream os;
+        profile::dump(os, profile::tileStats() - before);
+
+        EXPECT_THAT(os.str(), HasSubstr(std::to_string(SS) + "x4"));
+        EXPECT_THAT(os.str(), HasSubstr("stores"));
+    }
+}